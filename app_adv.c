@@ -0,0 +1,362 @@
+/******************************************************************************
+* File Name: app_adv.c
+*
+* Description: Single-pass advertising data parser and a rule matcher
+*              prepared once, so that each advertising report is parsed once
+*              however many match criteria are configured.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_adv.h"
+#include <string.h>
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/* Returns WICED_TRUE if the little-endian 16-bit list holds uuid */
+static wiced_bool_t app_adv_has_uuid16(const uint8_t *p_list, uint8_t count, uint16_t uuid)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (uuid == (uint16_t)(p_list[2u * i] | (p_list[(2u * i) + 1u] << 8)))
+        {
+            return WICED_TRUE;
+        }
+    }
+    return WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_adv_parse
+********************************************************************************
+* Summary:
+*  Walks the AD structures of an advertising report once and records the
+*  flags, name, service UUID lists, appearance and TX power. A complete name
+*  takes precedence over a shortened one; for the other fields the first
+*  occurrence counts.
+*
+* Parameters:
+*  const uint8_t *p_adv   : Advertising data, ended by a zero length or max_len
+*  uint16_t max_len       : Size of the advertising data
+*  app_adv_info_t *p_info : Filled with the fields found
+*
+* Return:
+*  wiced_bool_t: WICED_FALSE if an AD structure runs past the data; the
+*                fields before it are still filled in
+*
+*******************************************************************************/
+wiced_bool_t app_adv_parse(const uint8_t *p_adv, uint16_t max_len, app_adv_info_t *p_info)
+{
+    uint16_t pos = 0;
+
+    memset(p_info, 0, sizeof(*p_info));
+    if (NULL == p_adv)
+    {
+        return WICED_FALSE;
+    }
+
+    /* Each AD structure: length(1) type(1) data(length - 1) */
+    while ((pos < max_len) && (0 != p_adv[pos]))
+    {
+        uint8_t len = (uint8_t)(p_adv[pos] - 1u);
+        const uint8_t *p_data = &p_adv[pos + 2u];
+
+        if ((pos + 1u + p_adv[pos]) > max_len)
+        {
+            return WICED_FALSE;
+        }
+
+        switch (p_adv[pos + 1u])
+        {
+            case BTM_BLE_ADVERT_TYPE_FLAG:
+                if ((len >= 1u) && !(p_info->present & APP_ADV_HAS_FLAGS))
+                {
+                    p_info->flags = p_data[0];
+                    p_info->present |= APP_ADV_HAS_FLAGS;
+                }
+                break;
+
+            case BTM_BLE_ADVERT_TYPE_NAME_COMPLETE:
+                p_info->p_name = p_data;
+                p_info->name_len = len;
+                p_info->present |= APP_ADV_HAS_NAME;
+                break;
+
+            case BTM_BLE_ADVERT_TYPE_NAME_SHORT:
+                if (!(p_info->present & APP_ADV_HAS_NAME))
+                {
+                    p_info->p_name = p_data;
+                    p_info->name_len = len;
+                }
+                p_info->present |= APP_ADV_HAS_NAME_SHORT;
+                break;
+
+            case BTM_BLE_ADVERT_TYPE_16SRV_PARTIAL:
+            case BTM_BLE_ADVERT_TYPE_16SRV_COMPLETE:
+                if (!(p_info->present & APP_ADV_HAS_UUID16))
+                {
+                    p_info->p_uuid16 = p_data;
+                    p_info->uuid16_count = len / 2u;
+                    p_info->present |= APP_ADV_HAS_UUID16;
+                }
+                break;
+
+            case APP_ADV_TYPE_16SOLICIT:
+                if (!(p_info->present & APP_ADV_HAS_SOLICIT16))
+                {
+                    p_info->p_solicit16 = p_data;
+                    p_info->solicit16_count = len / 2u;
+                    p_info->present |= APP_ADV_HAS_SOLICIT16;
+                }
+                break;
+
+            case BTM_BLE_ADVERT_TYPE_128SRV_PARTIAL:
+            case BTM_BLE_ADVERT_TYPE_128SRV_COMPLETE:
+                if (!(p_info->present & APP_ADV_HAS_UUID128))
+                {
+                    p_info->p_uuid128 = p_data;
+                    p_info->uuid128_count = len / APP_ADV_UUID128_LEN;
+                    p_info->present |= APP_ADV_HAS_UUID128;
+                }
+                break;
+
+            case BTM_BLE_ADVERT_TYPE_APPEARANCE:
+                if ((len >= 2u) && !(p_info->present & APP_ADV_HAS_APPEARANCE))
+                {
+                    p_info->appearance = (uint16_t)(p_data[0] | (p_data[1] << 8));
+                    p_info->present |= APP_ADV_HAS_APPEARANCE;
+                }
+                break;
+
+            case BTM_BLE_ADVERT_TYPE_TX_POWER:
+                if ((len >= 1u) && !(p_info->present & APP_ADV_HAS_TX_POWER))
+                {
+                    p_info->tx_power = (int8_t)p_data[0];
+                    p_info->present |= APP_ADV_HAS_TX_POWER;
+                }
+                break;
+
+            default:
+                break;
+        }
+        pos = (uint16_t)(pos + 1u + p_adv[pos]);
+    }
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_adv_matcher_init
+********************************************************************************
+* Summary:
+*  Prepares a rule table for app_adv_match(): measures the names once, groups
+*  the rules and works out which fields each group needs, so that a report
+*  missing one of them is rejected without running the group's tests.
+*
+* Parameters:
+*  app_adv_matcher_t *p_matcher  : Matcher to fill
+*  const app_adv_rule_t *p_rules : Rule table; the rules must outlive the matcher
+*  uint8_t rule_count            : Number of rules, up to APP_ADV_MAX_RULES
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, or WICED_BT_BADARG for a rule table the
+*                  matcher cannot hold
+*
+*******************************************************************************/
+wiced_result_t app_adv_matcher_init(app_adv_matcher_t *p_matcher, const app_adv_rule_t *p_rules,
+                                    uint8_t rule_count)
+{
+    app_adv_group_t *p_group = NULL;
+    uint8_t i;
+    uint8_t j;
+
+    memset(p_matcher, 0, sizeof(*p_matcher));
+    if (rule_count > APP_ADV_MAX_RULES)
+    {
+        return WICED_BT_BADARG;
+    }
+
+    for (i = 0; i < rule_count; i++)
+    {
+        const app_adv_rule_t *p_rule = &p_rules[i];
+        app_adv_test_t *p_test = &p_matcher->tests[i];
+        uint8_t required = 0;
+
+        p_test->type = (uint8_t)p_rule->type;
+        p_test->value = p_rule->value;
+        p_test->p_data = (const uint8_t *)p_rule->p_data;
+
+        switch (p_rule->type)
+        {
+            case APP_ADV_RULE_NAME:
+            case APP_ADV_RULE_NAME_PREFIX:
+                if ((NULL == p_rule->p_data) ||
+                    (strlen((const char *)p_rule->p_data) > APP_ADV_DATA_MAX_LEN))
+                {
+                    return WICED_BT_BADARG;
+                }
+                p_test->len = (uint8_t)strlen((const char *)p_rule->p_data);
+                /* A prefix may match either name, so it cannot require one */
+                required = (APP_ADV_RULE_NAME == p_rule->type) ? APP_ADV_HAS_NAME : 0u;
+                break;
+            case APP_ADV_RULE_UUID16:
+                required = APP_ADV_HAS_UUID16;
+                break;
+            case APP_ADV_RULE_SOLICIT16:
+                required = APP_ADV_HAS_SOLICIT16;
+                break;
+            case APP_ADV_RULE_UUID128:
+                if (NULL == p_rule->p_data)
+                {
+                    return WICED_BT_BADARG;
+                }
+                p_test->len = APP_ADV_UUID128_LEN;
+                required = APP_ADV_HAS_UUID128;
+                break;
+            case APP_ADV_RULE_APPEARANCE:
+                required = APP_ADV_HAS_APPEARANCE;
+                break;
+            case APP_ADV_RULE_TX_POWER_MIN:
+                required = APP_ADV_HAS_TX_POWER;
+                break;
+            default:
+                return WICED_BT_BADARG;
+        }
+
+        if ((0 == i) || (p_rule->group != p_rules[i - 1u].group))
+        {
+            /* A group may not be split over the table */
+            for (j = 0; j < i; j++)
+            {
+                if (p_rules[j].group == p_rule->group)
+                {
+                    return WICED_BT_BADARG;
+                }
+            }
+            p_group = &p_matcher->groups[p_matcher->group_count++];
+            p_group->first = i;
+        }
+        p_group->required |= required;
+        p_group->count++;
+    }
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_adv_match
+********************************************************************************
+* Summary:
+*  Evaluates the prepared rules against one parsed report.
+*
+* Parameters:
+*  const app_adv_matcher_t *p_matcher : Prepared rules
+*  const app_adv_info_t *p_info       : Report parsed by app_adv_parse()
+*
+* Return:
+*  wiced_bool_t: WICED_TRUE if any group of rules matches
+*
+*******************************************************************************/
+wiced_bool_t app_adv_match(const app_adv_matcher_t *p_matcher, const app_adv_info_t *p_info)
+{
+    uint8_t g;
+
+    for (g = 0; g < p_matcher->group_count; g++)
+    {
+        const app_adv_group_t *p_group = &p_matcher->groups[g];
+        wiced_bool_t match = WICED_TRUE;
+        uint8_t i;
+
+        if ((p_info->present & p_group->required) != p_group->required)
+        {
+            continue;
+        }
+
+        for (i = p_group->first; match && (i < (p_group->first + p_group->count)); i++)
+        {
+            const app_adv_test_t *p_test = &p_matcher->tests[i];
+
+            switch (p_test->type)
+            {
+                case APP_ADV_RULE_NAME:
+                    match = (p_info->name_len == p_test->len) &&
+                            (0 == memcmp(p_info->p_name, p_test->p_data, p_test->len));
+                    break;
+                case APP_ADV_RULE_NAME_PREFIX:
+                    match = (p_info->name_len >= p_test->len) &&
+                            (0 == memcmp(p_info->p_name, p_test->p_data, p_test->len));
+                    break;
+                case APP_ADV_RULE_UUID16:
+                    match = app_adv_has_uuid16(p_info->p_uuid16, p_info->uuid16_count,
+                                               p_test->value);
+                    break;
+                case APP_ADV_RULE_SOLICIT16:
+                    match = app_adv_has_uuid16(p_info->p_solicit16, p_info->solicit16_count,
+                                               p_test->value);
+                    break;
+                case APP_ADV_RULE_UUID128:
+                {
+                    uint8_t k;
+
+                    match = WICED_FALSE;
+                    for (k = 0; !match && (k < p_info->uuid128_count); k++)
+                    {
+                        match = (0 == memcmp(&p_info->p_uuid128[k * APP_ADV_UUID128_LEN],
+                                             p_test->p_data, APP_ADV_UUID128_LEN));
+                    }
+                    break;
+                }
+                case APP_ADV_RULE_APPEARANCE:
+                    match = (p_info->appearance == p_test->value);
+                    break;
+                case APP_ADV_RULE_TX_POWER_MIN:
+                    match = (p_info->tx_power >= (int8_t)p_test->value);
+                    break;
+                default:
+                    match = WICED_FALSE;
+                    break;
+            }
+        }
+        if (match)
+        {
+            return WICED_TRUE;
+        }
+    }
+    return WICED_FALSE;
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+* File Name: app_adv.h
+*
+* Description: Single-pass advertising data parser and the rule matcher that
+*              decides whether an advertiser is a peer.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_ADV_H__
+#define __APP_ADV_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Longest legacy advertising or scan response payload */
+#define APP_ADV_DATA_MAX_LEN            (31u)
+
+/* Rules a matcher can hold */
+#ifndef APP_ADV_MAX_RULES
+#define APP_ADV_MAX_RULES               (8u)
+#endif
+
+#define APP_ADV_UUID128_LEN             (16u)
+
+/* Fields found by app_adv_parse() */
+#define APP_ADV_HAS_FLAGS               (0x01u)
+#define APP_ADV_HAS_NAME                (0x02u)     /* Complete local name */
+#define APP_ADV_HAS_NAME_SHORT          (0x04u)     /* Shortened local name */
+#define APP_ADV_HAS_UUID16              (0x08u)     /* 16-bit service UUIDs */
+#define APP_ADV_HAS_SOLICIT16           (0x10u)     /* 16-bit solicited service UUIDs */
+#define APP_ADV_HAS_UUID128             (0x20u)     /* 128-bit service UUIDs */
+#define APP_ADV_HAS_APPEARANCE          (0x40u)
+#define APP_ADV_HAS_TX_POWER            (0x80u)
+
+/* AD types the stack headers do not name */
+#define APP_ADV_TYPE_16SOLICIT          (0x14u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Everything the matcher looks at, from one walk over the AD structures.
+ * Names and UUID lists point into the advertising data. */
+typedef struct
+{
+    uint8_t        present;             /* APP_ADV_HAS_* */
+    uint8_t        flags;
+    int8_t         tx_power;            /* dBm */
+    uint16_t       appearance;
+    const uint8_t *p_name;              /* Complete name, else shortened name */
+    uint8_t        name_len;
+    uint8_t        uuid16_count;
+    uint8_t        solicit16_count;
+    uint8_t        uuid128_count;
+    const uint8_t *p_uuid16;            /* Little endian, 2 bytes each */
+    const uint8_t *p_solicit16;
+    const uint8_t *p_uuid128;           /* Little endian, 16 bytes each */
+} app_adv_info_t;
+
+typedef enum
+{
+    APP_ADV_RULE_NAME,                  /* Complete name equals p_data (C string) */
+    APP_ADV_RULE_NAME_PREFIX,           /* Complete or shortened name starts with p_data */
+    APP_ADV_RULE_UUID16,                /* value is among the 16-bit service UUIDs */
+    APP_ADV_RULE_SOLICIT16,             /* value is among the solicited 16-bit UUIDs */
+    APP_ADV_RULE_UUID128,               /* p_data (16 bytes, little endian) is listed */
+    APP_ADV_RULE_APPEARANCE,            /* Appearance equals value */
+    APP_ADV_RULE_TX_POWER_MIN,          /* TX power is at least (int8_t)value dBm */
+} app_adv_rule_type_t;
+
+/* All rules of a group must match, and a report matches when any group does.
+ * The rules of a group must be next to each other in the table. */
+typedef struct
+{
+    uint8_t             group;
+    app_adv_rule_type_t type;
+    uint16_t            value;
+    const void         *p_data;
+} app_adv_rule_t;
+
+/* A rule table prepared by app_adv_matcher_init() */
+typedef struct
+{
+    uint8_t        type;                /* app_adv_rule_type_t */
+    uint8_t        len;                 /* Length of p_data */
+    uint16_t       value;
+    const uint8_t *p_data;
+} app_adv_test_t;
+
+typedef struct
+{
+    uint8_t required;                   /* APP_ADV_HAS_* bits every rule needs */
+    uint8_t first;                      /* First test of the group */
+    uint8_t count;
+} app_adv_group_t;
+
+typedef struct
+{
+    app_adv_test_t  tests[APP_ADV_MAX_RULES];
+    app_adv_group_t groups[APP_ADV_MAX_RULES];
+    uint8_t         group_count;
+} app_adv_matcher_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_bool_t app_adv_parse(const uint8_t *p_adv, uint16_t max_len, app_adv_info_t *p_info);
+
+wiced_result_t app_adv_matcher_init(app_adv_matcher_t *p_matcher, const app_adv_rule_t *p_rules,
+                                    uint8_t rule_count);
+
+wiced_bool_t app_adv_match(const app_adv_matcher_t *p_matcher, const app_adv_info_t *p_info);
+
+#endif      /*__APP_ADV_H__ */
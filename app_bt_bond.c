@@ -0,0 +1,496 @@
+/******************************************************************************
+* File Name: app_bt_bond.c
+*
+* Description: Bonding: keeps the keys of bonded peers and their Current Time
+*              CCCD in RAM and writes them through to a pluggable key store.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_bond.h"
+#include <FreeRTOS.h>
+#include <semphr.h>
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Marks a slot that holds a record of this layout; anything else is ignored */
+#define APP_BT_BOND_MAGIC               (0x424E4431u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t                    magic;
+    uint32_t                    sequence;   /* Higher for more recently bonded peers */
+    wiced_bt_device_link_keys_t link_keys;  /* Peer address and keys, opaque to the application */
+    uint8_t                     addr_type;
+    uint8_t                     cccd[APP_BT_CONN_CCCD_LEN];
+} app_bt_bond_record_t;
+
+typedef struct
+{
+    uint32_t                       magic;
+    wiced_bt_local_identity_keys_t keys;
+} app_bt_bond_identity_t;
+
+/* Both records must fit in a key store slot */
+typedef char app_bt_bond_record_fits[(sizeof(app_bt_bond_record_t) <=
+                                      APP_BT_BOND_SLOT_SIZE) ? 1 : -1];
+typedef char app_bt_bond_identity_fits[(sizeof(app_bt_bond_identity_t) <=
+                                        APP_BT_BOND_SLOT_SIZE) ? 1 : -1];
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+/* Copy of the device slots, so that lookups never touch the store. The stack
+ * thread asks for and hands over keys while the GATT task keeps the CCCDs:
+ * both hold the mutex over the records and the store. The GATT task never
+ * calls into the stack while it holds it, so it cannot deadlock against the
+ * stack's lock. */
+static SemaphoreHandle_t          app_bt_bond_mutex;
+static app_bt_bond_record_t       app_bt_bond_records[APP_BT_BOND_MAX_DEVICES];
+static const app_bt_bond_store_t *app_bt_bond_store;
+static uint32_t                   app_bt_bond_sequence;
+static app_bt_bond_stats_t        app_bt_bond_stats;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+static void app_bt_bond_lock(void)
+{
+    if (NULL != app_bt_bond_mutex)
+    {
+        xSemaphoreTake(app_bt_bond_mutex, portMAX_DELAY);
+    }
+}
+
+static void app_bt_bond_unlock(void)
+{
+    if (NULL != app_bt_bond_mutex)
+    {
+        xSemaphoreGive(app_bt_bond_mutex);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_find
+********************************************************************************
+* Summary:
+*  Returns the bond of a peer, or NULL if the peer is not bonded.
+*
+*******************************************************************************/
+static app_bt_bond_record_t *app_bt_bond_find(wiced_bt_device_address_t bd_addr)
+{
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_BOND_MAX_DEVICES; i++)
+    {
+        if ((APP_BT_BOND_MAGIC == app_bt_bond_records[i].magic) &&
+            (0 == memcmp(app_bt_bond_records[i].link_keys.bd_addr, bd_addr, BD_ADDR_LEN)))
+        {
+            return &app_bt_bond_records[i];
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_write
+********************************************************************************
+* Summary:
+*  Writes a bond back to its slot in the key store.
+*
+*******************************************************************************/
+static wiced_result_t app_bt_bond_write(app_bt_bond_record_t *p_record)
+{
+    uint8_t slot = (uint8_t)(APP_BT_BOND_SLOT_FIRST_DEVICE + (p_record - app_bt_bond_records));
+    wiced_result_t result;
+
+    if (NULL == app_bt_bond_store)
+    {
+        return WICED_BT_ERROR;
+    }
+    app_bt_bond_stats.store_writes++;
+    result = app_bt_bond_store->write(slot, p_record, sizeof(*p_record));
+    if (WICED_BT_SUCCESS != result)
+    {
+        app_bt_bond_stats.store_errors++;
+    }
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_init
+********************************************************************************
+* Summary:
+*  Opens the key store and loads the bonds kept in it. Call before the stack
+*  is initialized: it asks for the local identity keys first. If the store
+*  cannot be opened, bonds are only kept until the next reset.
+*
+* Parameters:
+*  const app_bt_bond_store_t *p_store: Key store to use
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, WICED_BT_NO_RESOURCES if the mutex
+*                  cannot be created, or the error of the key store
+*
+*******************************************************************************/
+wiced_result_t app_bt_bond_init(const app_bt_bond_store_t *p_store)
+{
+    app_bt_bond_record_t *p_record;
+    wiced_result_t result;
+    uint32_t i;
+
+    if ((NULL == app_bt_bond_mutex) && (NULL == (app_bt_bond_mutex = xSemaphoreCreateMutex())))
+    {
+        return WICED_BT_NO_RESOURCES;
+    }
+    app_bt_bond_store = NULL;
+    app_bt_bond_sequence = 0;
+    memset(app_bt_bond_records, 0, sizeof(app_bt_bond_records));
+    memset(&app_bt_bond_stats, 0, sizeof(app_bt_bond_stats));
+
+    result = p_store->init();
+    if (WICED_BT_SUCCESS != result)
+    {
+        return result;
+    }
+    app_bt_bond_store = p_store;
+
+    for (i = 0; i < APP_BT_BOND_MAX_DEVICES; i++)
+    {
+        p_record = &app_bt_bond_records[i];
+        if ((WICED_BT_SUCCESS != p_store->read((uint8_t)(APP_BT_BOND_SLOT_FIRST_DEVICE + i),
+                                               p_record, sizeof(*p_record))) ||
+            (APP_BT_BOND_MAGIC != p_record->magic))
+        {
+            memset(p_record, 0, sizeof(*p_record));
+            continue;
+        }
+
+        app_bt_bond_stats.bonds++;
+        if (p_record->sequence > app_bt_bond_sequence)
+        {
+            app_bt_bond_sequence = p_record->sequence;
+        }
+    }
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_load_resolving_list
+********************************************************************************
+* Summary:
+*  Adds the bonded peers to the address resolution list, so that they are
+*  recognized behind a resolvable private address. Call once the stack is
+*  enabled.
+*
+*******************************************************************************/
+void app_bt_bond_load_resolving_list(void)
+{
+    uint32_t i;
+
+    app_bt_bond_lock();
+    for (i = 0; i < APP_BT_BOND_MAX_DEVICES; i++)
+    {
+        if (APP_BT_BOND_MAGIC == app_bt_bond_records[i].magic)
+        {
+            wiced_bt_dev_add_device_to_address_resolution_db(&app_bt_bond_records[i].link_keys);
+        }
+    }
+    app_bt_bond_unlock();
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_save_keys
+********************************************************************************
+* Summary:
+*  Stores the link keys of a peer after pairing. A peer bonded again keeps
+*  its address type and CCCD; a new peer takes a free slot or, when all are
+*  in use, the slot of the least recently bonded peer, and gets them from
+*  app_bt_bond_set_peer().
+*
+* Parameters:
+*  wiced_bt_device_link_keys_t *p_keys: Peer address and keys from the stack
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, or the error of the key store
+*
+*******************************************************************************/
+wiced_result_t app_bt_bond_save_keys(wiced_bt_device_link_keys_t *p_keys)
+{
+    app_bt_bond_record_t *p_record;
+    wiced_result_t result;
+    uint32_t i;
+
+    app_bt_bond_lock();
+    if (NULL == (p_record = app_bt_bond_find(p_keys->bd_addr)))
+    {
+        /* A free slot, or else the oldest bond */
+        p_record = &app_bt_bond_records[0];
+        for (i = 0; i < APP_BT_BOND_MAX_DEVICES; i++)
+        {
+            if (APP_BT_BOND_MAGIC != app_bt_bond_records[i].magic)
+            {
+                p_record = &app_bt_bond_records[i];
+                break;
+            }
+            if (app_bt_bond_records[i].sequence < p_record->sequence)
+            {
+                p_record = &app_bt_bond_records[i];
+            }
+        }
+        if (APP_BT_BOND_MAGIC == p_record->magic)
+        {
+            app_bt_bond_stats.replaced++;
+        }
+        else
+        {
+            app_bt_bond_stats.bonds++;
+        }
+        memset(p_record, 0, sizeof(*p_record));
+        p_record->magic = APP_BT_BOND_MAGIC;
+    }
+
+    p_record->sequence  = ++app_bt_bond_sequence;
+    p_record->link_keys = *p_keys;
+    app_bt_bond_stats.saved++;
+
+    result = app_bt_bond_write(p_record);
+    app_bt_bond_unlock();
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_load_keys
+********************************************************************************
+* Summary:
+*  Fills in the link keys of a bonded peer when the stack asks for them.
+*
+* Parameters:
+*  wiced_bt_device_link_keys_t *p_keys: Holds the peer address on entry and
+*                                       receives its keys
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, or WICED_BT_ERROR if the peer is not
+*                  bonded, which makes the stack pair with it
+*
+*******************************************************************************/
+wiced_result_t app_bt_bond_load_keys(wiced_bt_device_link_keys_t *p_keys)
+{
+    app_bt_bond_record_t *p_record;
+    wiced_result_t result = WICED_BT_SUCCESS;
+
+    app_bt_bond_lock();
+    app_bt_bond_stats.key_requests++;
+    if (NULL == (p_record = app_bt_bond_find(p_keys->bd_addr)))
+    {
+        app_bt_bond_stats.key_misses++;
+        result = WICED_BT_ERROR;
+    }
+    else
+    {
+        *p_keys = p_record->link_keys;
+    }
+    app_bt_bond_unlock();
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_save_identity
+********************************************************************************
+* Summary:
+*  Stores the local identity keys generated by the stack, so that the device
+*  keeps its identity, and with it its bonds, over a reset.
+*
+* Parameters:
+*  wiced_bt_local_identity_keys_t *p_keys: Keys from the stack
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, or the error of the key store
+*
+*******************************************************************************/
+wiced_result_t app_bt_bond_save_identity(wiced_bt_local_identity_keys_t *p_keys)
+{
+    app_bt_bond_identity_t identity;
+    wiced_result_t result;
+
+    if (NULL == app_bt_bond_store)
+    {
+        return WICED_BT_ERROR;
+    }
+    memset(&identity, 0, sizeof(identity));
+    identity.magic = APP_BT_BOND_MAGIC;
+    identity.keys  = *p_keys;
+
+    app_bt_bond_lock();
+    app_bt_bond_stats.store_writes++;
+    result = app_bt_bond_store->write(APP_BT_BOND_SLOT_IDENTITY, &identity, sizeof(identity));
+    if (WICED_BT_SUCCESS != result)
+    {
+        app_bt_bond_stats.store_errors++;
+    }
+    app_bt_bond_unlock();
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_load_identity
+********************************************************************************
+* Summary:
+*  Reads the local identity keys back from the key store.
+*
+* Parameters:
+*  wiced_bt_local_identity_keys_t *p_keys: Receives the keys
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, or WICED_BT_ERROR if none were stored,
+*                  which makes the stack generate new ones
+*
+*******************************************************************************/
+wiced_result_t app_bt_bond_load_identity(wiced_bt_local_identity_keys_t *p_keys)
+{
+    app_bt_bond_identity_t identity;
+    wiced_result_t result = WICED_BT_ERROR;
+
+    app_bt_bond_lock();
+    if ((NULL != app_bt_bond_store) &&
+        (WICED_BT_SUCCESS == app_bt_bond_store->read(APP_BT_BOND_SLOT_IDENTITY, &identity,
+                                                     sizeof(identity))) &&
+        (APP_BT_BOND_MAGIC == identity.magic))
+    {
+        *p_keys = identity.keys;
+        result = WICED_BT_SUCCESS;
+    }
+    app_bt_bond_unlock();
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_is_bonded
+********************************************************************************
+* Summary:
+*  Tells whether link keys are kept for a peer.
+*
+*******************************************************************************/
+wiced_bool_t app_bt_bond_is_bonded(wiced_bt_device_address_t bd_addr)
+{
+    wiced_bool_t bonded;
+
+    app_bt_bond_lock();
+    bonded = (NULL != app_bt_bond_find(bd_addr)) ? WICED_TRUE : WICED_FALSE;
+    app_bt_bond_unlock();
+    return bonded;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_get_cccd
+********************************************************************************
+* Summary:
+*  Returns the CCCD a bonded peer had written, to restore it once the link to
+*  the peer is encrypted.
+*
+* Parameters:
+*  wiced_bt_device_address_t bd_addr : Address of the peer
+*  uint8_t *p_cccd                   : Receives APP_BT_CONN_CCCD_LEN bytes
+*
+* Return:
+*  wiced_bool_t: WICED_TRUE if the peer is bonded
+*
+*******************************************************************************/
+wiced_bool_t app_bt_bond_get_cccd(wiced_bt_device_address_t bd_addr, uint8_t *p_cccd)
+{
+    app_bt_bond_record_t *p_record;
+
+    app_bt_bond_lock();
+    if (NULL != (p_record = app_bt_bond_find(bd_addr)))
+    {
+        memcpy(p_cccd, p_record->cccd, APP_BT_CONN_CCCD_LEN);
+        app_bt_bond_stats.restored++;
+    }
+    app_bt_bond_unlock();
+    return (NULL != p_record) ? WICED_TRUE : WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_set_peer
+********************************************************************************
+* Summary:
+*  Keeps the address type and the CCCD of a connected bonded peer. The key
+*  store is written only when they change, so clients that rewrite the same
+*  CCCD on every connection do not wear the flash.
+*
+* Parameters:
+*  const app_bt_conn_t *p_conn: Connection to the peer
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_bond_set_peer(const app_bt_conn_t *p_conn)
+{
+    app_bt_bond_record_t *p_record;
+
+    app_bt_bond_lock();
+    p_record = app_bt_bond_find((uint8_t *)p_conn->bd_addr);
+    if ((NULL != p_record) &&
+        ((p_record->addr_type != (uint8_t)p_conn->addr_type) ||
+         (0 != memcmp(p_record->cccd, p_conn->cccd, APP_BT_CONN_CCCD_LEN))))
+    {
+        p_record->addr_type = (uint8_t)p_conn->addr_type;
+        memcpy(p_record->cccd, p_conn->cccd, APP_BT_CONN_CCCD_LEN);
+        app_bt_bond_write(p_record);
+    }
+    app_bt_bond_unlock();
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_get_stats
+********************************************************************************
+* Summary:
+*  Copies the bonding statistics.
+*
+*******************************************************************************/
+void app_bt_bond_get_stats(app_bt_bond_stats_t *p_stats)
+{
+    *p_stats = app_bt_bond_stats;
+}
@@ -0,0 +1,122 @@
+/******************************************************************************
+* File Name: app_bt_bond.h
+*
+* Description: Bonding: link keys, local identity keys and the Current Time
+*              CCCD of bonded peers, kept in a pluggable key store so that a
+*              returning client is encrypted and notified without pairing or
+*              subscribing again.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_BOND_H__
+#define __APP_BT_BOND_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+#include "app_bt_conn.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Number of peers whose keys are kept. The least recently bonded peer makes
+ * room for a new one. */
+#ifndef APP_BT_BOND_MAX_DEVICES
+#define APP_BT_BOND_MAX_DEVICES         (8u)
+#endif
+
+/* Key store slots: the local identity keys, then one slot per bonded peer */
+#define APP_BT_BOND_SLOT_IDENTITY       (0u)
+#define APP_BT_BOND_SLOT_FIRST_DEVICE   (1u)
+#define APP_BT_BOND_SLOT_COUNT          (APP_BT_BOND_SLOT_FIRST_DEVICE + APP_BT_BOND_MAX_DEVICES)
+
+/* Largest record a key store has to hold in one slot */
+#define APP_BT_BOND_SLOT_SIZE           (256u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Where bonds are kept. Each slot holds one record of up to
+ * APP_BT_BOND_SLOT_SIZE bytes; read fails for a slot never written or erased.
+ * Writes only happen when a bond or a bonded peer's CCCD changes. */
+typedef struct
+{
+    wiced_result_t (*init)(void);
+    wiced_result_t (*read)(uint8_t slot, void *p_data, uint32_t len);
+    wiced_result_t (*write)(uint8_t slot, const void *p_data, uint32_t len);
+    wiced_result_t (*erase)(uint8_t slot);
+} app_bt_bond_store_t;
+
+typedef struct
+{
+    uint32_t bonds;             /* Peers currently bonded */
+    uint32_t saved;             /* Link keys stored after pairing */
+    uint32_t key_requests;      /* Link keys asked for by the stack */
+    uint32_t key_misses;        /* ... for a peer without a bond */
+    uint32_t restored;          /* CCCDs restored once a link was encrypted */
+    uint32_t replaced;          /* Bonds dropped to make room for a new one */
+    uint32_t store_writes;
+    uint32_t store_errors;
+} app_bt_bond_stats_t;
+
+/* The key store of this build: flash on the target, a file on the host */
+extern const app_bt_bond_store_t app_bt_bond_default_store;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_result_t app_bt_bond_init(const app_bt_bond_store_t *p_store);
+
+void app_bt_bond_load_resolving_list(void);
+
+wiced_result_t app_bt_bond_save_keys(wiced_bt_device_link_keys_t *p_keys);
+
+wiced_result_t app_bt_bond_load_keys(wiced_bt_device_link_keys_t *p_keys);
+
+wiced_result_t app_bt_bond_save_identity(wiced_bt_local_identity_keys_t *p_keys);
+
+wiced_result_t app_bt_bond_load_identity(wiced_bt_local_identity_keys_t *p_keys);
+
+wiced_bool_t app_bt_bond_is_bonded(wiced_bt_device_address_t bd_addr);
+
+wiced_bool_t app_bt_bond_get_cccd(wiced_bt_device_address_t bd_addr, uint8_t *p_cccd);
+
+void app_bt_bond_set_peer(const app_bt_conn_t *p_conn);
+
+void app_bt_bond_get_stats(app_bt_bond_stats_t *p_stats);
+
+#endif      /*__APP_BT_BOND_H__ */
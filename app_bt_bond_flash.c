@@ -0,0 +1,210 @@
+/******************************************************************************
+* File Name: app_bt_bond_flash.c
+*
+* Description: Key store of the bonding module on the target: one key-value
+*              store record per slot, in the last sectors of the external
+*              serial flash.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_bond.h"
+#include "cybsp.h"
+#include "cyhal.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycfg_qspi_memslot.h"
+#include "mtb_kvstore.h"
+#include <stdio.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* The key-value store takes this many erase sectors at the top of the
+ * external flash, away from the application image */
+#ifndef APP_BT_BOND_FLASH_SECTORS
+#define APP_BT_BOND_FLASH_SECTORS       (2u)
+#endif
+
+#define APP_BT_BOND_FLASH_QSPI_FREQ_HZ  (50000000u)
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static mtb_kvstore_t    app_bt_bond_kvstore;
+static mtb_kvstore_bd_t app_bt_bond_block_device;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/* Block device of the key-value store on the serial flash */
+static cy_rslt_t app_bt_bond_bd_read(void *context, uint32_t addr, uint32_t length,
+                                     uint8_t *buf)
+{
+    (void)context;
+    return cy_serial_flash_qspi_read(addr, length, buf);
+}
+
+static cy_rslt_t app_bt_bond_bd_program(void *context, uint32_t addr, uint32_t length,
+                                        const uint8_t *buf)
+{
+    (void)context;
+    return cy_serial_flash_qspi_write(addr, length, buf);
+}
+
+static cy_rslt_t app_bt_bond_bd_erase(void *context, uint32_t addr, uint32_t length)
+{
+    (void)context;
+    return cy_serial_flash_qspi_erase(addr, length);
+}
+
+static uint32_t app_bt_bond_bd_read_size(void *context, uint32_t addr)
+{
+    (void)context;
+    (void)addr;
+    return 1u;
+}
+
+static uint32_t app_bt_bond_bd_program_size(void *context, uint32_t addr)
+{
+    (void)context;
+    return (uint32_t)cy_serial_flash_qspi_get_prog_size(addr);
+}
+
+static uint32_t app_bt_bond_bd_erase_size(void *context, uint32_t addr)
+{
+    (void)context;
+    return (uint32_t)cy_serial_flash_qspi_get_erase_size(addr);
+}
+
+/* One key per slot: "bond00" holds the local identity keys */
+static void app_bt_bond_flash_key(uint8_t slot, char *p_key)
+{
+    p_key[0] = 'b';
+    p_key[1] = 'o';
+    p_key[2] = 'n';
+    p_key[3] = 'd';
+    p_key[4] = (char)('0' + (slot / 10u));
+    p_key[5] = (char)('0' + (slot % 10u));
+    p_key[6] = '\0';
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_flash_init
+********************************************************************************
+* Summary:
+*  Opens the serial flash, keeping execute-in-place running, and mounts the
+*  key-value store in its last sectors.
+*
+*******************************************************************************/
+static wiced_result_t app_bt_bond_flash_init(void)
+{
+    uint32_t sector_size;
+    uint32_t length;
+    cy_rslt_t result;
+
+    result = cy_serial_flash_qspi_init(smifMemConfigs[0], CYBSP_QSPI_D0, CYBSP_QSPI_D1,
+                                       CYBSP_QSPI_D2, CYBSP_QSPI_D3, NC, NC, NC, NC,
+                                       CYBSP_QSPI_SCK, CYBSP_QSPI_SS,
+                                       APP_BT_BOND_FLASH_QSPI_FREQ_HZ);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("Bond store: serial flash init failed: 0x%lx\n", (unsigned long)result);
+        return WICED_BT_ERROR;
+    }
+    cy_serial_flash_qspi_enable_xip(true);
+
+    app_bt_bond_block_device.read         = app_bt_bond_bd_read;
+    app_bt_bond_block_device.program      = app_bt_bond_bd_program;
+    app_bt_bond_block_device.erase        = app_bt_bond_bd_erase;
+    app_bt_bond_block_device.read_size    = app_bt_bond_bd_read_size;
+    app_bt_bond_block_device.program_size = app_bt_bond_bd_program_size;
+    app_bt_bond_block_device.erase_size   = app_bt_bond_bd_erase_size;
+    app_bt_bond_block_device.context      = NULL;
+
+    sector_size = (uint32_t)cy_serial_flash_qspi_get_erase_size(0);
+    length = sector_size * APP_BT_BOND_FLASH_SECTORS;
+    result = mtb_kvstore_init(&app_bt_bond_kvstore,
+                              (uint32_t)cy_serial_flash_qspi_get_size() - length, length,
+                              &app_bt_bond_block_device);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("Bond store: kvstore init failed: 0x%lx\n", (unsigned long)result);
+        return WICED_BT_ERROR;
+    }
+    return WICED_BT_SUCCESS;
+}
+
+static wiced_result_t app_bt_bond_flash_read(uint8_t slot, void *p_data, uint32_t len)
+{
+    char key[7];
+    uint32_t size = len;
+
+    app_bt_bond_flash_key(slot, key);
+    if ((CY_RSLT_SUCCESS != mtb_kvstore_read(&app_bt_bond_kvstore, key, p_data, &size)) ||
+        (size != len))
+    {
+        return WICED_BT_ERROR;
+    }
+    return WICED_BT_SUCCESS;
+}
+
+static wiced_result_t app_bt_bond_flash_write(uint8_t slot, const void *p_data, uint32_t len)
+{
+    char key[7];
+
+    app_bt_bond_flash_key(slot, key);
+    return (CY_RSLT_SUCCESS == mtb_kvstore_write(&app_bt_bond_kvstore, key, p_data, len)) ?
+           WICED_BT_SUCCESS : WICED_BT_ERROR;
+}
+
+static wiced_result_t app_bt_bond_flash_erase(uint8_t slot)
+{
+    char key[7];
+
+    app_bt_bond_flash_key(slot, key);
+    mtb_kvstore_delete(&app_bt_bond_kvstore, key);
+    return WICED_BT_SUCCESS;
+}
+
+const app_bt_bond_store_t app_bt_bond_default_store =
+{
+    .init  = app_bt_bond_flash_init,
+    .read  = app_bt_bond_flash_read,
+    .write = app_bt_bond_flash_write,
+    .erase = app_bt_bond_flash_erase,
+};
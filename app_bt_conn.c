@@ -0,0 +1,288 @@
+/******************************************************************************
+* File Name: app_bt_conn.c
+*
+* Description: Connection table of the CTS server. Tracks the CCCD, MTU and
+*              peer address of every connected client so that notifications
+*              can be sent to all subscribed clients.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_conn.h"
+#include <string.h>
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+/* Only used from the GATT task, which the stack hands its connection events
+ * over to, so no locking is needed */
+static app_bt_conn_t app_bt_conn_table[APP_BT_CONN_MAX_CONNECTIONS];
+static uint16_t      app_bt_conn_used;
+static uint16_t      app_bt_conn_subscribed;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+static wiced_bool_t app_bt_conn_is_subscribed(const app_bt_conn_t *p_conn)
+{
+    return (p_conn->cccd[0] & (GATT_CLIENT_CONFIG_NOTIFICATION | GATT_CLIENT_CONFIG_INDICATION)) ?
+           WICED_TRUE : WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_init
+********************************************************************************
+* Summary:
+*  Marks every entry of the connection table as free.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_conn_init(void)
+{
+    memset(app_bt_conn_table, 0, sizeof(app_bt_conn_table));
+    app_bt_conn_used = 0;
+    app_bt_conn_subscribed = 0;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_add
+********************************************************************************
+* Summary:
+*  Takes a free entry for a new connection. The MTU and LL payload start at
+*  their defaults and notifications start disabled.
+*
+* Parameters:
+*  uint16_t conn_id                      : Connection ID
+*  wiced_bt_device_address_t bd_addr     : Peer address
+*  wiced_bt_ble_address_type_t addr_type : Peer address type
+*
+* Return:
+*  app_bt_conn_t *: The new entry, or NULL if the table is full
+*
+*******************************************************************************/
+app_bt_conn_t *app_bt_conn_add(uint16_t conn_id, wiced_bt_device_address_t bd_addr,
+                               wiced_bt_ble_address_type_t addr_type)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find(0);
+
+    if (NULL != p_conn)
+    {
+        p_conn->conn_id   = conn_id;
+        p_conn->mtu       = GATT_DEF_BLE_MTU_SIZE;
+        p_conn->tx_octets = APP_BT_CONN_DEF_TX_OCTETS;
+        p_conn->cccd[0]   = 0;
+        p_conn->cccd[1]   = 0;
+        p_conn->addr_type = addr_type;
+        memcpy(p_conn->bd_addr, bd_addr, BD_ADDR_LEN);
+        app_bt_conn_used++;
+    }
+    return p_conn;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_remove
+********************************************************************************
+* Summary:
+*  Frees the entry of a connection that went down.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_conn_remove(uint16_t conn_id)
+{
+    app_bt_conn_t *p_conn;
+
+    if ((0 == conn_id) || (NULL == (p_conn = app_bt_conn_find(conn_id))))
+    {
+        return;
+    }
+    if (app_bt_conn_is_subscribed(p_conn))
+    {
+        app_bt_conn_subscribed--;
+    }
+    memset(p_conn, 0, sizeof(*p_conn));
+    app_bt_conn_used--;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_find
+********************************************************************************
+* Summary:
+*  Looks up the entry of a connection. Passing 0 returns a free entry.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*
+* Return:
+*  app_bt_conn_t *: Matching entry, or NULL
+*
+*******************************************************************************/
+app_bt_conn_t *app_bt_conn_find(uint16_t conn_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        if (app_bt_conn_table[i].conn_id == conn_id)
+        {
+            return &app_bt_conn_table[i];
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_find_by_addr
+********************************************************************************
+* Summary:
+*  Looks up the entry of a connected peer by its address.
+*
+* Parameters:
+*  wiced_bt_device_address_t bd_addr: Peer address
+*
+* Return:
+*  app_bt_conn_t *: Matching entry, or NULL if the peer is not connected
+*
+*******************************************************************************/
+app_bt_conn_t *app_bt_conn_find_by_addr(wiced_bt_device_address_t bd_addr)
+{
+    app_bt_conn_t *p_conn = NULL;
+
+    while (NULL != (p_conn = app_bt_conn_next(p_conn)))
+    {
+        if (0 == memcmp(p_conn->bd_addr, bd_addr, BD_ADDR_LEN))
+        {
+            break;
+        }
+    }
+    return p_conn;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_next
+********************************************************************************
+* Summary:
+*  Iterates over the connections in use.
+*
+* Parameters:
+*  app_bt_conn_t *p_conn: Previous entry, or NULL to start from the first one
+*
+* Return:
+*  app_bt_conn_t *: Next entry in use, or NULL at the end of the table
+*
+*******************************************************************************/
+app_bt_conn_t *app_bt_conn_next(app_bt_conn_t *p_conn)
+{
+    app_bt_conn_t *p_end = &app_bt_conn_table[APP_BT_CONN_MAX_CONNECTIONS];
+
+    p_conn = (NULL == p_conn) ? app_bt_conn_table : (p_conn + 1);
+    for (; p_conn < p_end; p_conn++)
+    {
+        if (0 != p_conn->conn_id)
+        {
+            return p_conn;
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_set_cccd
+********************************************************************************
+* Summary:
+*  Stores the Current Time CCCD written by a client and keeps the number of
+*  subscribed clients up to date.
+*
+* Parameters:
+*  app_bt_conn_t *p_conn  : Connection entry
+*  const uint8_t *p_value : New CCCD value, APP_BT_CONN_CCCD_LEN bytes
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_conn_set_cccd(app_bt_conn_t *p_conn, const uint8_t *p_value)
+{
+    wiced_bool_t was_subscribed = app_bt_conn_is_subscribed(p_conn);
+
+    memcpy(p_conn->cccd, p_value, APP_BT_CONN_CCCD_LEN);
+    if (was_subscribed != app_bt_conn_is_subscribed(p_conn))
+    {
+        if (was_subscribed)
+        {
+            app_bt_conn_subscribed--;
+        }
+        else
+        {
+            app_bt_conn_subscribed++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_count
+********************************************************************************
+* Summary:
+*  Returns the number of connections in use.
+*
+*******************************************************************************/
+uint16_t app_bt_conn_count(void)
+{
+    return app_bt_conn_used;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_subscribed_count
+********************************************************************************
+* Summary:
+*  Returns the number of connections with Current Time notifications enabled.
+*
+*******************************************************************************/
+uint16_t app_bt_conn_subscribed_count(void)
+{
+    return app_bt_conn_subscribed;
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+* File Name: app_bt_conn.h
+*
+* Description: Connection table of the CTS server. Holds the CCCD, MTU and
+*              peer address of every connected client, keyed by connection
+*              ID.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_CONN_H__
+#define __APP_BT_CONN_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+#include "wiced_bt_gatt.h"
+#include "cycfg_bt_settings.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Number of clients served at the same time: the "Max client connections"
+ * of the Bluetooth Configurator (design.cybt), which the stack allows */
+#ifndef APP_BT_CONN_MAX_CONNECTIONS
+#define APP_BT_CONN_MAX_CONNECTIONS     (CY_BT_CLIENT_MAX_LINKS)
+#endif
+
+#define APP_BT_CONN_CCCD_LEN            (2u)
+
+/* LL payload of a link until a data length update: 27 bytes */
+#define APP_BT_CONN_DEF_TX_OCTETS       (27u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint16_t                    conn_id;    /* 0 when the entry is free */
+    uint16_t                    mtu;        /* ATT MTU agreed with the peer */
+    uint16_t                    tx_octets;  /* LL payload the controller sends to the peer */
+    uint8_t                     cccd[APP_BT_CONN_CCCD_LEN]; /* Current Time CCCD, little endian */
+    wiced_bt_ble_address_type_t addr_type;
+    wiced_bt_device_address_t   bd_addr;
+} app_bt_conn_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_conn_init(void);
+
+app_bt_conn_t *app_bt_conn_add(uint16_t conn_id, wiced_bt_device_address_t bd_addr,
+                               wiced_bt_ble_address_type_t addr_type);
+
+void app_bt_conn_remove(uint16_t conn_id);
+
+app_bt_conn_t *app_bt_conn_find(uint16_t conn_id);
+
+app_bt_conn_t *app_bt_conn_find_by_addr(wiced_bt_device_address_t bd_addr);
+
+app_bt_conn_t *app_bt_conn_next(app_bt_conn_t *p_conn);
+
+void app_bt_conn_set_cccd(app_bt_conn_t *p_conn, const uint8_t *p_value);
+
+uint16_t app_bt_conn_count(void);
+
+uint16_t app_bt_conn_subscribed_count(void);
+
+#endif      /*__APP_BT_CONN_H__ */
@@ -0,0 +1,508 @@
+/******************************************************************************
+* File Name: app_bt_conn_param.c
+*
+* Description: Connection parameter policy: short intervals while a client is
+*              discovering or sending requests, long intervals with slave
+*              latency while it only receives notifications, and the
+*              parameters granted for each connection.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_conn_param.h"
+#include "app_bt_gatt_task.h"
+#include "wiced_bt_l2c.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include "timers.h"
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint16_t min_interval;
+    uint16_t max_interval;
+    uint16_t latency;
+    uint16_t timeout;
+} app_bt_conn_param_set_t;
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+/* Indexed by app_bt_conn_param_profile_t */
+static const app_bt_conn_param_set_t app_bt_conn_param_sets[] =
+{
+    { APP_BT_CONN_PARAM_FAST_MIN_INTERVAL, APP_BT_CONN_PARAM_FAST_MAX_INTERVAL,
+      APP_BT_CONN_PARAM_FAST_LATENCY,      APP_BT_CONN_PARAM_FAST_TIMEOUT },
+    { APP_BT_CONN_PARAM_IDLE_MIN_INTERVAL, APP_BT_CONN_PARAM_IDLE_MAX_INTERVAL,
+      APP_BT_CONN_PARAM_IDLE_LATENCY,      APP_BT_CONN_PARAM_IDLE_TIMEOUT },
+};
+
+/* The supervision timeout must outlast the events the client may skip */
+typedef char app_bt_conn_param_idle_timeout_ok[((APP_BT_CONN_PARAM_IDLE_TIMEOUT * 8u) >
+                                                ((1u + APP_BT_CONN_PARAM_IDLE_LATENCY) *
+                                                 APP_BT_CONN_PARAM_IDLE_MAX_INTERVAL * 2u)) ?
+                                               1 : -1];
+
+/* Only used from the GATT task: the timer hands its work over to it */
+static app_bt_conn_param_link_t  app_bt_conn_param_links[APP_BT_CONN_MAX_CONNECTIONS];
+static app_bt_conn_param_stats_t app_bt_conn_param_stats;
+static TimerHandle_t             app_bt_conn_param_timer;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_conn_param_link
+********************************************************************************
+* Summary:
+*  Returns the entry of a connection. Passing 0 returns a free entry.
+*
+*******************************************************************************/
+static app_bt_conn_param_link_t *app_bt_conn_param_link(uint16_t conn_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        if (app_bt_conn_param_links[i].conn_id == conn_id)
+        {
+            return &app_bt_conn_param_links[i];
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_account
+********************************************************************************
+* Summary:
+*  Adds the time a link spent on its granted parameters since the last call
+*  to the statistics, with the connection events the client listened to.
+*
+*******************************************************************************/
+static void app_bt_conn_param_account(app_bt_conn_param_link_t *p_link, TickType_t now)
+{
+    app_bt_conn_param_stats_t *p_stats = &app_bt_conn_param_stats;
+    uint32_t elapsed_ms = (uint32_t)(((uint64_t)(now - p_link->since) * 1000u) /
+                                     configTICK_RATE_HZ);
+
+    p_link->since = now;
+    if (0 == p_link->interval)
+    {
+        return;
+    }
+    if (p_link->interval <= APP_BT_CONN_PARAM_FAST_MAX_INTERVAL)
+    {
+        p_stats->fast_ms += elapsed_ms;
+    }
+    else
+    {
+        p_stats->idle_ms += elapsed_ms;
+    }
+
+    /* One event every (latency + 1) intervals of 1.25 ms */
+    p_stats->peer_events += (uint32_t)(((uint64_t)elapsed_ms * 4u) /
+                                       (5u * (uint64_t)p_link->interval *
+                                        (1u + p_link->latency)));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_request
+********************************************************************************
+* Summary:
+*  Asks for the parameters of the profile a link should be on, unless they
+*  are granted already. Only one update runs per link; a change made while
+*  one is pending is requested when it completes.
+*
+*******************************************************************************/
+static void app_bt_conn_param_request(app_bt_conn_param_link_t *p_link)
+{
+    const app_bt_conn_param_set_t *p_set = &app_bt_conn_param_sets[p_link->profile];
+    if ((p_link->interval >= p_set->min_interval) && (p_link->interval <= p_set->max_interval) &&
+        (p_link->latency == p_set->latency))
+    {
+        return;
+    }
+
+    if (p_link->pending)
+    {
+        app_bt_conn_param_stats.deferred++;
+        return;
+    }
+
+    p_link->pending = WICED_TRUE;
+    if (WICED_TRUE != wiced_bt_l2cap_update_ble_conn_params(p_link->bd_addr, p_set->min_interval,
+                                                            p_set->max_interval, p_set->latency,
+                                                            p_set->timeout))
+    {
+        p_link->pending = WICED_FALSE;
+        return;
+    }
+    app_bt_conn_param_stats.requests++;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_set_profile
+********************************************************************************
+* Summary:
+*  Moves a link to another profile and requests its parameters.
+*
+*******************************************************************************/
+static void app_bt_conn_param_set_profile(app_bt_conn_param_link_t *p_link,
+                                          app_bt_conn_param_profile_t profile)
+{
+    if (profile == p_link->profile)
+    {
+        return;
+    }
+    p_link->profile = (uint8_t)profile;
+    if (APP_BT_CONN_PARAM_FAST == profile)
+    {
+        app_bt_conn_param_stats.to_fast++;
+    }
+    else
+    {
+        app_bt_conn_param_stats.to_idle++;
+    }
+    app_bt_conn_param_request(p_link);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_arm
+********************************************************************************
+* Summary:
+*  Starts the idle timer unless it already runs; it then finds the new fast
+*  link when it fires.
+*
+*******************************************************************************/
+static void app_bt_conn_param_arm(void)
+{
+    if (pdFALSE == xTimerIsTimerActive(app_bt_conn_param_timer))
+    {
+        xTimerChangePeriod(app_bt_conn_param_timer,
+                           pdMS_TO_TICKS(APP_BT_CONN_PARAM_IDLE_AFTER_MS), 0);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_relax
+********************************************************************************
+* Summary:
+*  Runs in the GATT task when the idle timer fires. Relaxes the fast links
+*  that have been quiet for APP_BT_CONN_PARAM_IDLE_AFTER_MS and runs the
+*  timer again for when the next one will be.
+*
+* Parameters:
+*  void *p_data: Not used
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_bt_conn_param_relax(void *p_data)
+{
+    const TickType_t idle_after = pdMS_TO_TICKS(APP_BT_CONN_PARAM_IDLE_AFTER_MS);
+    TickType_t now = xTaskGetTickCount();
+    TickType_t next = 0;
+    TickType_t quiet;
+    uint32_t i;
+
+    (void)p_data;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        app_bt_conn_param_link_t *p_link = &app_bt_conn_param_links[i];
+
+        if ((0 == p_link->conn_id) || (APP_BT_CONN_PARAM_FAST != p_link->profile))
+        {
+            continue;
+        }
+        quiet = now - (TickType_t)p_link->last_activity;
+        if (quiet >= idle_after)
+        {
+            app_bt_conn_param_set_profile(p_link, APP_BT_CONN_PARAM_IDLE);
+        }
+        else if ((0 == next) || ((idle_after - quiet) < next))
+        {
+            next = idle_after - quiet;
+        }
+    }
+
+    if (0 != next)
+    {
+        xTimerChangePeriod(app_bt_conn_param_timer, next, 0);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_timer_cb
+********************************************************************************
+* Summary:
+*  Runs in the timer task. Hands the relaxing over to the GATT task, which
+*  owns the links; if its queue is full, the timer tries again a period
+*  later.
+*
+* Parameters:
+*  TimerHandle_t timer: Not used
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_bt_conn_param_timer_cb(TimerHandle_t timer)
+{
+    (void)timer;
+
+    if (WICED_BT_SUCCESS != app_bt_gatt_task_defer(app_bt_conn_param_relax, NULL, 0))
+    {
+        xTimerChangePeriod(app_bt_conn_param_timer,
+                           pdMS_TO_TICKS(APP_BT_CONN_PARAM_IDLE_AFTER_MS), 0);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_init
+********************************************************************************
+* Summary:
+*  Creates the idle timer and clears the links and statistics.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS or WICED_BT_NO_RESOURCES
+*
+*******************************************************************************/
+wiced_result_t app_bt_conn_param_init(void)
+{
+    memset(app_bt_conn_param_links, 0, sizeof(app_bt_conn_param_links));
+    memset(&app_bt_conn_param_stats, 0, sizeof(app_bt_conn_param_stats));
+
+    if (NULL == app_bt_conn_param_timer)
+    {
+        app_bt_conn_param_timer = xTimerCreate("ConnParam",
+                                               pdMS_TO_TICKS(APP_BT_CONN_PARAM_IDLE_AFTER_MS),
+                                               pdFALSE, NULL, app_bt_conn_param_timer_cb);
+    }
+    return (NULL == app_bt_conn_param_timer) ? WICED_BT_NO_RESOURCES : WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_connected
+********************************************************************************
+* Summary:
+*  Starts tracking a new connection with the parameters it came up with, and
+*  asks for the fast parameters for service discovery.
+*
+* Parameters:
+*  uint16_t conn_id                  : Connection ID
+*  wiced_bt_device_address_t bd_addr : Peer address
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_conn_param_connected(uint16_t conn_id, wiced_bt_device_address_t bd_addr)
+{
+    app_bt_conn_param_link_t *p_link = app_bt_conn_param_link(0);
+    wiced_bt_ble_conn_params_t params;
+
+    if (NULL == p_link)
+    {
+        return;
+    }
+
+    memset(p_link, 0, sizeof(*p_link));
+    memcpy(p_link->bd_addr, bd_addr, BD_ADDR_LEN);
+    p_link->profile = APP_BT_CONN_PARAM_FAST;
+    p_link->last_activity = xTaskGetTickCount();
+    p_link->since = p_link->last_activity;
+    if (WICED_BT_SUCCESS == wiced_bt_ble_get_connection_parameters(bd_addr, &params))
+    {
+        p_link->interval = params.conn_interval;
+        p_link->latency  = params.conn_latency;
+        p_link->timeout  = params.supervision_timeout;
+    }
+    p_link->conn_id = conn_id;
+
+    app_bt_conn_param_request(p_link);
+    app_bt_conn_param_arm();
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_disconnected
+********************************************************************************
+* Summary:
+*  Stops tracking a connection that went down.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_conn_param_disconnected(uint16_t conn_id)
+{
+    app_bt_conn_param_link_t *p_link;
+
+    if ((0 == conn_id) || (NULL == (p_link = app_bt_conn_param_link(conn_id))))
+    {
+        return;
+    }
+    app_bt_conn_param_account(p_link, xTaskGetTickCount());
+    memset(p_link, 0, sizeof(*p_link));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_activity
+********************************************************************************
+* Summary:
+*  Notes a request from the client. A relaxed link goes back to the fast
+*  parameters for the burst that follows.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_conn_param_activity(uint16_t conn_id)
+{
+    app_bt_conn_param_link_t *p_link;
+
+    if ((0 == conn_id) || (NULL == (p_link = app_bt_conn_param_link(conn_id))))
+    {
+        return;
+    }
+    p_link->last_activity = xTaskGetTickCount();
+    if (APP_BT_CONN_PARAM_FAST != p_link->profile)
+    {
+        app_bt_conn_param_set_profile(p_link, APP_BT_CONN_PARAM_FAST);
+        app_bt_conn_param_arm();
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_updated
+********************************************************************************
+* Summary:
+*  Records the parameters the controller reports for a link
+*  (BTM_BLE_CONNECTION_PARAM_UPDATE). If the link changed profile while the
+*  update was pending, the parameters of the new profile are requested now.
+*
+* Parameters:
+*  wiced_bt_ble_connection_param_update_t *p_update: Event data from the stack
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_conn_param_updated(wiced_bt_ble_connection_param_update_t *p_update)
+{
+    app_bt_conn_param_link_t *p_link = NULL;
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        if ((0 != app_bt_conn_param_links[i].conn_id) &&
+            (0 == memcmp(app_bt_conn_param_links[i].bd_addr, p_update->bd_addr, BD_ADDR_LEN)))
+        {
+            p_link = &app_bt_conn_param_links[i];
+            break;
+        }
+    }
+    if (NULL == p_link)
+    {
+        return;
+    }
+
+    app_bt_conn_param_account(p_link, xTaskGetTickCount());
+    p_link->pending = WICED_FALSE;
+    if (0 != p_update->status)
+    {
+        /* Retried on the next change of profile, not in a loop */
+        app_bt_conn_param_stats.rejected++;
+        return;
+    }
+
+    app_bt_conn_param_stats.granted++;
+    p_link->interval = p_update->conn_interval;
+    p_link->latency  = p_update->conn_latency;
+    p_link->timeout  = p_update->supervision_timeout;
+    app_bt_conn_param_request(p_link);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_find
+********************************************************************************
+* Summary:
+*  Returns the policy state and granted parameters of a connection, or NULL.
+*
+*******************************************************************************/
+const app_bt_conn_param_link_t *app_bt_conn_param_find(uint16_t conn_id)
+{
+    return (0 == conn_id) ? NULL : app_bt_conn_param_link(conn_id);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics, with the time of the open links counted up to now.
+*
+*******************************************************************************/
+void app_bt_conn_param_get_stats(app_bt_conn_param_stats_t *p_stats)
+{
+    TickType_t now = xTaskGetTickCount();
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        if (0 != app_bt_conn_param_links[i].conn_id)
+        {
+            app_bt_conn_param_account(&app_bt_conn_param_links[i], now);
+        }
+    }
+    *p_stats = app_bt_conn_param_stats;
+}
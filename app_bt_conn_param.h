@@ -0,0 +1,145 @@
+/******************************************************************************
+* File Name: app_bt_conn_param.h
+*
+* Description: Connection parameter policy: fast and idle parameter sets, the
+*              per-connection state and the statistics.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_CONN_PARAM_H__
+#define __APP_BT_CONN_PARAM_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+#include "wiced_bt_ble.h"
+#include "app_bt_conn.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Parameters of a link in use: discovery, or requests in quick succession.
+ * Intervals are in 1.25 ms units, the supervision timeout in 10 ms units. */
+#ifndef APP_BT_CONN_PARAM_FAST_MIN_INTERVAL
+#define APP_BT_CONN_PARAM_FAST_MIN_INTERVAL     (6u)        /* 7.5 ms */
+#endif
+#ifndef APP_BT_CONN_PARAM_FAST_MAX_INTERVAL
+#define APP_BT_CONN_PARAM_FAST_MAX_INTERVAL     (12u)       /* 15 ms */
+#endif
+#ifndef APP_BT_CONN_PARAM_FAST_LATENCY
+#define APP_BT_CONN_PARAM_FAST_LATENCY          (0u)
+#endif
+#ifndef APP_BT_CONN_PARAM_FAST_TIMEOUT
+#define APP_BT_CONN_PARAM_FAST_TIMEOUT          (200u)      /* 2 s */
+#endif
+
+/* Parameters of a link that only receives the periodic notifications. The
+ * client may skip APP_BT_CONN_PARAM_IDLE_LATENCY connection events, so a
+ * notification can wait up to (latency + 1) intervals: about 1 s here,
+ * which matches the default notification period. */
+#ifndef APP_BT_CONN_PARAM_IDLE_MIN_INTERVAL
+#define APP_BT_CONN_PARAM_IDLE_MIN_INTERVAL     (320u)      /* 400 ms */
+#endif
+#ifndef APP_BT_CONN_PARAM_IDLE_MAX_INTERVAL
+#define APP_BT_CONN_PARAM_IDLE_MAX_INTERVAL     (400u)      /* 500 ms */
+#endif
+#ifndef APP_BT_CONN_PARAM_IDLE_LATENCY
+#define APP_BT_CONN_PARAM_IDLE_LATENCY          (1u)
+#endif
+#ifndef APP_BT_CONN_PARAM_IDLE_TIMEOUT
+#define APP_BT_CONN_PARAM_IDLE_TIMEOUT          (600u)      /* 6 s */
+#endif
+
+/* A link relaxes to the idle parameters after this long without requests */
+#ifndef APP_BT_CONN_PARAM_IDLE_AFTER_MS
+#define APP_BT_CONN_PARAM_IDLE_AFTER_MS         (2000u)
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef enum
+{
+    APP_BT_CONN_PARAM_FAST,
+    APP_BT_CONN_PARAM_IDLE,
+} app_bt_conn_param_profile_t;
+
+/* Policy state and granted parameters of one connection */
+typedef struct
+{
+    uint16_t                  conn_id;          /* 0 when the entry is free */
+    wiced_bt_device_address_t bd_addr;
+    uint8_t                   profile;          /* app_bt_conn_param_profile_t wanted */
+    wiced_bool_t              pending;          /* Update requested, not reported yet */
+    uint32_t                  last_activity;    /* Tick of the last request from the peer */
+    uint16_t                  interval;         /* Granted by the controller */
+    uint16_t                  latency;
+    uint16_t                  timeout;
+    uint32_t                  since;            /* Tick the granted parameters are counted from */
+} app_bt_conn_param_link_t;
+
+typedef struct
+{
+    uint32_t requests;          /* Updates asked for */
+    uint32_t to_fast;           /* Links moved to the fast parameters */
+    uint32_t to_idle;           /* Links relaxed to the idle parameters */
+    uint32_t deferred;          /* Changes held back until a pending update completed */
+    uint32_t granted;           /* Updates reported as done */
+    uint32_t rejected;          /* Updates reported as failed */
+    uint32_t fast_ms;           /* Link time at fast intervals, over all links */
+    uint32_t idle_ms;           /* Link time at longer intervals */
+    uint32_t peer_events;       /* Connection events the clients had to listen to */
+} app_bt_conn_param_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_result_t app_bt_conn_param_init(void);
+
+void app_bt_conn_param_connected(uint16_t conn_id, wiced_bt_device_address_t bd_addr);
+
+void app_bt_conn_param_disconnected(uint16_t conn_id);
+
+void app_bt_conn_param_activity(uint16_t conn_id);
+
+void app_bt_conn_param_updated(wiced_bt_ble_connection_param_update_t *p_update);
+
+const app_bt_conn_param_link_t *app_bt_conn_param_find(uint16_t conn_id);
+
+void app_bt_conn_param_get_stats(app_bt_conn_param_stats_t *p_stats);
+
+#endif      /*__APP_BT_CONN_PARAM_H__ */
@@ -0,0 +1,466 @@
+/******************************************************************************
+* File Name: app_bt_gatt_task.c
+*
+* Description: GATT task: the GATT callback queues attribute requests and an
+*              application task handles them and sends the responses, so the
+*              stack thread is only held for the copy.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_gatt_task.h"
+#include "app_bt_pool.h"
+#include "app_bt_conn.h"
+#include "app_cpu.h"
+#include "app_latency.h"
+#include <task.h>
+#include <queue.h>
+#include <string.h>
+#include <stdio.h>
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static QueueHandle_t              app_bt_gatt_task_queue = NULL;
+#if APP_BT_GATT_TASK_ENABLE
+static TaskHandle_t               app_bt_gatt_task_handle = NULL;
+#endif
+static app_bt_gatt_task_handler_t app_bt_gatt_task_handler;
+
+/* The callback side is counted from the stack thread, the calls queued also
+ * from the timer task, the rest from the task */
+static app_bt_gatt_task_stats_t   app_bt_gatt_task_stats;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+#if APP_BT_GATT_TASK_ENABLE
+static void app_bt_gatt_task(void *pvParameters);
+#endif
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+#if APP_BT_GATT_TASK_ENABLE
+/*******************************************************************************
+* Function Name: app_bt_gatt_task
+********************************************************************************
+* Summary:
+*  Handles attribute requests and calls as they are queued.
+*
+*******************************************************************************/
+static void app_bt_gatt_task(void *pvParameters)
+{
+    (void)pvParameters;
+
+    for (;;)
+    {
+        app_bt_gatt_task_process(portMAX_DELAY);
+    }
+}
+#endif
+
+/*******************************************************************************
+* Function Name: app_bt_gatt_task_copy
+********************************************************************************
+* Summary:
+*  Returns the data of a request that only lives as long as the callback,
+*  and its length.
+*
+*******************************************************************************/
+static uint8_t *app_bt_gatt_task_copy(wiced_bt_gatt_attribute_request_t *p_req, uint32_t *p_len)
+{
+    switch (p_req->opcode)
+    {
+        case GATT_REQ_WRITE:
+        case GATT_CMD_WRITE:
+        case GATT_REQ_PREPARE_WRITE:
+            *p_len = p_req->data.write_req.val_len;
+            return p_req->data.write_req.p_val;
+
+        case GATT_REQ_READ_MULTI:
+        case GATT_REQ_READ_MULTI_VAR_LENGTH:
+            *p_len = p_req->data.read_multiple_req.num_handles * sizeof(uint16_t);
+            return p_req->data.read_multiple_req.p_handle_stream;
+
+        default:
+            *p_len = 0;
+            return NULL;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_gatt_task_init
+********************************************************************************
+* Summary:
+*  Creates the request queue and the GATT task. With APP_BT_GATT_TASK_ENABLE
+*  set to 0 only the statistics are cleared.
+*
+* Parameters:
+*  app_bt_gatt_task_handler_t p_handler: Handles the queued requests
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, or WICED_BT_NO_RESOURCES if the queue or
+*                  the task cannot be created
+*
+*******************************************************************************/
+wiced_result_t app_bt_gatt_task_init(app_bt_gatt_task_handler_t p_handler)
+{
+    app_bt_gatt_task_handler = p_handler;
+    memset(&app_bt_gatt_task_stats, 0, sizeof(app_bt_gatt_task_stats));
+
+#if APP_BT_GATT_TASK_ENABLE
+    if (NULL == app_bt_gatt_task_queue)
+    {
+        app_bt_gatt_task_queue = xQueueCreate(APP_BT_GATT_TASK_QUEUE_LENGTH,
+                                              sizeof(app_bt_gatt_task_req_t));
+        if (NULL == app_bt_gatt_task_queue)
+        {
+            return WICED_BT_NO_RESOURCES;
+        }
+    }
+    if (NULL == app_bt_gatt_task_handle)
+    {
+        if (pdPASS != xTaskCreate(app_bt_gatt_task, "gatt_task", APP_BT_GATT_TASK_STACK_SIZE,
+                                  NULL, APP_BT_GATT_TASK_PRIORITY, &app_bt_gatt_task_handle))
+        {
+            printf("Failed to create GATT task! \n");
+            return WICED_BT_NO_RESOURCES;
+        }
+    }
+#endif
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_gatt_task_post
+********************************************************************************
+* Summary:
+*  Queues an attribute request for the GATT task. Called from the GATT
+*  callback, so it never blocks: when the queue or the pool is full the
+*  request is refused and the caller answers it with the error. The last
+*  APP_BT_GATT_TASK_CALL_SLOTS entries are kept for calls.
+*
+* Parameters:
+*  wiced_bt_gatt_attribute_request_t *p_req: Request as the stack passed it
+*
+* Return:
+*  wiced_bt_gatt_status_t: WICED_BT_GATT_SUCCESS, or
+*                          WICED_BT_GATT_INSUF_RESOURCE if it was not queued
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t app_bt_gatt_task_post(const wiced_bt_gatt_attribute_request_t *p_req)
+{
+    app_bt_gatt_task_req_t item;
+    uint8_t *p_data;
+    uint32_t len;
+    uint32_t waiting;
+
+    item.p_call = NULL;
+    item.req = *p_req;
+    item.p_copy = NULL;
+    item.posted = app_cpu_counter();
+
+    if ((NULL != (p_data = app_bt_gatt_task_copy(&item.req, &len))) && (0 != len))
+    {
+        if (NULL == (item.p_copy = app_bt_pool_alloc(len)))
+        {
+            app_bt_gatt_task_stats.no_memory++;
+            return WICED_BT_GATT_INSUF_RESOURCE;
+        }
+        memcpy(item.p_copy, p_data, len);
+    }
+
+    if ((NULL == app_bt_gatt_task_queue) ||
+        (uxQueueMessagesWaiting(app_bt_gatt_task_queue) >=
+         (APP_BT_GATT_TASK_QUEUE_LENGTH - APP_BT_GATT_TASK_CALL_SLOTS)) ||
+        (pdPASS != xQueueSend(app_bt_gatt_task_queue, &item, 0)))
+    {
+        app_bt_pool_free(item.p_copy);
+        app_bt_gatt_task_stats.queue_full++;
+        return WICED_BT_GATT_INSUF_RESOURCE;
+    }
+
+    app_bt_gatt_task_stats.posted++;
+    waiting = (uint32_t)uxQueueMessagesWaiting(app_bt_gatt_task_queue);
+    app_bt_gatt_task_stats.peak_waiting = MAX(app_bt_gatt_task_stats.peak_waiting, waiting);
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_gatt_task_queue_call
+********************************************************************************
+* Summary:
+*  Queues a call with a copy of its event, or makes it right away with
+*  APP_BT_GATT_TASK_ENABLE set to 0. The call is refused if it would leave
+*  fewer than keep entries of the queue free.
+*
+* Parameters:
+*  app_bt_gatt_task_call_t p_call : Function to call
+*  const void *p_data             : Event it is called with, copied; may be
+*                                   NULL when len is 0
+*  uint32_t len                   : Length of the event, at most
+*                                   APP_BT_GATT_TASK_CALL_DATA_LEN
+*  uint32_t keep                  : Entries the call has to leave free
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, WICED_BT_BADARG for an event too long,
+*                  or WICED_BT_NO_RESOURCES if the queue is full
+*
+*******************************************************************************/
+static wiced_result_t app_bt_gatt_task_queue_call(app_bt_gatt_task_call_t p_call,
+                                                  const void *p_data, uint32_t len,
+                                                  uint32_t keep)
+{
+    app_bt_gatt_task_req_t item;
+    wiced_bool_t queued;
+
+    if (len > sizeof(item.data))
+    {
+        return WICED_BT_BADARG;
+    }
+#if APP_BT_GATT_TASK_ENABLE
+    item.p_call = p_call;
+    item.p_copy = NULL;
+    item.posted = app_cpu_counter();
+    if (0 != len)
+    {
+        memcpy(item.data, p_data, len);
+    }
+
+    /* The stack thread and the timer task both queue calls; the check and
+     * the send must not be split by the other */
+    taskENTER_CRITICAL();
+    queued = ((NULL != app_bt_gatt_task_queue) &&
+              ((uint32_t)uxQueueMessagesWaiting(app_bt_gatt_task_queue) + keep <
+               APP_BT_GATT_TASK_QUEUE_LENGTH) &&
+              (pdPASS == xQueueSend(app_bt_gatt_task_queue, &item, 0))) ? WICED_TRUE : WICED_FALSE;
+    if (queued)
+    {
+        app_bt_gatt_task_stats.calls++;
+    }
+    else
+    {
+        app_bt_gatt_task_stats.calls_lost++;
+    }
+    taskEXIT_CRITICAL();
+    return queued ? WICED_BT_SUCCESS : WICED_BT_NO_RESOURCES;
+#else
+    (void)queued;
+    (void)keep;
+    if (0 != len)
+    {
+        memcpy(item.data, p_data, len);
+    }
+    p_call(item.data);
+    return WICED_BT_SUCCESS;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: app_bt_gatt_task_defer
+********************************************************************************
+* Summary:
+*  Has the GATT task make a call with a copy of an event, behind the
+*  requests queued before it. The stack thread hands its connection,
+*  security and link events over this way, and the timers their work, so
+*  that the state of the connections is only changed by the task. Never
+*  blocks. The last APP_BT_GATT_TASK_RESERVED_SLOTS entries are left to
+*  app_bt_gatt_task_defer_reserved(). With APP_BT_GATT_TASK_ENABLE set to 0
+*  the call is made right away, in the context of the caller.
+*
+* Parameters:
+*  app_bt_gatt_task_call_t p_call : Function to call
+*  const void *p_data             : Event it is called with, copied; may be
+*                                   NULL when len is 0
+*  uint32_t len                   : Length of the event, at most
+*                                   APP_BT_GATT_TASK_CALL_DATA_LEN
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, WICED_BT_BADARG for an event too long,
+*                  or WICED_BT_NO_RESOURCES if the queue is full
+*
+*******************************************************************************/
+wiced_result_t app_bt_gatt_task_defer(app_bt_gatt_task_call_t p_call, const void *p_data,
+                                      uint32_t len)
+{
+    return app_bt_gatt_task_queue_call(p_call, p_data, len, APP_BT_GATT_TASK_RESERVED_SLOTS);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_gatt_task_defer_reserved
+********************************************************************************
+* Summary:
+*  Like app_bt_gatt_task_defer(), for the calls whose loss would leave the
+*  state wrong for good: the release of a transmitted notification, a
+*  connection coming up or going down and an indication confirmation. These
+*  may use the whole queue, APP_BT_GATT_TASK_RESERVED_SLOTS included, which
+*  is sized for all of them at once.
+*
+* Parameters:
+*  app_bt_gatt_task_call_t p_call : Function to call
+*  const void *p_data             : Event it is called with, copied; may be
+*                                   NULL when len is 0
+*  uint32_t len                   : Length of the event, at most
+*                                   APP_BT_GATT_TASK_CALL_DATA_LEN
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, WICED_BT_BADARG for an event too long,
+*                  or WICED_BT_NO_RESOURCES if the queue is full
+*
+*******************************************************************************/
+wiced_result_t app_bt_gatt_task_defer_reserved(app_bt_gatt_task_call_t p_call,
+                                               const void *p_data, uint32_t len)
+{
+    return app_bt_gatt_task_queue_call(p_call, p_data, len, 0u);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_gatt_task_process
+********************************************************************************
+* Summary:
+*  Makes the queued calls, handles the queued requests and answers those
+*  that fail with an Error Response. Requests of a connection that went down
+*  before them are dropped. This is the body of the GATT task; the host build
+*  calls it in place of the task.
+*
+* Parameters:
+*  TickType_t wait: How long to wait for the first request
+*
+* Return:
+*  uint32_t: Number of requests and calls taken from the queue
+*
+*******************************************************************************/
+uint32_t app_bt_gatt_task_process(TickType_t wait)
+{
+    app_bt_gatt_task_req_t item;
+    wiced_bt_gatt_status_t status;
+    uint16_t error_handle;
+    uint32_t waited;
+    uint32_t count = 0;
+
+    if (NULL == app_bt_gatt_task_queue)
+    {
+        return 0;
+    }
+
+    while (pdPASS == xQueueReceive(app_bt_gatt_task_queue, &item, (0 == count) ? wait : 0))
+    {
+        count++;
+        if (NULL != item.p_call)
+        {
+            item.p_call(item.data);
+            app_bt_gatt_task_stats.calls_made++;
+            continue;
+        }
+
+        waited = app_cpu_counter() - item.posted;
+        app_bt_gatt_task_stats.wait_max_cycles = MAX(app_bt_gatt_task_stats.wait_max_cycles,
+                                                     waited);
+        app_latency_record(APP_LATENCY_GATT_QUEUE, waited);
+
+        /* The connection events come through the queue as well, so the
+         * table is as the stack left it when the request was queued */
+        if (NULL == app_bt_conn_find(item.req.conn_id))
+        {
+            app_bt_gatt_task_stats.stale++;
+            app_bt_pool_free(item.p_copy);
+            continue;
+        }
+
+        /* Point the request at the copy of its data */
+        if (NULL != item.p_copy)
+        {
+            if ((GATT_REQ_READ_MULTI == item.req.opcode) ||
+                (GATT_REQ_READ_MULTI_VAR_LENGTH == item.req.opcode))
+            {
+                item.req.data.read_multiple_req.p_handle_stream = item.p_copy;
+            }
+            else
+            {
+                item.req.data.write_req.p_val = item.p_copy;
+            }
+        }
+
+        error_handle = 0;
+        status = app_bt_gatt_task_handler(&item.req, &error_handle);
+        if (WICED_BT_GATT_SUCCESS != status)
+        {
+            wiced_bt_gatt_server_send_error_rsp(item.req.conn_id, item.req.opcode,
+                                                error_handle, status);
+        }
+        app_bt_pool_free(item.p_copy);
+        app_bt_gatt_task_stats.processed++;
+    }
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_gatt_task_residency
+********************************************************************************
+* Summary:
+*  Accounts the time the GATT callback spent on an attribute request.
+*
+* Parameters:
+*  uint32_t entered: app_cpu_counter() when the callback was entered
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_gatt_task_residency(uint32_t entered)
+{
+    uint32_t cycles = app_cpu_counter() - entered;
+
+    app_bt_gatt_task_stats.callbacks++;
+    app_bt_gatt_task_stats.callback_cycles += cycles;
+    app_bt_gatt_task_stats.callback_max_cycles = MAX(app_bt_gatt_task_stats.callback_max_cycles,
+                                                     cycles);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_gatt_task_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics.
+*
+*******************************************************************************/
+void app_bt_gatt_task_get_stats(app_bt_gatt_task_stats_t *p_stats)
+{
+    *p_stats = app_bt_gatt_task_stats;
+}
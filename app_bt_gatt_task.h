@@ -0,0 +1,162 @@
+/******************************************************************************
+* File Name: app_bt_gatt_task.h
+*
+* Description: GATT task: queue of attribute requests copied by the GATT
+*              callback, the task that handles them and the statistics.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_GATT_TASK_H__
+#define __APP_BT_GATT_TASK_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_gatt.h"
+#include "app_bt_notify.h"
+#include <FreeRTOS.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* 1: the GATT callback copies attribute requests to a queue and the GATT
+ * task handles them, along with every other event of the application's
+ * Bluetooth state. 0: the callback handles them itself, which keeps the
+ * stack thread busy for the whole request; kept to compare the two. */
+#ifndef APP_BT_GATT_TASK_ENABLE
+#define APP_BT_GATT_TASK_ENABLE         (1)
+#endif
+
+/* Above the log task, below the button task */
+#ifndef APP_BT_GATT_TASK_PRIORITY
+#define APP_BT_GATT_TASK_PRIORITY       (configMAX_PRIORITIES - 2)
+#endif
+
+#ifndef APP_BT_GATT_TASK_STACK_SIZE
+#define APP_BT_GATT_TASK_STACK_SIZE     (configMINIMAL_STACK_SIZE * 4)
+#endif
+
+/* Entries only app_bt_gatt_task_defer_reserved() may use: the transmitted
+ * buffer of every notification at the stack, and a connection up, down and
+ * an indication confirmation for every link */
+#ifndef APP_BT_GATT_TASK_RESERVED_SLOTS
+#define APP_BT_GATT_TASK_RESERVED_SLOTS ((APP_BT_NOTIFY_LINKS * APP_BT_NOTIFY_QUEUE_DEPTH) + \
+                                         (3u * APP_BT_NOTIFY_LINKS))
+#endif
+
+/* Entries attribute requests leave free for calls: a request refused is
+ * answered with an error, a call lost leaves the state behind the stack.
+ * The reserved slots, plus room for the other events and the timers. */
+#ifndef APP_BT_GATT_TASK_CALL_SLOTS
+#define APP_BT_GATT_TASK_CALL_SLOTS     (APP_BT_GATT_TASK_RESERVED_SLOTS + 8u)
+#endif
+
+/* Requests and calls that can wait for the task: eight requests, as a
+ * client has one outstanding at a time plus its commands and
+ * confirmations, and the call slots */
+#ifndef APP_BT_GATT_TASK_QUEUE_LENGTH
+#define APP_BT_GATT_TASK_QUEUE_LENGTH   (APP_BT_GATT_TASK_CALL_SLOTS + 8u)
+#endif
+
+/* Largest event a call can carry */
+#ifndef APP_BT_GATT_TASK_CALL_DATA_LEN
+#define APP_BT_GATT_TASK_CALL_DATA_LEN  (24u)
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Handles one attribute request and sends its response. Returns the error
+ * to answer with if no response was sent. */
+typedef wiced_bt_gatt_status_t (*app_bt_gatt_task_handler_t)(wiced_bt_gatt_attribute_request_t *p_req,
+                                                              uint16_t *p_error_handle);
+
+/* Runs in the GATT task on behalf of the stack thread or a timer, with a
+ * copy of the event it was deferred with */
+typedef void (*app_bt_gatt_task_call_t)(void *p_data);
+
+/* An attribute request or a call as queued. The value of a write or the
+ * handles of a Read Multiple only live as long as the callback, so they are
+ * copied to a pool block and the request points there. */
+typedef struct
+{
+    app_bt_gatt_task_call_t               p_call;   /* NULL for an attribute request */
+    union
+    {
+        wiced_bt_gatt_attribute_request_t req;
+        uint8_t                           data[APP_BT_GATT_TASK_CALL_DATA_LEN];
+    };
+    uint8_t                              *p_copy;   /* Pool block, or NULL */
+    uint32_t                              posted;   /* Cycle count when queued */
+} app_bt_gatt_task_req_t;
+
+typedef struct
+{
+    uint32_t posted;            /* Requests queued by the callback */
+    uint32_t processed;         /* Requests handled by the task */
+    uint32_t stale;             /* Requests dropped because the connection went down */
+    uint32_t queue_full;        /* Requests refused because the queue was full */
+    uint32_t no_memory;         /* Requests refused for lack of a pool block */
+    uint32_t calls;             /* Calls queued by the stack thread and timers */
+    uint32_t calls_made;        /* Calls made by the task */
+    uint32_t calls_lost;        /* Calls dropped because the queue was full */
+    uint32_t peak_waiting;      /* Most requests waiting in the queue */
+    uint32_t wait_max_cycles;   /* Longest time a request waited for the task */
+    uint32_t callbacks;         /* Attribute requests seen by the callback */
+    uint64_t callback_cycles;   /* Time the callback spent on them */
+    uint32_t callback_max_cycles;
+} app_bt_gatt_task_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_result_t app_bt_gatt_task_init(app_bt_gatt_task_handler_t p_handler);
+
+wiced_bt_gatt_status_t app_bt_gatt_task_post(const wiced_bt_gatt_attribute_request_t *p_req);
+
+wiced_result_t app_bt_gatt_task_defer(app_bt_gatt_task_call_t p_call, const void *p_data,
+                                      uint32_t len);
+
+wiced_result_t app_bt_gatt_task_defer_reserved(app_bt_gatt_task_call_t p_call,
+                                               const void *p_data, uint32_t len);
+
+uint32_t app_bt_gatt_task_process(TickType_t wait);
+
+void app_bt_gatt_task_residency(uint32_t entered);
+
+void app_bt_gatt_task_get_stats(app_bt_gatt_task_stats_t *p_stats);
+
+#endif      /*__APP_BT_GATT_TASK_H__ */
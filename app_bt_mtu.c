@@ -0,0 +1,225 @@
+/******************************************************************************
+* File Name: app_bt_mtu.c
+*
+* Description: ATT MTU and LE Data Length of each connection. Asks for a
+*              larger MTU and LL payload after connecting, records what is
+*              negotiated, sizes responses by it and counts the LL PDUs each
+*              payload takes.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_mtu.h"
+#include <string.h>
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+/* Only used from the GATT task */
+static app_bt_mtu_stats_t app_bt_mtu_stats;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_mtu_init
+********************************************************************************
+* Summary:
+*  Clears the statistics.
+*
+*******************************************************************************/
+void app_bt_mtu_init(void)
+{
+    memset(&app_bt_mtu_stats, 0, sizeof(app_bt_mtu_stats));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_mtu_connected
+********************************************************************************
+* Summary:
+*  Asks for a larger ATT MTU and LL payload on a new connection instead of
+*  waiting for the client, so that responses and notifications need fewer
+*  PDUs from the first request on. The results arrive as
+*  GATT_OPERATION_CPLT_EVT and BTM_BLE_DATA_LENGTH_UPDATE_EVENT.
+*
+* Parameters:
+*  app_bt_conn_t *p_conn: Entry of the connection
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_mtu_connected(app_bt_conn_t *p_conn)
+{
+    if (APP_BT_MTU_PREFERRED > p_conn->mtu)
+    {
+        if (WICED_BT_GATT_SUCCESS == wiced_bt_gatt_client_configure_mtu(p_conn->conn_id,
+                                                                        APP_BT_MTU_PREFERRED))
+        {
+            app_bt_mtu_stats.mtu_requests++;
+        }
+    }
+
+    if (APP_BT_MTU_TX_OCTETS > p_conn->tx_octets)
+    {
+        if (WICED_BT_SUCCESS ==
+            wiced_bt_ble_set_data_packet_length(p_conn->bd_addr, APP_BT_MTU_TX_OCTETS,
+                                                APP_BT_MTU_TX_TIME(APP_BT_MTU_TX_OCTETS)))
+        {
+            app_bt_mtu_stats.dle_requests++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_mtu_exchanged
+********************************************************************************
+* Summary:
+*  Records the ATT MTU of a connection after an exchange started by either
+*  side.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*  uint16_t mtu    : MTU agreed with the peer
+*
+* Return:
+*  uint16_t: MTU in use, never above CY_BT_MTU_SIZE
+*
+*******************************************************************************/
+uint16_t app_bt_mtu_exchanged(uint16_t conn_id, uint16_t mtu)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find(conn_id);
+
+    mtu = MAX(MIN(mtu, CY_BT_MTU_SIZE), GATT_DEF_BLE_MTU_SIZE);
+    if (NULL != p_conn)
+    {
+        p_conn->mtu = mtu;
+        app_bt_mtu_stats.exchanges++;
+    }
+    return mtu;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_mtu_data_length
+********************************************************************************
+* Summary:
+*  Records the LL payload the controller now sends to a peer
+*  (BTM_BLE_DATA_LENGTH_UPDATE_EVENT).
+*
+* Parameters:
+*  wiced_bt_ble_data_length_update_t *p_update: Event data from the stack
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_mtu_data_length(wiced_bt_ble_data_length_update_t *p_update)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find_by_addr(p_update->bd_address);
+
+    if (NULL != p_conn)
+    {
+        p_conn->tx_octets = MAX(MIN(p_update->max_tx_octets, APP_BT_MTU_LL_MAX_OCTETS),
+                                APP_BT_CONN_DEF_TX_OCTETS);
+        app_bt_mtu_stats.dle_updates++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_mtu_payload_len
+********************************************************************************
+* Summary:
+*  Returns how many value bytes a response to a connection can carry: the
+*  length the stack offers, but never more than the negotiated MTU leaves
+*  after the ATT header.
+*
+* Parameters:
+*  uint16_t conn_id      : Connection ID
+*  uint16_t len_requested: Length offered by the stack with the request
+*  uint16_t hdr_len      : ATT header of the response, APP_BT_MTU_*_HDR_LEN
+*
+* Return:
+*  uint16_t: Value bytes that fit
+*
+*******************************************************************************/
+uint16_t app_bt_mtu_payload_len(uint16_t conn_id, uint16_t len_requested, uint16_t hdr_len)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find(conn_id);
+    uint16_t mtu = (NULL != p_conn) ? p_conn->mtu : GATT_DEF_BLE_MTU_SIZE;
+
+    return MIN(len_requested, (uint16_t)(mtu - hdr_len));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_mtu_sent
+********************************************************************************
+* Summary:
+*  Counts the LL data PDUs an ATT PDU sent to a connection takes with the
+*  LL payload in use on that link.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*  uint16_t att_len: Length of the ATT PDU, header included
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_mtu_sent(uint16_t conn_id, uint16_t att_len)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find(conn_id);
+    uint32_t octets = (NULL != p_conn) ? p_conn->tx_octets : APP_BT_CONN_DEF_TX_OCTETS;
+    uint32_t pdus = (att_len + APP_BT_MTU_L2CAP_HDR_LEN + octets - 1u) / octets;
+
+    app_bt_mtu_stats.payloads++;
+    app_bt_mtu_stats.bytes += att_len;
+    app_bt_mtu_stats.pdus += pdus;
+    app_bt_mtu_stats.pdu_hist[MIN(pdus, APP_BT_MTU_PDU_BUCKETS) - 1u]++;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_mtu_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics.
+*
+*******************************************************************************/
+void app_bt_mtu_get_stats(app_bt_mtu_stats_t *p_stats)
+{
+    *p_stats = app_bt_mtu_stats;
+}
@@ -0,0 +1,119 @@
+/******************************************************************************
+* File Name: app_bt_mtu.h
+*
+* Description: ATT MTU and LE Data Length of each connection: sizes, requests
+*              made after connecting and PDU statistics.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_MTU_H__
+#define __APP_BT_MTU_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+#include "wiced_bt_ble.h"
+#include "wiced_bt_gatt.h"
+#include "app_bt_conn.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* ATT MTU the server asks for right after connecting */
+#ifndef APP_BT_MTU_PREFERRED
+#define APP_BT_MTU_PREFERRED            (CY_BT_MTU_SIZE)
+#endif
+
+/* L2CAP basic header in front of every ATT PDU */
+#define APP_BT_MTU_L2CAP_HDR_LEN        (4u)
+
+/* Largest LL data PDU payload with Data Length Extension */
+#define APP_BT_MTU_LL_MAX_OCTETS        (251u)
+
+/* LL payload asked for: one ATT PDU of the preferred MTU per LL PDU */
+#ifndef APP_BT_MTU_TX_OCTETS
+#define APP_BT_MTU_TX_OCTETS            (MIN(APP_BT_MTU_PREFERRED + APP_BT_MTU_L2CAP_HDR_LEN, \
+                                             APP_BT_MTU_LL_MAX_OCTETS))
+#endif
+
+/* Air time of a PDU carrying that payload on the LE 1M PHY, in us */
+#define APP_BT_MTU_TX_TIME(octets)      (((octets) + 14u) * 8u)
+
+/* ATT headers in front of the value: opcode; opcode and length; opcode;
+ * opcode and handle; opcode, handle and offset */
+#define APP_BT_MTU_READ_RSP_HDR_LEN     (1u)
+#define APP_BT_MTU_READ_BY_TYPE_HDR_LEN (2u)
+#define APP_BT_MTU_READ_MULTI_HDR_LEN   (1u)
+#define APP_BT_MTU_NOTIF_HDR_LEN        (3u)
+#define APP_BT_MTU_PREP_WRITE_HDR_LEN   (5u)
+
+/* PDU count histogram: 1, 2, 3, 4, and 5 or more LL PDUs per ATT PDU */
+#define APP_BT_MTU_PDU_BUCKETS          (5u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t mtu_requests;      /* MTU exchanges started by the server */
+    uint32_t exchanges;         /* MTU exchanges completed, started by either side */
+    uint32_t dle_requests;      /* Data length updates asked for */
+    uint32_t dle_updates;       /* Data length changes reported by the controller */
+    uint32_t payloads;          /* ATT PDUs sent with a value */
+    uint32_t bytes;             /* Their length, ATT headers included */
+    uint32_t pdus;              /* LL data PDUs they took */
+    uint32_t pdu_hist[APP_BT_MTU_PDU_BUCKETS];
+} app_bt_mtu_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_mtu_init(void);
+
+void app_bt_mtu_connected(app_bt_conn_t *p_conn);
+
+uint16_t app_bt_mtu_exchanged(uint16_t conn_id, uint16_t mtu);
+
+void app_bt_mtu_data_length(wiced_bt_ble_data_length_update_t *p_update);
+
+uint16_t app_bt_mtu_payload_len(uint16_t conn_id, uint16_t len_requested, uint16_t hdr_len);
+
+void app_bt_mtu_sent(uint16_t conn_id, uint16_t att_len);
+
+void app_bt_mtu_get_stats(app_bt_mtu_stats_t *p_stats);
+
+#endif      /*__APP_BT_MTU_H__ */
@@ -0,0 +1,485 @@
+/******************************************************************************
+* File Name: app_bt_notify.c
+*
+* Description: Notification queue: holds notifications and indications per
+*              connection while the stack is congested or an indication is
+*              not confirmed, keeps only the newest value of a handle,
+*              releases entries on the buffer transmitted event and measures
+*              the indication round trip time.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_notify.h"
+#include "app_bt_mtu.h"
+#include "app_bt_gatt_task.h"
+#include <task.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+/* Only used from the GATT task: the scheduled notifications, the congestion
+ * events and the transmitted buffers are handed over to it */
+static app_bt_notify_link_t  app_bt_notify_links[APP_BT_NOTIFY_LINKS];
+static app_bt_notify_stats_t app_bt_notify_stats;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_notify_link
+********************************************************************************
+* Summary:
+*  Returns the queue of a connection, or NULL.
+*
+*******************************************************************************/
+static app_bt_notify_link_t *app_bt_notify_link(uint16_t conn_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_NOTIFY_LINKS; i++)
+    {
+        if ((0 != conn_id) && (app_bt_notify_links[i].conn_id == conn_id))
+        {
+            return &app_bt_notify_links[i];
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_claim
+********************************************************************************
+* Summary:
+*  Returns the queue of a connection, taking a free one on its first
+*  notification. A queue whose connection is gone stays taken until the
+*  stack has returned all its buffers.
+*
+*******************************************************************************/
+static app_bt_notify_link_t *app_bt_notify_claim(uint16_t conn_id)
+{
+    app_bt_notify_link_t *p_link = app_bt_notify_link(conn_id);
+    uint32_t i;
+
+    for (i = 0; (NULL == p_link) && (i < APP_BT_NOTIFY_LINKS); i++)
+    {
+        if ((0 == app_bt_notify_links[i].conn_id) && (0 == app_bt_notify_links[i].count))
+        {
+            p_link = &app_bt_notify_links[i];
+            memset(p_link, 0, sizeof(*p_link));
+            p_link->conn_id = conn_id;
+        }
+    }
+    return p_link;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_entry
+********************************************************************************
+* Summary:
+*  Returns the entry at a position of the queue, 0 being the oldest.
+*
+*******************************************************************************/
+static app_bt_notify_entry_t *app_bt_notify_entry(app_bt_notify_link_t *p_link, uint16_t pos)
+{
+    return &p_link->entries[(p_link->head + pos) % APP_BT_NOTIFY_QUEUE_DEPTH];
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_remove
+********************************************************************************
+* Summary:
+*  Removes a waiting entry. The entries behind it move up; none of them is at
+*  the stack yet, so no buffer the stack holds moves.
+*
+*******************************************************************************/
+static void app_bt_notify_remove(app_bt_notify_link_t *p_link, uint16_t pos)
+{
+    for (; (pos + 1u) < p_link->count; pos++)
+    {
+        *app_bt_notify_entry(p_link, pos) = *app_bt_notify_entry(p_link, pos + 1u);
+    }
+    p_link->count--;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_pump
+********************************************************************************
+* Summary:
+*  Hands the waiting entries of a queue to the stack, in order, until the
+*  stack reports congestion or an indication has to wait for the
+*  confirmation of the one before. An entry the stack refuses for another
+*  reason is dropped.
+*
+* Parameters:
+*  app_bt_notify_link_t *p_link: Queue of the connection
+*
+* Return:
+*  wiced_bt_gatt_status_t: WICED_BT_GATT_SUCCESS, or the status of the last
+*                          entry the stack refused
+*
+*******************************************************************************/
+static wiced_bt_gatt_status_t app_bt_notify_pump(app_bt_notify_link_t *p_link)
+{
+    wiced_bt_gatt_status_t result = WICED_BT_GATT_SUCCESS;
+    wiced_bt_gatt_status_t status;
+    app_bt_notify_entry_t *p_entry;
+
+    while (!p_link->congested && (p_link->in_flight < p_link->count))
+    {
+        p_entry = app_bt_notify_entry(p_link, p_link->in_flight);
+        if (p_entry->indicate)
+        {
+            /* One indication at a time; the next waits for the confirmation */
+            if (p_link->confirming)
+            {
+                break;
+            }
+            status = wiced_bt_gatt_server_send_indication(p_link->conn_id, p_entry->handle,
+                                                          p_entry->len, p_entry->value,
+                                                          (void *)app_bt_notify_transmitted);
+        }
+        else
+        {
+            status = wiced_bt_gatt_server_send_notification(p_link->conn_id, p_entry->handle,
+                                                            p_entry->len, p_entry->value,
+                                                            (void *)app_bt_notify_transmitted);
+        }
+
+        if (WICED_BT_GATT_SUCCESS == status)
+        {
+            p_link->in_flight++;
+            app_bt_notify_stats.sent++;
+            app_bt_mtu_sent(p_link->conn_id, (uint16_t)(APP_BT_MTU_NOTIF_HDR_LEN + p_entry->len));
+            if (p_entry->indicate)
+            {
+                p_link->confirming = WICED_TRUE;
+                p_link->indicated = xTaskGetTickCount();
+                app_bt_notify_stats.indications++;
+            }
+        }
+        else if (WICED_BT_GATT_CONGESTED == status)
+        {
+            /* Retried once the stack reports the congestion cleared */
+            p_link->congested = WICED_TRUE;
+            app_bt_notify_stats.congested++;
+        }
+        else
+        {
+            app_bt_notify_remove(p_link, p_link->in_flight);
+            app_bt_notify_stats.failed++;
+            result = status;
+        }
+    }
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_init
+********************************************************************************
+* Summary:
+*  Empties all queues and clears the statistics.
+*
+*******************************************************************************/
+void app_bt_notify_init(void)
+{
+    memset(app_bt_notify_links, 0, sizeof(app_bt_notify_links));
+    memset(&app_bt_notify_stats, 0, sizeof(app_bt_notify_stats));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_send
+********************************************************************************
+* Summary:
+*  Queues a notification or indication and sends what the stack takes. A
+*  value still waiting for the same handle is replaced, so a client that
+*  falls behind, or has not confirmed the last indication yet, gets the
+*  newest value rather than every stale one.
+*
+* Parameters:
+*  uint16_t conn_id     : Connection ID
+*  uint16_t handle      : Attribute handle
+*  uint8_t *p_val       : Value, copied
+*  uint16_t len         : Length of the value
+*  wiced_bool_t indicate: WICED_TRUE to send an indication
+*
+* Return:
+*  wiced_bt_gatt_status_t: WICED_BT_GATT_SUCCESS when queued,
+*                          WICED_BT_GATT_NO_RESOURCES when the queue is full,
+*                          WICED_BT_GATT_INVALID_ATTR_LEN for a value too
+*                          long, or the status the stack refused with
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t app_bt_notify_send(uint16_t conn_id, uint16_t handle,
+                                          uint8_t *p_val, uint16_t len, wiced_bool_t indicate)
+{
+    app_bt_notify_link_t *p_link;
+    app_bt_notify_entry_t *p_entry = NULL;
+    uint16_t pos;
+
+    if (APP_BT_NOTIFY_MAX_LEN < len)
+    {
+        app_bt_notify_stats.dropped++;
+        return WICED_BT_GATT_INVALID_ATTR_LEN;
+    }
+    if ((0 == conn_id) || (NULL == (p_link = app_bt_notify_claim(conn_id))))
+    {
+        app_bt_notify_stats.dropped++;
+        return WICED_BT_GATT_NO_RESOURCES;
+    }
+
+    for (pos = p_link->in_flight; pos < p_link->count; pos++)
+    {
+        if (app_bt_notify_entry(p_link, pos)->handle == handle)
+        {
+            p_entry = app_bt_notify_entry(p_link, pos);
+            app_bt_notify_stats.coalesced++;
+            break;
+        }
+    }
+    if (NULL == p_entry)
+    {
+        if (APP_BT_NOTIFY_QUEUE_DEPTH == p_link->count)
+        {
+            app_bt_notify_stats.dropped++;
+            return WICED_BT_GATT_NO_RESOURCES;
+        }
+        p_entry = app_bt_notify_entry(p_link, p_link->count++);
+        p_entry->handle = handle;
+        app_bt_notify_stats.peak_depth = MAX(app_bt_notify_stats.peak_depth, p_link->count);
+    }
+    p_entry->len = len;
+    p_entry->indicate = indicate;
+    memcpy(p_entry->value, p_val, len);
+    app_bt_notify_stats.queued++;
+
+    return app_bt_notify_pump(p_link);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_congestion
+********************************************************************************
+* Summary:
+*  Records the congestion state the stack reports for a connection
+*  (GATT_CONGESTION_EVT) and resumes sending once it clears.
+*
+* Parameters:
+*  uint16_t conn_id      : Connection ID
+*  wiced_bool_t congested: WICED_TRUE while the stack takes no more data
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_notify_congestion(uint16_t conn_id, wiced_bool_t congested)
+{
+    app_bt_notify_link_t *p_link = app_bt_notify_link(conn_id);
+
+    if (NULL == p_link)
+    {
+        return;
+    }
+    p_link->congested = congested;
+    if (!congested)
+    {
+        app_bt_notify_pump(p_link);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_confirmed
+********************************************************************************
+* Summary:
+*  Records the confirmation of an indication (GATT_HANDLE_VALUE_CONF) with
+*  its round trip time and sends the indication waiting behind it.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*  uint16_t handle : Attribute handle the client confirmed
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_notify_confirmed(uint16_t conn_id, uint16_t handle)
+{
+    app_bt_notify_link_t *p_link = app_bt_notify_link(conn_id);
+    uint32_t rtt_ms;
+
+    (void)handle;
+    if ((NULL == p_link) || !p_link->confirming)
+    {
+        return;
+    }
+    rtt_ms = (uint32_t)(((uint64_t)(xTaskGetTickCount() - p_link->indicated) * 1000u) /
+                        configTICK_RATE_HZ);
+    p_link->confirming = WICED_FALSE;
+    p_link->rtt_count++;
+    p_link->rtt_sum_ms += rtt_ms;
+    p_link->rtt_max_ms = MAX(p_link->rtt_max_ms, rtt_ms);
+    app_bt_notify_stats.confirmed++;
+    app_bt_notify_stats.rtt_sum_ms += rtt_ms;
+    app_bt_notify_stats.rtt_max_ms = MAX(app_bt_notify_stats.rtt_max_ms, rtt_ms);
+
+    app_bt_notify_pump(p_link);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_release
+********************************************************************************
+* Summary:
+*  Runs in the GATT task and releases the entry of a notification the stack
+*  has sent. The stack returns the buffers of a connection in order; the
+*  room made is used right away.
+*
+* Parameters:
+*  void *p_data: Copy of the value pointer the stack was given
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_bt_notify_release(void *p_data)
+{
+    app_bt_notify_link_t *p_link;
+    uint8_t *p_value;
+    uint32_t i;
+
+    memcpy(&p_value, p_data, sizeof(p_value));
+
+    for (i = 0; i < APP_BT_NOTIFY_LINKS; i++)
+    {
+        p_link = &app_bt_notify_links[i];
+        if ((0 != p_link->in_flight) && (app_bt_notify_entry(p_link, 0)->value == p_value))
+        {
+            p_link->head = (p_link->head + 1u) % APP_BT_NOTIFY_QUEUE_DEPTH;
+            p_link->in_flight--;
+            p_link->count--;
+            app_bt_notify_stats.transmitted++;
+            if (0 != p_link->conn_id)
+            {
+                app_bt_notify_pump(p_link);
+            }
+            return;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_transmitted
+********************************************************************************
+* Summary:
+*  Passed to the stack as the buffer context of a notification, so
+*  GATT_APP_BUFFER_TRANSMITTED_EVT calls it like the free function of a pool
+*  buffer. The entry is released by the GATT task, which owns the queues,
+*  through the reserved call slots: a release lost would keep the entry and
+*  the link's place at the stack for good.
+*
+* Parameters:
+*  uint8_t *p_data: Value the stack was given
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_notify_transmitted(uint8_t *p_data)
+{
+    app_bt_gatt_task_defer_reserved(app_bt_notify_release, &p_data, sizeof(p_data));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_disconnected
+********************************************************************************
+* Summary:
+*  Drops the waiting notifications of a connection that went down. Entries
+*  at the stack are kept until it returns them.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_notify_disconnected(uint16_t conn_id)
+{
+    app_bt_notify_link_t *p_link = app_bt_notify_link(conn_id);
+
+    if (NULL == p_link)
+    {
+        return;
+    }
+    app_bt_notify_stats.dropped += (uint32_t)(p_link->count - p_link->in_flight);
+    p_link->count = p_link->in_flight;
+    p_link->congested = WICED_FALSE;
+    p_link->confirming = WICED_FALSE;
+    p_link->conn_id = 0;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_find
+********************************************************************************
+* Summary:
+*  Returns the queue of a connection, with its indication round trip times,
+*  or NULL if nothing was sent to it yet.
+*
+*******************************************************************************/
+const app_bt_notify_link_t *app_bt_notify_find(uint16_t conn_id)
+{
+    return app_bt_notify_link(conn_id);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_notify_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics, with the entries in use now.
+*
+*******************************************************************************/
+void app_bt_notify_get_stats(app_bt_notify_stats_t *p_stats)
+{
+    uint32_t i;
+
+    *p_stats = app_bt_notify_stats;
+    p_stats->depth = 0;
+    for (i = 0; i < APP_BT_NOTIFY_LINKS; i++)
+    {
+        p_stats->depth += app_bt_notify_links[i].count;
+    }
+}
@@ -0,0 +1,139 @@
+/******************************************************************************
+* File Name: app_bt_notify.h
+*
+* Description: Notification queue: bounded per-connection queue of
+*              notifications and indications, its congestion and confirmation
+*              state and the statistics.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_NOTIFY_H__
+#define __APP_BT_NOTIFY_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_gatt.h"
+#include "app_bt_conn.h"
+#include <FreeRTOS.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Notifications and indications one connection can hold, those handed to
+ * the stack and not transmitted yet included */
+#ifndef APP_BT_NOTIFY_QUEUE_DEPTH
+#define APP_BT_NOTIFY_QUEUE_DEPTH       (4u)
+#endif
+
+/* Longest value that can be queued: what the default ATT MTU leaves after
+ * the opcode and handle */
+#ifndef APP_BT_NOTIFY_MAX_LEN
+#define APP_BT_NOTIFY_MAX_LEN           (GATT_DEF_BLE_MTU_SIZE - 3u)
+#endif
+
+/* Queues: one per connection, and a spare for a connection that went down
+ * while the stack still held its notifications */
+#define APP_BT_NOTIFY_LINKS             (APP_BT_CONN_MAX_CONNECTIONS + 1u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* One notification or indication, its value copied so that later updates
+ * cannot change it while the stack still holds it */
+typedef struct
+{
+    uint16_t     handle;
+    uint16_t     len;
+    wiced_bool_t indicate;              /* Sent as an indication */
+    uint8_t      value[APP_BT_NOTIFY_MAX_LEN];
+} app_bt_notify_entry_t;
+
+/* Notification queue of one connection, a ring with the entries at the
+ * stack in front of those still waiting */
+typedef struct
+{
+    uint16_t              conn_id;      /* 0 when the connection is gone */
+    wiced_bool_t          congested;    /* Stack refused, waiting for GATT_CONGESTION_EVT */
+    uint16_t              head;         /* Oldest entry */
+    uint16_t              count;        /* Entries in use; free when 0 and conn_id is 0 */
+    uint16_t              in_flight;    /* Entries handed to the stack */
+    wiced_bool_t          confirming;   /* Indication sent, not confirmed yet */
+    TickType_t            indicated;    /* Tick the indication was sent */
+    uint32_t              rtt_count;    /* Indications confirmed on this connection */
+    uint32_t              rtt_sum_ms;   /* Their round trip times */
+    uint32_t              rtt_max_ms;
+    app_bt_notify_entry_t entries[APP_BT_NOTIFY_QUEUE_DEPTH];
+} app_bt_notify_link_t;
+
+typedef struct
+{
+    uint32_t queued;            /* Notifications and indications accepted */
+    uint32_t coalesced;         /* Waiting values replaced by a newer one */
+    uint32_t dropped;           /* Refused with a full queue, or left at a disconnection */
+    uint32_t sent;              /* Handed to the stack */
+    uint32_t transmitted;       /* Reported sent by GATT_APP_BUFFER_TRANSMITTED_EVT */
+    uint32_t congested;         /* Sends refused as congested, retried later */
+    uint32_t failed;            /* Sends refused for any other reason, not retried */
+    uint32_t depth;             /* Entries in use now, over all connections */
+    uint32_t peak_depth;        /* Most entries one connection had in use */
+    uint32_t indications;       /* Indications handed to the stack */
+    uint32_t confirmed;         /* Confirmations received */
+    uint32_t rtt_sum_ms;        /* Round trip times of the confirmed indications */
+    uint32_t rtt_max_ms;
+} app_bt_notify_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_notify_init(void);
+
+wiced_bt_gatt_status_t app_bt_notify_send(uint16_t conn_id, uint16_t handle,
+                                          uint8_t *p_val, uint16_t len, wiced_bool_t indicate);
+
+void app_bt_notify_confirmed(uint16_t conn_id, uint16_t handle);
+
+void app_bt_notify_congestion(uint16_t conn_id, wiced_bool_t congested);
+
+void app_bt_notify_transmitted(uint8_t *p_data);
+
+void app_bt_notify_disconnected(uint16_t conn_id);
+
+const app_bt_notify_link_t *app_bt_notify_find(uint16_t conn_id);
+
+void app_bt_notify_get_stats(app_bt_notify_stats_t *p_stats);
+
+#endif      /*__APP_BT_NOTIFY_H__ */
@@ -0,0 +1,547 @@
+/******************************************************************************
+* File Name: app_bt_phy.c
+*
+* Description: LE PHY of each connection. Measures the RSSI of the clients
+*              after connecting and periodically after that, moves close
+*              clients to the LE 2M PHY and distant ones to the LE Coded PHY,
+*              and counts the time spent on each PHY.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_phy.h"
+#include "app_bt_gatt_task.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include "timers.h"
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+/* Only used from the GATT task: the timer and the RSSI reads of the stack
+ * hand their work over to it */
+static app_bt_phy_link_t  app_bt_phy_links[APP_BT_CONN_MAX_CONNECTIONS];
+static app_bt_phy_stats_t app_bt_phy_stats;
+static TimerHandle_t      app_bt_phy_timer;
+
+/* The controller reads one RSSI at a time; the links take turns. The stack
+ * clears the flag itself when it cannot hand a result over. */
+static volatile wiced_bool_t app_bt_phy_reading;
+static uint32_t           app_bt_phy_next;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+static void app_bt_phy_rssi_cback(void *p_data);
+static void app_bt_phy_rssi_read(void *p_data);
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_phy_link
+********************************************************************************
+* Summary:
+*  Returns the entry of a connection. Passing 0 returns a free entry.
+*
+*******************************************************************************/
+static app_bt_phy_link_t *app_bt_phy_link(uint16_t conn_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        if (app_bt_phy_links[i].conn_id == conn_id)
+        {
+            return &app_bt_phy_links[i];
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_link_by_addr
+********************************************************************************
+* Summary:
+*  Returns the entry of the connection to a peer, or NULL.
+*
+*******************************************************************************/
+static app_bt_phy_link_t *app_bt_phy_link_by_addr(const uint8_t *bd_addr)
+{
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        if ((0 != app_bt_phy_links[i].conn_id) &&
+            (0 == memcmp(app_bt_phy_links[i].bd_addr, bd_addr, BD_ADDR_LEN)))
+        {
+            return &app_bt_phy_links[i];
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_account
+********************************************************************************
+* Summary:
+*  Adds the time a link spent on its transmit PHY since the last call to the
+*  statistics.
+*
+*******************************************************************************/
+static void app_bt_phy_account(app_bt_phy_link_t *p_link, TickType_t now)
+{
+    uint32_t elapsed_ms = (uint32_t)(((uint64_t)(now - p_link->since) * 1000u) /
+                                     configTICK_RATE_HZ);
+
+    p_link->since = now;
+    if ((p_link->tx_phy >= WICED_BT_BLE_PHY_1M) && (p_link->tx_phy <= APP_BT_PHY_COUNT))
+    {
+        app_bt_phy_stats.ms[p_link->tx_phy - 1u] += elapsed_ms;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_wanted
+********************************************************************************
+* Summary:
+*  Returns the PHY a link should be on for its last measured RSSI.
+*
+*******************************************************************************/
+static wiced_bt_ble_phy_t app_bt_phy_wanted(const app_bt_phy_link_t *p_link)
+{
+    if (p_link->rssi >= APP_BT_PHY_2M_RSSI)
+    {
+        return WICED_BT_BLE_PHY_2M;
+    }
+    if (p_link->rssi <= APP_BT_PHY_CODED_RSSI)
+    {
+        return WICED_BT_BLE_PHY_LE_CODED;
+    }
+    return p_link->tx_phy;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_request
+********************************************************************************
+* Summary:
+*  Asks the controller to move a link to the PHY its RSSI calls for, unless
+*  it is on it already, an update is pending or the peer declined that PHY.
+*  A decline is forgotten once the RSSI moves the link to another band. The
+*  same PHY is asked for both directions; the peer may still settle on
+*  another one.
+*
+*******************************************************************************/
+static void app_bt_phy_request(app_bt_phy_link_t *p_link)
+{
+    wiced_bt_ble_phy_preferences_t prefs;
+    wiced_bt_ble_phy_t phy = app_bt_phy_wanted(p_link);
+
+    if (phy != p_link->declined)
+    {
+        p_link->declined = 0;
+    }
+    if ((phy == p_link->tx_phy) || p_link->pending)
+    {
+        return;
+    }
+    if (phy == p_link->declined)
+    {
+        app_bt_phy_stats.held++;
+        return;
+    }
+
+    memset(&prefs, 0, sizeof(prefs));
+    memcpy(prefs.remote_bd_addr, p_link->bd_addr, BD_ADDR_LEN);
+    if (WICED_BT_BLE_PHY_2M == phy)
+    {
+        prefs.tx_phys = BTM_BLE_PREFER_2M_PHY;
+        prefs.phy_opts = BTM_BLE_PREFER_NO_LELR;
+    }
+    else if (WICED_BT_BLE_PHY_LE_CODED == phy)
+    {
+        prefs.tx_phys = BTM_BLE_PREFER_LELR_PHY;
+        prefs.phy_opts = APP_BT_PHY_CODED_OPTION;
+    }
+    else
+    {
+        prefs.tx_phys = BTM_BLE_PREFER_1M_PHY;
+        prefs.phy_opts = BTM_BLE_PREFER_NO_LELR;
+    }
+    prefs.rx_phys = prefs.tx_phys;
+
+    if (WICED_BT_SUCCESS == wiced_bt_ble_set_phy(&prefs))
+    {
+        p_link->pending = WICED_TRUE;
+        p_link->asked = phy;
+        app_bt_phy_stats.requests++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_read_next
+********************************************************************************
+* Summary:
+*  Starts reading the RSSI of the next link marked for measuring, unless a
+*  read is running. The result comes in app_bt_phy_rssi_read.
+*
+*******************************************************************************/
+static void app_bt_phy_read_next(void)
+{
+    wiced_bt_device_address_t bd_addr;
+    app_bt_phy_link_t *p_link = NULL;
+    uint32_t i;
+
+    for (i = 0; (i < APP_BT_CONN_MAX_CONNECTIONS) && !app_bt_phy_reading; i++)
+    {
+        app_bt_phy_link_t *p_cand =
+            &app_bt_phy_links[(app_bt_phy_next + i) % APP_BT_CONN_MAX_CONNECTIONS];
+
+        if ((0 != p_cand->conn_id) && p_cand->measure)
+        {
+            p_link = p_cand;
+            p_link->measure = WICED_FALSE;
+            memcpy(bd_addr, p_link->bd_addr, BD_ADDR_LEN);
+            app_bt_phy_next = (uint32_t)(p_link - app_bt_phy_links) + 1u;
+            app_bt_phy_reading = WICED_TRUE;
+        }
+    }
+
+    if ((NULL != p_link) &&
+        (WICED_BT_PENDING != wiced_bt_dev_read_rssi(bd_addr, BT_TRANSPORT_LE,
+                                                    app_bt_phy_rssi_cback)))
+    {
+        /* Measured on the next check instead */
+        app_bt_phy_reading = WICED_FALSE;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_rssi_cback
+********************************************************************************
+* Summary:
+*  Runs in the stack context when an RSSI read completes, and hands the
+*  result over to the GATT task. If its queue is full the result is lost and
+*  the link is measured again on the next check.
+*
+* Parameters:
+*  void *p_data: wiced_bt_dev_rssi_result_t of the read
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_bt_phy_rssi_cback(void *p_data)
+{
+    if (WICED_BT_SUCCESS != app_bt_gatt_task_defer(app_bt_phy_rssi_read, p_data,
+                                                   sizeof(wiced_bt_dev_rssi_result_t)))
+    {
+        app_bt_phy_reading = WICED_FALSE;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_rssi_read
+********************************************************************************
+* Summary:
+*  Runs in the GATT task with the result of an RSSI read. Moves the link to
+*  the PHY the RSSI calls for and starts the next read.
+*
+* Parameters:
+*  void *p_data: Copy of the wiced_bt_dev_rssi_result_t of the read
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_bt_phy_rssi_read(void *p_data)
+{
+    wiced_bt_dev_rssi_result_t *p_result = (wiced_bt_dev_rssi_result_t *)p_data;
+    app_bt_phy_link_t *p_link = app_bt_phy_link_by_addr(p_result->rem_bda);
+
+    app_bt_phy_reading = WICED_FALSE;
+    if ((NULL != p_link) && (WICED_BT_SUCCESS == p_result->status))
+    {
+        app_bt_phy_stats.rssi_reads++;
+        p_link->rssi = p_result->rssi;
+        app_bt_phy_request(p_link);
+    }
+    app_bt_phy_read_next();
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_check
+********************************************************************************
+* Summary:
+*  Runs in the GATT task every APP_BT_PHY_CHECK_MS. Marks every link for
+*  measuring and starts the first read; the timer stops with the last link.
+*
+* Parameters:
+*  void *p_data: Not used
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_bt_phy_check(void *p_data)
+{
+    wiced_bool_t any = WICED_FALSE;
+    uint32_t i;
+
+    (void)p_data;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        if (0 != app_bt_phy_links[i].conn_id)
+        {
+            app_bt_phy_links[i].measure = WICED_TRUE;
+            any = WICED_TRUE;
+        }
+    }
+
+    if (any)
+    {
+        app_bt_phy_read_next();
+    }
+    else
+    {
+        xTimerStop(app_bt_phy_timer, 0);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_timer_cb
+********************************************************************************
+* Summary:
+*  Runs in the timer task and hands the check over to the GATT task, which
+*  owns the links. A check lost to a full queue is made on the next period.
+*
+* Parameters:
+*  TimerHandle_t timer: Not used
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_bt_phy_timer_cb(TimerHandle_t timer)
+{
+    (void)timer;
+
+    (void)app_bt_gatt_task_defer(app_bt_phy_check, NULL, 0);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_init
+********************************************************************************
+* Summary:
+*  Creates the check timer and clears the links and statistics.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS or WICED_BT_NO_RESOURCES
+*
+*******************************************************************************/
+wiced_result_t app_bt_phy_init(void)
+{
+    memset(app_bt_phy_links, 0, sizeof(app_bt_phy_links));
+    memset(&app_bt_phy_stats, 0, sizeof(app_bt_phy_stats));
+    app_bt_phy_reading = WICED_FALSE;
+    app_bt_phy_next = 0;
+
+    if (NULL == app_bt_phy_timer)
+    {
+        app_bt_phy_timer = xTimerCreate("Phy", pdMS_TO_TICKS(APP_BT_PHY_CHECK_MS),
+                                        pdTRUE, NULL, app_bt_phy_timer_cb);
+    }
+    return (NULL == app_bt_phy_timer) ? WICED_BT_NO_RESOURCES : WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_connected
+********************************************************************************
+* Summary:
+*  Starts tracking a new connection on the LE 1M PHY it comes up on, and
+*  measures its RSSI to pick the PHY it should move to.
+*
+* Parameters:
+*  uint16_t conn_id                  : Connection ID
+*  wiced_bt_device_address_t bd_addr : Peer address
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_phy_connected(uint16_t conn_id, wiced_bt_device_address_t bd_addr)
+{
+    app_bt_phy_link_t *p_link = app_bt_phy_link(0);
+
+    if (NULL == p_link)
+    {
+        return;
+    }
+
+    memset(p_link, 0, sizeof(*p_link));
+    memcpy(p_link->bd_addr, bd_addr, BD_ADDR_LEN);
+    p_link->tx_phy = WICED_BT_BLE_PHY_1M;
+    p_link->rx_phy = WICED_BT_BLE_PHY_1M;
+    p_link->since = xTaskGetTickCount();
+    p_link->measure = WICED_TRUE;
+    p_link->conn_id = conn_id;
+
+    app_bt_phy_read_next();
+    if (pdFALSE == xTimerIsTimerActive(app_bt_phy_timer))
+    {
+        xTimerStart(app_bt_phy_timer, 0);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_disconnected
+********************************************************************************
+* Summary:
+*  Stops tracking a connection that went down and counts the PHY it ended on.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_phy_disconnected(uint16_t conn_id)
+{
+    app_bt_phy_link_t *p_link;
+
+    if ((0 == conn_id) || (NULL == (p_link = app_bt_phy_link(conn_id))))
+    {
+        return;
+    }
+    app_bt_phy_account(p_link, xTaskGetTickCount());
+    if ((p_link->tx_phy >= WICED_BT_BLE_PHY_1M) && (p_link->tx_phy <= APP_BT_PHY_COUNT))
+    {
+        app_bt_phy_stats.ended[p_link->tx_phy - 1u]++;
+    }
+    memset(p_link, 0, sizeof(*p_link));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_updated
+********************************************************************************
+* Summary:
+*  Records the PHY the controller reports for a link (BTM_BLE_PHY_UPDATE_EVT),
+*  after an update started by either side. A PHY the peer refused, or that
+*  the update failed to reach, is remembered on the link and not asked for
+*  again while the RSSI stays in the same band.
+*
+* Parameters:
+*  wiced_bt_ble_phy_update_t *p_update: Event data from the stack
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_phy_updated(wiced_bt_ble_phy_update_t *p_update)
+{
+    app_bt_phy_link_t *p_link = app_bt_phy_link_by_addr(p_update->bd_address);
+    wiced_bool_t requested;
+
+    if (NULL == p_link)
+    {
+        return;
+    }
+
+    app_bt_phy_account(p_link, xTaskGetTickCount());
+    requested = p_link->pending;
+    p_link->pending = WICED_FALSE;
+    if (0 != p_update->status)
+    {
+        app_bt_phy_stats.failed++;
+        if (requested)
+        {
+            p_link->declined = p_link->asked;
+        }
+        return;
+    }
+
+    app_bt_phy_stats.updates++;
+    p_link->tx_phy = p_update->tx_phy;
+    p_link->rx_phy = p_update->rx_phy;
+    if (requested && (p_link->asked != p_link->tx_phy))
+    {
+        app_bt_phy_stats.declined++;
+        p_link->declined = p_link->asked;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_find
+********************************************************************************
+* Summary:
+*  Returns the PHY state of a connection, or NULL.
+*
+*******************************************************************************/
+const app_bt_phy_link_t *app_bt_phy_find(uint16_t conn_id)
+{
+    return (0 == conn_id) ? NULL : app_bt_phy_link(conn_id);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_phy_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics, with the time of the open links counted up to now.
+*
+*******************************************************************************/
+void app_bt_phy_get_stats(app_bt_phy_stats_t *p_stats)
+{
+    TickType_t now = xTaskGetTickCount();
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        if (0 != app_bt_phy_links[i].conn_id)
+        {
+            app_bt_phy_account(&app_bt_phy_links[i], now);
+        }
+    }
+    *p_stats = app_bt_phy_stats;
+}
@@ -0,0 +1,128 @@
+/******************************************************************************
+* File Name: app_bt_phy.h
+*
+* Description: LE PHY policy: RSSI thresholds for the LE 2M and LE Coded
+*              PHYs, the per-connection state and the statistics.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_PHY_H__
+#define __APP_BT_PHY_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+#include "wiced_bt_ble.h"
+#include "app_bt_conn.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* A client heard at least this strongly, in dBm, is close enough for the
+ * LE 2M PHY: half the air time per packet, shorter connection events */
+#ifndef APP_BT_PHY_2M_RSSI
+#define APP_BT_PHY_2M_RSSI              (-65)
+#endif
+
+/* A client heard this weakly or less is moved to the LE Coded PHY, which
+ * trades air time for range. Between the two thresholds a link keeps the
+ * PHY it is on, so that RSSI noise does not flip it back and forth. */
+#ifndef APP_BT_PHY_CODED_RSSI
+#define APP_BT_PHY_CODED_RSSI           (-85)
+#endif
+
+/* Coding asked for on the LE Coded PHY: BTM_BLE_PREFER_LELR_S2 or _S8 */
+#ifndef APP_BT_PHY_CODED_OPTION
+#define APP_BT_PHY_CODED_OPTION         (BTM_BLE_PREFER_LELR_S8)
+#endif
+
+/* Every link is measured again this often, as clients move */
+#ifndef APP_BT_PHY_CHECK_MS
+#define APP_BT_PHY_CHECK_MS             (10000u)
+#endif
+
+/* Statistics per PHY, indexed by WICED_BT_BLE_PHY_* - 1 */
+#define APP_BT_PHY_COUNT                (3u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* PHY state of one connection */
+typedef struct
+{
+    uint16_t                  conn_id;          /* 0 when the entry is free */
+    wiced_bt_device_address_t bd_addr;
+    wiced_bt_ble_phy_t        tx_phy;           /* In use, as reported by the controller */
+    wiced_bt_ble_phy_t        rx_phy;
+    int8_t                    rssi;             /* Last measured */
+    wiced_bool_t              measure;          /* RSSI to be read */
+    wiced_bool_t              pending;          /* PHY update requested, not reported yet */
+    wiced_bt_ble_phy_t        asked;            /* PHY of the last request */
+    wiced_bt_ble_phy_t        declined;         /* PHY the peer refused, 0 if none; not
+                                                 * asked for again until the RSSI calls
+                                                 * for another one */
+    uint32_t                  since;            /* Tick the PHY in use is counted from */
+} app_bt_phy_link_t;
+
+typedef struct
+{
+    uint32_t rssi_reads;        /* RSSI measurements completed */
+    uint32_t requests;          /* PHY updates asked for */
+    uint32_t updates;           /* PHY changes reported by the controller */
+    uint32_t failed;            /* PHY updates reported as failed */
+    uint32_t declined;          /* Updates that left the link on another PHY than asked */
+    uint32_t held;              /* Checks that did not ask again for a declined PHY */
+    uint32_t ms[APP_BT_PHY_COUNT];      /* Link time on 1M, 2M and Coded, over all links */
+    uint32_t ended[APP_BT_PHY_COUNT];   /* Connections that closed on each PHY */
+} app_bt_phy_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_result_t app_bt_phy_init(void);
+
+void app_bt_phy_connected(uint16_t conn_id, wiced_bt_device_address_t bd_addr);
+
+void app_bt_phy_disconnected(uint16_t conn_id);
+
+void app_bt_phy_updated(wiced_bt_ble_phy_update_t *p_update);
+
+const app_bt_phy_link_t *app_bt_phy_find(uint16_t conn_id);
+
+void app_bt_phy_get_stats(app_bt_phy_stats_t *p_stats);
+
+#endif      /*__APP_BT_PHY_H__ */
@@ -0,0 +1,325 @@
+/******************************************************************************
+* File Name: app_bt_pool.c
+*
+* Description: Fixed-block, size-classed buffer pool for GATT response
+*              buffers. Each class keeps a free list, so allocation and
+*              release take constant time and cannot fragment the FreeRTOS
+*              heap.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_pool.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <stdio.h>
+#include <stddef.h>
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Free blocks are chained through their first word */
+typedef struct app_bt_pool_block
+{
+    struct app_bt_pool_block *p_next;
+} app_bt_pool_block_t;
+
+typedef struct
+{
+    uint8_t             *p_start;
+    uint8_t             *p_end;
+    app_bt_pool_block_t *p_free;
+} app_bt_pool_class_t;
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static uint32_t app_bt_pool_small[(APP_BT_POOL_SMALL_BLOCK_SIZE / sizeof(uint32_t)) *
+                                  APP_BT_POOL_SMALL_BLOCK_COUNT];
+static uint32_t app_bt_pool_medium[(APP_BT_POOL_MEDIUM_BLOCK_SIZE / sizeof(uint32_t)) *
+                                   APP_BT_POOL_MEDIUM_BLOCK_COUNT];
+static uint32_t app_bt_pool_large[(APP_BT_POOL_LARGE_BLOCK_SIZE / sizeof(uint32_t)) *
+                                  APP_BT_POOL_LARGE_BLOCK_COUNT];
+
+static app_bt_pool_class_t app_bt_pool_classes[APP_BT_POOL_NUM_CLASSES];
+static app_bt_pool_stats_t app_bt_pool_stats =
+{
+    .classes =
+    {
+        { .block_size = APP_BT_POOL_SMALL_BLOCK_SIZE,  .block_count = APP_BT_POOL_SMALL_BLOCK_COUNT  },
+        { .block_size = APP_BT_POOL_MEDIUM_BLOCK_SIZE, .block_count = APP_BT_POOL_MEDIUM_BLOCK_COUNT },
+        { .block_size = APP_BT_POOL_LARGE_BLOCK_SIZE,  .block_count = APP_BT_POOL_LARGE_BLOCK_COUNT  },
+    },
+};
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/* The pool is used from the stack thread, application tasks and interrupts */
+static inline UBaseType_t app_bt_pool_lock(void)
+{
+    if (xPortIsInsideInterrupt())
+    {
+        return taskENTER_CRITICAL_FROM_ISR();
+    }
+    taskENTER_CRITICAL();
+    return 0;
+}
+
+static inline void app_bt_pool_unlock(UBaseType_t saved)
+{
+    if (xPortIsInsideInterrupt())
+    {
+        taskEXIT_CRITICAL_FROM_ISR(saved);
+    }
+    else
+    {
+        taskEXIT_CRITICAL();
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_pool_init
+********************************************************************************
+* Summary:
+*  Threads every block of every class onto its free list. Must be called once
+*  before the first allocation.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_pool_init(void)
+{
+    uint8_t *storage[APP_BT_POOL_NUM_CLASSES] =
+    {
+        (uint8_t *)app_bt_pool_small,
+        (uint8_t *)app_bt_pool_medium,
+        (uint8_t *)app_bt_pool_large,
+    };
+    uint32_t class_idx;
+    uint32_t block;
+
+    for (class_idx = 0; class_idx < APP_BT_POOL_NUM_CLASSES; class_idx++)
+    {
+        app_bt_pool_class_t *p_class = &app_bt_pool_classes[class_idx];
+        app_bt_pool_class_stats_t *p_stats = &app_bt_pool_stats.classes[class_idx];
+
+        p_class->p_start = storage[class_idx];
+        p_class->p_end   = storage[class_idx] + (p_stats->block_size * p_stats->block_count);
+        p_class->p_free  = NULL;
+
+        /* Push in reverse so blocks are handed out in address order */
+        for (block = p_stats->block_count; block > 0; block--)
+        {
+            app_bt_pool_block_t *p_block = (app_bt_pool_block_t *)
+                                           (p_class->p_start + ((block - 1u) * p_stats->block_size));
+            p_block->p_next = p_class->p_free;
+            p_class->p_free = p_block;
+        }
+        p_stats->in_use = 0;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_pool_alloc
+********************************************************************************
+* Summary:
+*  Takes a block from the smallest class that holds len bytes, or from the next
+*  larger class if that one is empty. Bounded by the number of classes.
+*
+* Parameters:
+*  uint32_t len: Number of bytes needed
+*
+* Return:
+*  void *: Block of at least len bytes, or NULL if none is available
+*
+*******************************************************************************/
+void *app_bt_pool_alloc(uint32_t len)
+{
+    app_bt_pool_block_t *p_block = NULL;
+    uint32_t class_idx;
+    uint32_t first_fit = APP_BT_POOL_NUM_CLASSES;
+    UBaseType_t saved = app_bt_pool_lock();
+
+    for (class_idx = 0; class_idx < APP_BT_POOL_NUM_CLASSES; class_idx++)
+    {
+        app_bt_pool_class_stats_t *p_stats = &app_bt_pool_stats.classes[class_idx];
+
+        if (len > p_stats->block_size)
+        {
+            continue;
+        }
+        if (APP_BT_POOL_NUM_CLASSES == first_fit)
+        {
+            first_fit = class_idx;
+        }
+
+        p_block = app_bt_pool_classes[class_idx].p_free;
+        if (NULL != p_block)
+        {
+            app_bt_pool_classes[class_idx].p_free = p_block->p_next;
+            p_stats->allocs++;
+            if (++p_stats->in_use > p_stats->high_water)
+            {
+                p_stats->high_water = p_stats->in_use;
+            }
+            if (class_idx != first_fit)
+            {
+                app_bt_pool_stats.classes[first_fit].fallbacks++;
+            }
+            break;
+        }
+    }
+
+    if (NULL == p_block)
+    {
+        if (APP_BT_POOL_NUM_CLASSES == first_fit)
+        {
+            app_bt_pool_stats.oversize++;
+        }
+        else
+        {
+            app_bt_pool_stats.exhausted++;
+        }
+    }
+
+    app_bt_pool_unlock(saved);
+    return p_block;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_pool_free
+********************************************************************************
+* Summary:
+*  Returns a block to the class it was taken from. The class is found from the
+*  address of the block, so no per-block header is needed.
+*
+* Parameters:
+*  void *p_buf: Block returned by app_bt_pool_alloc(), or NULL
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_pool_free(void *p_buf)
+{
+    uint8_t *p = (uint8_t *)p_buf;
+    uint32_t class_idx;
+    UBaseType_t saved;
+
+    if (NULL == p)
+    {
+        return;
+    }
+
+    saved = app_bt_pool_lock();
+    for (class_idx = 0; class_idx < APP_BT_POOL_NUM_CLASSES; class_idx++)
+    {
+        app_bt_pool_class_t *p_class = &app_bt_pool_classes[class_idx];
+
+        if ((p >= p_class->p_start) && (p < p_class->p_end))
+        {
+            app_bt_pool_block_t *p_block = (app_bt_pool_block_t *)p_buf;
+
+            p_block->p_next = p_class->p_free;
+            p_class->p_free = p_block;
+            app_bt_pool_stats.classes[class_idx].in_use--;
+            break;
+        }
+    }
+    app_bt_pool_unlock(saved);
+
+    /* A pointer from anywhere else is a caller bug */
+    configASSERT(class_idx < APP_BT_POOL_NUM_CLASSES);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_pool_get_stats
+********************************************************************************
+* Summary:
+*  Copies a consistent snapshot of the pool counters.
+*
+* Parameters:
+*  app_bt_pool_stats_t *p_stats: Receives the counters
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_pool_get_stats(app_bt_pool_stats_t *p_stats)
+{
+    UBaseType_t saved = app_bt_pool_lock();
+    *p_stats = app_bt_pool_stats;
+    app_bt_pool_unlock(saved);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_pool_print_stats
+********************************************************************************
+* Summary:
+*  Prints the per-class usage, high-water marks and exhaustion counters.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_pool_print_stats(void)
+{
+    app_bt_pool_stats_t stats;
+    uint32_t class_idx;
+
+    app_bt_pool_get_stats(&stats);
+    for (class_idx = 0; class_idx < APP_BT_POOL_NUM_CLASSES; class_idx++)
+    {
+        app_bt_pool_class_stats_t *p_class = &stats.classes[class_idx];
+
+        printf("Pool %3u B x %2u: in use %u, high water %u, allocs %lu, fallbacks %lu\n",
+               p_class->block_size, p_class->block_count, p_class->in_use,
+               p_class->high_water, (unsigned long)p_class->allocs,
+               (unsigned long)p_class->fallbacks);
+    }
+    printf("Pool exhausted %lu, oversize %lu\n", (unsigned long)stats.exhausted,
+           (unsigned long)stats.oversize);
+}
@@ -0,0 +1,118 @@
+/******************************************************************************
+* File Name: app_bt_pool.h
+*
+* Description: Fixed-block, size-classed buffer pool for GATT response
+*              buffers. Allocation and release are O(1) and safe from the
+*              Bluetooth stack thread, application tasks and interrupts.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_POOL_H__
+#define __APP_BT_POOL_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include <stdint.h>
+#include "cycfg_bt_settings.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Largest ATT MTU the application negotiates. Responses never exceed
+ * MTU - 1 bytes, so the largest block class is sized from this value. */
+#ifndef APP_BT_POOL_MAX_MTU
+#define APP_BT_POOL_MAX_MTU             (CY_BT_MTU_SIZE)
+#endif
+
+/* Block classes. A request is served from the smallest class that fits and
+ * falls back to larger classes when that one is empty. With a 23-byte MTU
+ * the large class is the same size as the medium one and only
+ * adds spare blocks. */
+#ifndef APP_BT_POOL_SMALL_BLOCK_COUNT
+#define APP_BT_POOL_SMALL_BLOCK_COUNT   (8u)
+#endif
+#ifndef APP_BT_POOL_MEDIUM_BLOCK_COUNT
+#define APP_BT_POOL_MEDIUM_BLOCK_COUNT  (4u)
+#endif
+#ifndef APP_BT_POOL_LARGE_BLOCK_COUNT
+#define APP_BT_POOL_LARGE_BLOCK_COUNT   (2u)
+#endif
+
+#define APP_BT_POOL_ALIGN(size)         (((size) + 3u) & ~3u)
+#define APP_BT_POOL_SMALL_BLOCK_SIZE    (32u)
+#define APP_BT_POOL_MEDIUM_BLOCK_SIZE   (64u)
+#define APP_BT_POOL_LARGE_BLOCK_SIZE    ((APP_BT_POOL_ALIGN(APP_BT_POOL_MAX_MTU) > \
+                                          APP_BT_POOL_MEDIUM_BLOCK_SIZE) ? \
+                                          APP_BT_POOL_ALIGN(APP_BT_POOL_MAX_MTU) : \
+                                          APP_BT_POOL_MEDIUM_BLOCK_SIZE)
+
+#define APP_BT_POOL_NUM_CLASSES         (3u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint16_t block_size;    /* Usable bytes per block */
+    uint16_t block_count;   /* Blocks in this class */
+    uint16_t in_use;        /* Blocks currently allocated */
+    uint16_t high_water;    /* Most blocks ever allocated at the same time */
+    uint32_t allocs;        /* Blocks handed out from this class */
+    uint32_t fallbacks;     /* Allocations that fit this class but got a larger block */
+} app_bt_pool_class_stats_t;
+
+typedef struct
+{
+    app_bt_pool_class_stats_t classes[APP_BT_POOL_NUM_CLASSES];
+    uint32_t exhausted;     /* Requests refused because every fitting class was empty */
+    uint32_t oversize;      /* Requests larger than the largest block */
+} app_bt_pool_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_pool_init(void);
+
+void *app_bt_pool_alloc(uint32_t len);
+
+void app_bt_pool_free(void *p_buf);
+
+void app_bt_pool_get_stats(app_bt_pool_stats_t *p_stats);
+
+void app_bt_pool_print_stats(void);
+
+#endif      /*__APP_BT_POOL_H__ */
@@ -0,0 +1,341 @@
+/******************************************************************************
+* File Name: app_bt_prep_write.c
+*
+* Description: Queued (long) writes: stages Prepare Write Requests in a fixed
+*              arena per connection and writes them to the GATT database on
+*              Execute Write.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_prep_write.h"
+#include <string.h>
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+/* Only used from the GATT task */
+static app_bt_prep_write_queue_t app_bt_prep_write_queues[APP_BT_CONN_MAX_CONNECTIONS];
+static app_bt_prep_write_stats_t app_bt_prep_write_stats;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_prep_write_queue
+********************************************************************************
+* Summary:
+*  Returns the queue of a connection. Passing 0 returns a free entry.
+*
+*******************************************************************************/
+static app_bt_prep_write_queue_t *app_bt_prep_write_queue(uint16_t conn_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < APP_BT_CONN_MAX_CONNECTIONS; i++)
+    {
+        if (app_bt_prep_write_queues[i].conn_id == conn_id)
+        {
+            return &app_bt_prep_write_queues[i];
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_prep_write_release
+********************************************************************************
+* Summary:
+*  Drops everything a connection has queued and frees its entry.
+*
+*******************************************************************************/
+static void app_bt_prep_write_release(app_bt_prep_write_queue_t *p_queue)
+{
+    p_queue->conn_id = 0;
+    p_queue->count = 0;
+    p_queue->used = 0;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_prep_write_check
+********************************************************************************
+* Summary:
+*  Replays the fragments of one attribute, starting at fragment 'first', and
+*  returns the length the value will have. A fragment at offset 0 starts a
+*  new value, dropping what the fragments before it wrote; any other offset
+*  continues the current value, the stored one if no fragment started a new
+*  one, and may not leave a gap behind it. With p_dest set, the fragments
+*  are also copied there.
+*
+* Parameters:
+*  app_bt_prep_write_queue_t *p_queue: Queue of the connection
+*  uint16_t first                    : First fragment of the attribute
+*  uint8_t *p_dest                   : Value to write to, or NULL to check only
+*
+* Return:
+*  int: Length of the value, -1 if a fragment starts past its end
+*
+*******************************************************************************/
+static int app_bt_prep_write_check(app_bt_prep_write_queue_t *p_queue, uint16_t first,
+                                   uint8_t *p_dest)
+{
+    app_bt_prep_write_fragment_t *p_frag = &p_queue->fragments[first];
+    gatt_db_lookup_table_t *p_attr = p_frag->p_attr;
+    int len = p_attr->cur_len;
+    uint16_t i;
+
+    for (i = first; i < p_queue->count; i++)
+    {
+        p_frag = &p_queue->fragments[i];
+        if (p_frag->p_attr != p_attr)
+        {
+            continue;
+        }
+        if (0 == p_frag->offset)
+        {
+            len = 0;
+        }
+        else if (p_frag->offset > len)
+        {
+            return -1;
+        }
+        if (NULL != p_dest)
+        {
+            memcpy(p_dest + p_frag->offset, &p_queue->arena[p_frag->at], p_frag->len);
+        }
+        len = MAX(len, p_frag->offset + p_frag->len);
+    }
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_prep_write_first
+********************************************************************************
+* Summary:
+*  Tells whether a fragment is the first one queued for its attribute.
+*
+*******************************************************************************/
+static wiced_bool_t app_bt_prep_write_first(app_bt_prep_write_queue_t *p_queue, uint16_t index)
+{
+    uint16_t i;
+
+    for (i = 0; i < index; i++)
+    {
+        if (p_queue->fragments[i].p_attr == p_queue->fragments[index].p_attr)
+        {
+            return WICED_FALSE;
+        }
+    }
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_prep_write_init
+********************************************************************************
+* Summary:
+*  Empties all queues and clears the statistics.
+*
+*******************************************************************************/
+void app_bt_prep_write_init(void)
+{
+    memset(app_bt_prep_write_queues, 0, sizeof(app_bt_prep_write_queues));
+    memset(&app_bt_prep_write_stats, 0, sizeof(app_bt_prep_write_stats));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_prep_write_add
+********************************************************************************
+* Summary:
+*  Queues a Prepare Write Request of a connection. The value is copied to the
+*  arena of the connection, where it stays until the queue is executed or
+*  dropped, so the response can echo it from there.
+*
+* Parameters:
+*  uint16_t conn_id                 : Connection ID
+*  gatt_db_lookup_table_t *p_attr   : Attribute the request writes
+*  wiced_bt_gatt_write_req_t *p_req : Handle, offset and value of the request
+*  uint8_t **pp_staged              : Receives the queued copy of the value
+*
+* Return:
+*  wiced_bt_gatt_status_t: WICED_BT_GATT_SUCCESS, WICED_BT_GATT_INVALID_OFFSET
+*                          or WICED_BT_GATT_INVALID_ATTR_LEN if the fragment
+*                          does not fit the attribute, and
+*                          WICED_BT_GATT_PREPARE_Q_FULL if it does not fit the
+*                          queue
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t app_bt_prep_write_add(uint16_t conn_id, gatt_db_lookup_table_t *p_attr,
+                                             wiced_bt_gatt_write_req_t *p_req,
+                                             uint8_t **pp_staged)
+{
+    app_bt_prep_write_queue_t *p_queue;
+    app_bt_prep_write_fragment_t *p_frag;
+
+    if (p_req->offset > p_attr->max_len)
+    {
+        app_bt_prep_write_stats.invalid++;
+        return WICED_BT_GATT_INVALID_OFFSET;
+    }
+    if ((p_req->offset + p_req->val_len) > p_attr->max_len)
+    {
+        app_bt_prep_write_stats.invalid++;
+        return WICED_BT_GATT_INVALID_ATTR_LEN;
+    }
+
+    /* A connection takes an entry with its first fragment */
+    if ((NULL == (p_queue = app_bt_prep_write_queue(conn_id))) &&
+        (NULL != (p_queue = app_bt_prep_write_queue(0))))
+    {
+        p_queue->conn_id = conn_id;
+    }
+    if ((NULL == p_queue) ||
+        (APP_BT_PREP_WRITE_MAX_FRAGMENTS == p_queue->count) ||
+        ((APP_BT_PREP_WRITE_ARENA_SIZE - p_queue->used) < p_req->val_len))
+    {
+        app_bt_prep_write_stats.queue_full++;
+        return WICED_BT_GATT_PREPARE_Q_FULL;
+    }
+
+    p_frag = &p_queue->fragments[p_queue->count++];
+    p_frag->p_attr = p_attr;
+    p_frag->offset = p_req->offset;
+    p_frag->len = p_req->val_len;
+    p_frag->at = p_queue->used;
+    memcpy(&p_queue->arena[p_frag->at], p_req->p_val, p_req->val_len);
+    p_queue->used += p_req->val_len;
+
+    app_bt_prep_write_stats.prepares++;
+    app_bt_prep_write_stats.peak_used = MAX(app_bt_prep_write_stats.peak_used, p_queue->used);
+
+    *pp_staged = &p_queue->arena[p_frag->at];
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_prep_write_execute
+********************************************************************************
+* Summary:
+*  Writes the queue of a connection to the database and empties it. All
+*  fragments are checked first, so either every attribute is written or none.
+*
+* Parameters:
+*  uint16_t conn_id        : Connection ID
+*  uint16_t *p_error_handle: Receives the handle of an attribute that fails
+*
+* Return:
+*  wiced_bt_gatt_status_t: WICED_BT_GATT_SUCCESS, or
+*                          WICED_BT_GATT_INVALID_OFFSET if a fragment would
+*                          leave a gap in a value
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t app_bt_prep_write_execute(uint16_t conn_id, uint16_t *p_error_handle)
+{
+    app_bt_prep_write_queue_t *p_queue = app_bt_prep_write_queue(conn_id);
+    gatt_db_lookup_table_t *p_attr;
+    uint16_t i;
+
+    /* An empty queue executes as a success */
+    if ((0 == conn_id) || (NULL == p_queue))
+    {
+        return WICED_BT_GATT_SUCCESS;
+    }
+
+    for (i = 0; i < p_queue->count; i++)
+    {
+        if (app_bt_prep_write_first(p_queue, i) &&
+            (0 > app_bt_prep_write_check(p_queue, i, NULL)))
+        {
+            *p_error_handle = p_queue->fragments[i].p_attr->handle;
+            app_bt_prep_write_stats.failed++;
+            app_bt_prep_write_release(p_queue);
+            return WICED_BT_GATT_INVALID_OFFSET;
+        }
+    }
+
+    for (i = 0; i < p_queue->count; i++)
+    {
+        if (app_bt_prep_write_first(p_queue, i))
+        {
+            p_attr = p_queue->fragments[i].p_attr;
+            p_attr->cur_len = (uint16_t)app_bt_prep_write_check(p_queue, i, p_attr->p_data);
+        }
+    }
+
+    app_bt_prep_write_stats.executes++;
+    app_bt_prep_write_stats.bytes += p_queue->used;
+    app_bt_prep_write_release(p_queue);
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_prep_write_cancel
+********************************************************************************
+* Summary:
+*  Drops the queue of a connection, on an Execute Write Request that cancels
+*  or when the connection goes down.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_prep_write_cancel(uint16_t conn_id)
+{
+    app_bt_prep_write_queue_t *p_queue;
+
+    if ((0 == conn_id) || (NULL == (p_queue = app_bt_prep_write_queue(conn_id))))
+    {
+        return;
+    }
+    app_bt_prep_write_stats.cancels++;
+    app_bt_prep_write_release(p_queue);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_prep_write_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics.
+*
+*******************************************************************************/
+void app_bt_prep_write_get_stats(app_bt_prep_write_stats_t *p_stats)
+{
+    *p_stats = app_bt_prep_write_stats;
+}
@@ -0,0 +1,115 @@
+/******************************************************************************
+* File Name: app_bt_prep_write.h
+*
+* Description: Queued (long) writes: per-connection staging arena for Prepare
+*              Write Requests and its statistics.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_PREP_WRITE_H__
+#define __APP_BT_PREP_WRITE_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_gatt.h"
+#include "cycfg_gatt_db.h"
+#include "app_bt_conn.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Bytes of Prepare Write values one connection can queue before it executes.
+ * The arena is static, so long writes never touch the heap. */
+#ifndef APP_BT_PREP_WRITE_ARENA_SIZE
+#define APP_BT_PREP_WRITE_ARENA_SIZE    (512u)
+#endif
+
+/* Prepare Write Requests one connection can queue */
+#ifndef APP_BT_PREP_WRITE_MAX_FRAGMENTS
+#define APP_BT_PREP_WRITE_MAX_FRAGMENTS (16u)
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* One Prepare Write Request, its value kept in the arena of the connection */
+typedef struct
+{
+    gatt_db_lookup_table_t *p_attr;     /* Attribute to write */
+    uint16_t                offset;     /* Offset of the value in the attribute */
+    uint16_t                len;
+    uint16_t                at;         /* Position of the value in the arena */
+} app_bt_prep_write_fragment_t;
+
+/* Write queue of one connection */
+typedef struct
+{
+    uint16_t                     conn_id;   /* 0 when the entry is free */
+    uint16_t                     count;     /* Fragments queued */
+    uint16_t                     used;      /* Arena bytes in use */
+    app_bt_prep_write_fragment_t fragments[APP_BT_PREP_WRITE_MAX_FRAGMENTS];
+    uint8_t                      arena[APP_BT_PREP_WRITE_ARENA_SIZE];
+} app_bt_prep_write_queue_t;
+
+typedef struct
+{
+    uint32_t prepares;          /* Fragments queued */
+    uint32_t queue_full;        /* Fragments refused for lack of room */
+    uint32_t invalid;           /* Fragments refused for their offset or length */
+    uint32_t executes;          /* Queues written to the database */
+    uint32_t failed;            /* Queues dropped at execute for a bad offset */
+    uint32_t cancels;           /* Queues dropped by the client or a disconnection */
+    uint32_t bytes;             /* Value bytes written by executes */
+    uint32_t peak_used;         /* Most arena bytes one connection had queued */
+} app_bt_prep_write_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_prep_write_init(void);
+
+wiced_bt_gatt_status_t app_bt_prep_write_add(uint16_t conn_id, gatt_db_lookup_table_t *p_attr,
+                                             wiced_bt_gatt_write_req_t *p_req,
+                                             uint8_t **pp_staged);
+
+wiced_bt_gatt_status_t app_bt_prep_write_execute(uint16_t conn_id, uint16_t *p_error_handle);
+
+void app_bt_prep_write_cancel(uint16_t conn_id);
+
+void app_bt_prep_write_get_stats(app_bt_prep_write_stats_t *p_stats);
+
+#endif      /*__APP_BT_PREP_WRITE_H__ */
@@ -0,0 +1,275 @@
+/******************************************************************************
+* File Name: app_bt_reconnect.c
+*
+* Description: Fast reconnection to the last peer. A direct connection is
+*              tried first and a scan for the peer's advertising data is
+*              started only when it times out.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_bt_reconnect.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include "timers.h"
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef enum
+{
+    APP_BT_RECONNECT_IDLE,
+    APP_BT_RECONNECT_DIRECT,            /* Direct connection to the peer pending */
+    APP_BT_RECONNECT_SCANNING,          /* Waiting for the peer to be found by a scan */
+} app_bt_reconnect_state_t;
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static TimerHandle_t               app_bt_reconnect_timer;
+static app_bt_reconnect_fallback_t app_bt_reconnect_fallback;
+static app_bt_reconnect_stats_t    app_bt_reconnect_stats;
+
+/* The peer being reconnected; the timer task and the GATT task both use it */
+static volatile app_bt_reconnect_state_t app_bt_reconnect_state;
+static wiced_bt_device_address_t   app_bt_reconnect_addr;
+static TickType_t                  app_bt_reconnect_start_tick;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_reconnect_timer_cb
+********************************************************************************
+* Summary:
+*  Runs in the timer task when the peer did not answer the direct connection
+*  in time. Cancels the connection and starts the fallback scan; the
+*  reconnection is still timed until the peer is back.
+*
+* Parameters:
+*  TimerHandle_t timer: Not used
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_bt_reconnect_timer_cb(TimerHandle_t timer)
+{
+    wiced_bool_t timed_out = WICED_FALSE;
+
+    (void)timer;
+
+    taskENTER_CRITICAL();
+    if (APP_BT_RECONNECT_DIRECT == app_bt_reconnect_state)
+    {
+        app_bt_reconnect_state = APP_BT_RECONNECT_SCANNING;
+        app_bt_reconnect_stats.timeouts++;
+        timed_out = WICED_TRUE;
+    }
+    taskEXIT_CRITICAL();
+
+    if (timed_out)
+    {
+        wiced_bt_gatt_cancel_connect(app_bt_reconnect_addr, WICED_TRUE);
+        app_bt_reconnect_fallback();
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_reconnect_init
+********************************************************************************
+* Summary:
+*  Creates the reconnection timer and clears the statistics.
+*
+* Parameters:
+*  app_bt_reconnect_fallback_t p_fallback : Starts the scan when a direct
+*                                           connection times out
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS or WICED_BT_NO_RESOURCES
+*
+*******************************************************************************/
+wiced_result_t app_bt_reconnect_init(app_bt_reconnect_fallback_t p_fallback)
+{
+    app_bt_reconnect_fallback = p_fallback;
+    app_bt_reconnect_state = APP_BT_RECONNECT_IDLE;
+    memset(&app_bt_reconnect_stats, 0, sizeof(app_bt_reconnect_stats));
+    app_bt_reconnect_stats.latency_min_ms = UINT32_MAX;
+
+    if (NULL == app_bt_reconnect_timer)
+    {
+        app_bt_reconnect_timer = xTimerCreate("Reconnect",
+                                              pdMS_TO_TICKS(APP_BT_RECONNECT_TIMEOUT_MS),
+                                              pdFALSE, NULL, app_bt_reconnect_timer_cb);
+    }
+    return (NULL == app_bt_reconnect_timer) ? WICED_BT_NO_RESOURCES : WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_reconnect_start
+********************************************************************************
+* Summary:
+*  Starts a direct connection to a peer that just disconnected, without
+*  waiting for a scan to find it. Only one direct connection runs at a time.
+*
+* Parameters:
+*  wiced_bt_device_address_t bd_addr     : Address of the peer
+*  wiced_bt_ble_address_type_t addr_type : Address type of the peer
+*
+* Return:
+*  wiced_bool_t: WICED_TRUE if the direct connection was started. On
+*                WICED_FALSE the caller scans for the peer instead.
+*
+*******************************************************************************/
+wiced_bool_t app_bt_reconnect_start(wiced_bt_device_address_t bd_addr,
+                                    wiced_bt_ble_address_type_t addr_type)
+{
+    if (APP_BT_RECONNECT_DIRECT == app_bt_reconnect_state)
+    {
+        return WICED_FALSE;
+    }
+
+    memcpy(app_bt_reconnect_addr, bd_addr, BD_ADDR_LEN);
+    app_bt_reconnect_start_tick = xTaskGetTickCount();
+    app_bt_reconnect_stats.attempts++;
+
+    if (WICED_TRUE != wiced_bt_gatt_le_connect(bd_addr, addr_type, BLE_CONN_MODE_HIGH_DUTY,
+                                               WICED_TRUE))
+    {
+        /* Still timed; the scan may find the peer */
+        app_bt_reconnect_state = APP_BT_RECONNECT_SCANNING;
+        app_bt_reconnect_stats.failed++;
+        return WICED_FALSE;
+    }
+
+    app_bt_reconnect_state = APP_BT_RECONNECT_DIRECT;
+    xTimerChangePeriod(app_bt_reconnect_timer, pdMS_TO_TICKS(APP_BT_RECONNECT_TIMEOUT_MS), 0);
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_reconnect_connected
+********************************************************************************
+* Summary:
+*  Tells the module a connection came up. If it is the peer being
+*  reconnected, the timer is stopped and the latency since the disconnection
+*  is recorded.
+*
+* Parameters:
+*  wiced_bt_device_address_t bd_addr: Address of the connected peer
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_bt_reconnect_connected(wiced_bt_device_address_t bd_addr)
+{
+    app_bt_reconnect_stats_t *p_stats = &app_bt_reconnect_stats;
+    app_bt_reconnect_state_t state;
+    uint32_t latency_ms;
+
+    if ((APP_BT_RECONNECT_IDLE == app_bt_reconnect_state) ||
+        (0 != memcmp(bd_addr, app_bt_reconnect_addr, BD_ADDR_LEN)))
+    {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    state = app_bt_reconnect_state;
+    app_bt_reconnect_state = APP_BT_RECONNECT_IDLE;
+    taskEXIT_CRITICAL();
+
+    if (APP_BT_RECONNECT_DIRECT == state)
+    {
+        xTimerStop(app_bt_reconnect_timer, 0);
+        p_stats->direct++;
+    }
+    else
+    {
+        p_stats->scanned++;
+    }
+
+    latency_ms = (uint32_t)(((uint64_t)(xTaskGetTickCount() - app_bt_reconnect_start_tick) *
+                             1000u) / configTICK_RATE_HZ);
+    p_stats->latency_last_ms = latency_ms;
+    p_stats->latency_total_ms += latency_ms;
+    if (latency_ms < p_stats->latency_min_ms)
+    {
+        p_stats->latency_min_ms = latency_ms;
+    }
+    if (latency_ms > p_stats->latency_max_ms)
+    {
+        p_stats->latency_max_ms = latency_ms;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_reconnect_is_direct
+********************************************************************************
+* Summary:
+*  Tells whether a direct connection to a peer is pending, so that a scan
+*  that finds the same peer does not start a second connection.
+*
+* Parameters:
+*  wiced_bt_device_address_t bd_addr: Address of the peer
+*
+* Return:
+*  wiced_bool_t: WICED_TRUE while the direct connection to the peer runs
+*
+*******************************************************************************/
+wiced_bool_t app_bt_reconnect_is_direct(wiced_bt_device_address_t bd_addr)
+{
+    return ((APP_BT_RECONNECT_DIRECT == app_bt_reconnect_state) &&
+            (0 == memcmp(bd_addr, app_bt_reconnect_addr, BD_ADDR_LEN))) ? WICED_TRUE : WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_reconnect_get_stats
+********************************************************************************
+* Summary:
+*  Copies the reconnection statistics. The mean latency is latency_total_ms
+*  divided by direct + scanned; latency_min_ms is UINT32_MAX until the first
+*  reconnection.
+*
+*******************************************************************************/
+void app_bt_reconnect_get_stats(app_bt_reconnect_stats_t *p_stats)
+{
+    *p_stats = app_bt_reconnect_stats;
+}
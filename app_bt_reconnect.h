@@ -0,0 +1,93 @@
+/******************************************************************************
+* File Name: app_bt_reconnect.h
+*
+* Description: Fast reconnection to the last peer with a direct connection,
+*              falling back to a scan when the peer does not answer in time.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_RECONNECT_H__
+#define __APP_BT_RECONNECT_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+#include "wiced_bt_gatt.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* How long a direct connection to the last peer may take before the
+ * application falls back to scanning for it by name */
+#ifndef APP_BT_RECONNECT_TIMEOUT_MS
+#define APP_BT_RECONNECT_TIMEOUT_MS     (2000u)
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Starts the scan that finds peers by their advertising data */
+typedef void (*app_bt_reconnect_fallback_t)(void);
+
+typedef struct
+{
+    uint32_t attempts;          /* Direct connections started */
+    uint32_t direct;            /* Peers back through the direct connection */
+    uint32_t timeouts;          /* Direct connections given up on */
+    uint32_t failed;            /* Direct connections the stack refused to start */
+    uint32_t scanned;           /* Peers back through the fallback scan */
+    uint32_t latency_min_ms;    /* Disconnection to reconnection, over all reconnections */
+    uint32_t latency_max_ms;
+    uint32_t latency_total_ms;
+    uint32_t latency_last_ms;
+} app_bt_reconnect_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_result_t app_bt_reconnect_init(app_bt_reconnect_fallback_t p_fallback);
+
+wiced_bool_t app_bt_reconnect_start(wiced_bt_device_address_t bd_addr,
+                                    wiced_bt_ble_address_type_t addr_type);
+
+void app_bt_reconnect_connected(wiced_bt_device_address_t bd_addr);
+
+wiced_bool_t app_bt_reconnect_is_direct(wiced_bt_device_address_t bd_addr);
+
+void app_bt_reconnect_get_stats(app_bt_reconnect_stats_t *p_stats);
+
+#endif      /*__APP_BT_RECONNECT_H__ */
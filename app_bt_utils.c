@@ -98,6 +98,10 @@ void print_array(void * to_print, uint16_t len)
 
 }
 
+/* In tokenized log mode the host decoder names the values, so the tables are
+ * left out of the image */
+#ifndef APP_LOG_TOKENIZED
+
 /*******************************************************************************
 * Function Name: get_btm_event_name
 ********************************************************************************
@@ -152,9 +156,7 @@ const char *get_btm_event_name(wiced_bt_management_evt_t event)
     CASE_RETURN_STR(BTM_SCO_CONNECTION_CHANGE_EVT)
     CASE_RETURN_STR(BTM_BLE_CONNECTION_PARAM_UPDATE)
     CASE_RETURN_STR(BTM_BLE_DATA_LENGTH_UPDATE_EVENT)
-#ifdef CYW20819A1
     CASE_RETURN_STR(BTM_BLE_PHY_UPDATE_EVT)
-#endif
 
     }
 
@@ -348,4 +350,6 @@ const char *get_bt_smp_status_name(wiced_bt_smp_status_t status)
 
     return "UNKNOWN_STATUS";
 }
+
+#endif /* APP_LOG_TOKENIZED */
 /* [] END OF FILE */
@@ -64,6 +64,7 @@ void print_bd_address(wiced_bt_device_address_t bdadr);
 
 void print_array(void * to_print, uint16_t len);
 
+#ifndef APP_LOG_TOKENIZED
 const char *get_btm_event_name(wiced_bt_management_evt_t event);
 
 const char *get_bt_advert_mode_name(wiced_bt_ble_advert_mode_t mode);
@@ -73,5 +74,6 @@ const char *get_bt_gatt_disconn_reason_name(wiced_bt_gatt_disconn_reason_t reaso
 const char *get_bt_gatt_status_name(wiced_bt_gatt_status_t status);
 
 const char *get_bt_smp_status_name(wiced_bt_smp_status_t status);
+#endif
 
 #endif      /*__APP_BT_UTILS_H__ */
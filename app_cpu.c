@@ -0,0 +1,397 @@
+/******************************************************************************
+* File Name: app_cpu.c
+*
+* Description: CPU statistics: samples the FreeRTOS run time of every task,
+*              counted in core cycles, and the context switches counted by
+*              the switch-in trace hook, once a window, and reports the share
+*              of the CPU each task had.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_cpu.h"
+#include "app_mem.h"
+#include "cybsp.h"
+#include <task.h>
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static TaskHandle_t     app_cpu_task_handle = NULL;
+
+/* Written by the switch-in trace hook, indexed by task number */
+static volatile uint32_t app_cpu_switch_counts[APP_CPU_MAX_TASKS];
+
+/* Only used from the sampling task */
+static app_cpu_task_t   app_cpu_tasks[APP_CPU_MAX_TASKS];
+static TaskStatus_t     app_cpu_status[APP_CPU_MAX_TASKS];
+static uint32_t         app_cpu_totals[APP_CPU_WINDOWS];
+static uint32_t         app_cpu_last_total;
+static uint32_t         app_cpu_primed;
+static app_cpu_stats_t  app_cpu_stats;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+static void app_cpu_task(void *pvParameters);
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_cpu_task
+********************************************************************************
+* Summary:
+*  Samples the run time of all tasks once a window, and prints the memory
+*  report when it is due.
+*
+*******************************************************************************/
+static void app_cpu_task(void *pvParameters)
+{
+    (void)pvParameters;
+
+    for (;;)
+    {
+        vTaskDelay(pdMS_TO_TICKS(APP_CPU_WINDOW_MS));
+        app_cpu_sample();
+        app_mem_poll();
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_find
+********************************************************************************
+* Summary:
+*  Returns the entry of a task number. Passing 0 returns a free entry.
+*
+*******************************************************************************/
+static app_cpu_task_t *app_cpu_find(uint32_t number)
+{
+    uint32_t i;
+
+    for (i = 0; i < APP_CPU_MAX_TASKS; i++)
+    {
+        if (app_cpu_tasks[i].number == number)
+        {
+            return &app_cpu_tasks[i];
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_sum
+********************************************************************************
+* Summary:
+*  Adds up the values of all windows kept.
+*
+*******************************************************************************/
+static uint32_t app_cpu_sum(const uint32_t *p_windows)
+{
+    uint32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < APP_CPU_WINDOWS; i++)
+    {
+        sum += p_windows[i];
+    }
+    return sum;
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_permille
+********************************************************************************
+* Summary:
+*  Share of part in total, in 1/1000.
+*
+*******************************************************************************/
+static uint32_t app_cpu_permille(uint32_t part, uint32_t total)
+{
+    return (0 == total) ? 0u : (uint32_t)(((uint64_t)part * 1000u) / total);
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_init
+********************************************************************************
+* Summary:
+*  Clears the statistics and creates the sampling task.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_cpu_init(void)
+{
+    memset(app_cpu_tasks, 0, sizeof(app_cpu_tasks));
+    memset(app_cpu_totals, 0, sizeof(app_cpu_totals));
+    memset(&app_cpu_stats, 0, sizeof(app_cpu_stats));
+    app_cpu_last_total = 0;
+    app_cpu_primed = 0;
+
+    if (NULL == app_cpu_task_handle)
+    {
+        if (pdPASS != xTaskCreate(app_cpu_task, "cpu_stats", APP_CPU_TASK_STACK_SIZE,
+                                  NULL, APP_CPU_TASK_PRIORITY, &app_cpu_task_handle))
+        {
+            printf("Failed to create CPU stats task! \n");
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_counter_init
+********************************************************************************
+* Summary:
+*  Starts the cycle counter that FreeRTOS counts run time with. Called by the
+*  scheduler through portCONFIGURE_TIMER_FOR_RUN_TIME_STATS(), before any task
+*  runs; the GATT task and the latency histograms read the same counter.
+*
+*******************************************************************************/
+void app_cpu_counter_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_counter
+********************************************************************************
+* Summary:
+*  Run time counter of FreeRTOS: the cycles of the core.
+*
+*******************************************************************************/
+uint32_t app_cpu_counter(void)
+{
+    return DWT->CYCCNT;
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_switched_in
+********************************************************************************
+* Summary:
+*  Counts a context switch to a task. Called by the kernel through
+*  traceTASK_SWITCHED_IN(), so it only does the increment. Task numbers that
+*  share an index share the count.
+*
+*******************************************************************************/
+void app_cpu_switched_in(uint32_t task_number)
+{
+    app_cpu_switch_counts[task_number % APP_CPU_MAX_TASKS]++;
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_sample
+********************************************************************************
+* Summary:
+*  Closes a window: takes the run time and the switches of every task since
+*  the last sample. The first sample only sets the starting point. Every
+*  APP_CPU_REPORT_WINDOWS windows the report is printed.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_cpu_sample(void)
+{
+    uint32_t slot = app_cpu_stats.windows % APP_CPU_WINDOWS;
+    TaskHandle_t idle = xTaskGetIdleTaskHandle();
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    app_cpu_task_t *p_task;
+    app_cpu_task_t *p_idle = NULL;
+    uint32_t seen[APP_CPU_MAX_TASKS];
+    uint32_t switches;
+    uint32_t count;
+    uint32_t i;
+
+    count = (uint32_t)uxTaskGetSystemState(app_cpu_status, APP_CPU_MAX_TASKS, &total);
+    if (0 == count)
+    {
+        app_cpu_stats.overflows++;
+        return;
+    }
+
+    memset(seen, 0, sizeof(seen));
+    for (i = 0; i < count; i++)
+    {
+        TaskStatus_t *p_status = &app_cpu_status[i];
+
+        /* A task takes an entry when it is first seen */
+        if ((NULL == (p_task = app_cpu_find(p_status->xTaskNumber))) &&
+            (NULL != (p_task = app_cpu_find(0))))
+        {
+            memset(p_task, 0, sizeof(*p_task));
+            p_task->number = p_status->xTaskNumber;
+            strncpy(p_task->name, p_status->pcTaskName, APP_CPU_NAME_LEN - 1u);
+            p_task->last_switches = app_cpu_switch_counts[p_task->number % APP_CPU_MAX_TASKS];
+        }
+        if (NULL == p_task)
+        {
+            continue;
+        }
+        seen[p_task - app_cpu_tasks] = 1;
+
+        switches = app_cpu_switch_counts[p_task->number % APP_CPU_MAX_TASKS];
+        p_task->priority = p_status->uxCurrentPriority;
+        p_task->cycles[slot] = (uint32_t)p_status->ulRunTimeCounter - p_task->last_run_time;
+        p_task->switches[slot] = switches - p_task->last_switches;
+        p_task->last_run_time = (uint32_t)p_status->ulRunTimeCounter;
+        p_task->last_switches = switches;
+        if (p_status->xHandle == idle)
+        {
+            p_idle = p_task;
+        }
+    }
+
+    /* Deleted tasks give their entry back */
+    app_cpu_stats.tasks = 0;
+    for (i = 0; i < APP_CPU_MAX_TASKS; i++)
+    {
+        if (!seen[i])
+        {
+            app_cpu_tasks[i].number = 0;
+        }
+        else
+        {
+            app_cpu_stats.tasks++;
+        }
+    }
+
+    app_cpu_totals[slot] = (uint32_t)total - app_cpu_last_total;
+    app_cpu_last_total = (uint32_t)total;
+    if (!app_cpu_primed)
+    {
+        /* Run time before the first sample is not part of any window */
+        for (i = 0; i < APP_CPU_MAX_TASKS; i++)
+        {
+            app_cpu_tasks[i].cycles[slot] = 0;
+            app_cpu_tasks[i].switches[slot] = 0;
+        }
+        app_cpu_totals[slot] = 0;
+        app_cpu_primed = 1;
+        return;
+    }
+
+    app_cpu_stats.windows++;
+    app_cpu_stats.switches = 0;
+    for (i = 0; i < APP_CPU_MAX_TASKS; i++)
+    {
+        if (0 != app_cpu_tasks[i].number)
+        {
+            app_cpu_stats.switches += app_cpu_sum(app_cpu_tasks[i].switches);
+        }
+    }
+    if (NULL != p_idle)
+    {
+        app_cpu_stats.idle_last = app_cpu_permille(p_idle->cycles[slot], app_cpu_totals[slot]);
+        app_cpu_stats.idle_avg = app_cpu_permille(app_cpu_sum(p_idle->cycles),
+                                                  app_cpu_sum(app_cpu_totals));
+    }
+
+    if ((0 != APP_CPU_REPORT_WINDOWS) && (0 == (app_cpu_stats.windows % APP_CPU_REPORT_WINDOWS)))
+    {
+        app_cpu_print();
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_print
+********************************************************************************
+* Summary:
+*  Prints the share of the CPU each task had in the last window and over all
+*  windows kept, and its context switches over all windows kept.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_cpu_print(void)
+{
+    uint32_t slot = (app_cpu_stats.windows + APP_CPU_WINDOWS - 1u) % APP_CPU_WINDOWS;
+    uint32_t last = app_cpu_totals[slot];
+    uint32_t span = app_cpu_sum(app_cpu_totals);
+    uint32_t kept = (app_cpu_stats.windows < APP_CPU_WINDOWS) ? app_cpu_stats.windows :
+                                                                APP_CPU_WINDOWS;
+    uint32_t last_pm;
+    uint32_t avg_pm;
+    uint32_t i;
+
+    printf("CPU: %u windows of %u ms, idle %u.%u%% (last %u.%u%%), %u switches\n",
+           (unsigned)kept, (unsigned)APP_CPU_WINDOW_MS,
+           (unsigned)(app_cpu_stats.idle_avg / 10u), (unsigned)(app_cpu_stats.idle_avg % 10u),
+           (unsigned)(app_cpu_stats.idle_last / 10u), (unsigned)(app_cpu_stats.idle_last % 10u),
+           (unsigned)app_cpu_stats.switches);
+    printf("%-16s %4s %8s %8s %9s\n", "task", "prio", "last", "avg", "switches");
+    for (i = 0; i < APP_CPU_MAX_TASKS; i++)
+    {
+        const app_cpu_task_t *p_task = &app_cpu_tasks[i];
+
+        if (0 == p_task->number)
+        {
+            continue;
+        }
+        last_pm = app_cpu_permille(p_task->cycles[slot], last);
+        avg_pm = app_cpu_permille(app_cpu_sum(p_task->cycles), span);
+        printf("%-16s %4u %5u.%u%% %5u.%u%% %9u\n", p_task->name, (unsigned)p_task->priority,
+               (unsigned)(last_pm / 10u), (unsigned)(last_pm % 10u),
+               (unsigned)(avg_pm / 10u), (unsigned)(avg_pm % 10u),
+               (unsigned)app_cpu_sum(p_task->switches));
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_cpu_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics.
+*
+*******************************************************************************/
+void app_cpu_get_stats(app_cpu_stats_t *p_stats)
+{
+    *p_stats = app_cpu_stats;
+}
@@ -0,0 +1,124 @@
+/******************************************************************************
+* File Name: app_cpu.h
+*
+* Description: CPU statistics: run time and context switches of every task
+*              over a sliding set of windows.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_CPU_H__
+#define __APP_CPU_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include <stdint.h>
+#include <FreeRTOS.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Length of one sampling window. The run time is counted in core cycles,
+ * which wrap after 2^32 cycles (about 28 s at 150 MHz), so a window must
+ * stay well below that. */
+#ifndef APP_CPU_WINDOW_MS
+#define APP_CPU_WINDOW_MS               (1000u)
+#endif
+
+/* Windows kept; the averages slide over all of them */
+#ifndef APP_CPU_WINDOWS
+#define APP_CPU_WINDOWS                 (8u)
+#endif
+
+/* Windows between two reports on the console; 0 prints only on request */
+#ifndef APP_CPU_REPORT_WINDOWS
+#define APP_CPU_REPORT_WINDOWS          (10u)
+#endif
+
+/* Tasks that can be tracked, the idle and timer tasks and those of the
+ * Bluetooth stack included */
+#ifndef APP_CPU_MAX_TASKS
+#define APP_CPU_MAX_TASKS               (12u)
+#endif
+
+#define APP_CPU_NAME_LEN                (16u)
+
+#define APP_CPU_TASK_PRIORITY           (1u)
+#define APP_CPU_TASK_STACK_SIZE         (configMINIMAL_STACK_SIZE * 4)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* One task, with its run time and context switches in each window */
+typedef struct
+{
+    uint32_t number;                        /* FreeRTOS task number; 0 when free */
+    char     name[APP_CPU_NAME_LEN];
+    uint32_t priority;
+    uint32_t last_run_time;                 /* Run time counter at the last sample */
+    uint32_t last_switches;                 /* Switch count at the last sample */
+    uint32_t cycles[APP_CPU_WINDOWS];
+    uint32_t switches[APP_CPU_WINDOWS];
+} app_cpu_task_t;
+
+typedef struct
+{
+    uint32_t windows;           /* Windows completed */
+    uint32_t tasks;             /* Tasks tracked now */
+    uint32_t overflows;         /* Samples skipped because there were too many tasks */
+    uint32_t idle_last;         /* Idle time of the last window, in 1/1000 */
+    uint32_t idle_avg;          /* Idle time over all windows kept, in 1/1000 */
+    uint32_t switches;          /* Context switches over all windows kept */
+} app_cpu_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_cpu_init(void);
+
+void app_cpu_counter_init(void);
+
+uint32_t app_cpu_counter(void);
+
+void app_cpu_switched_in(uint32_t task_number);
+
+void app_cpu_sample(void);
+
+void app_cpu_print(void);
+
+void app_cpu_get_stats(app_cpu_stats_t *p_stats);
+
+#endif      /*__APP_CPU_H__ */
@@ -0,0 +1,285 @@
+/******************************************************************************
+* File Name: app_cts_sched.c
+*
+* Description: Scheduler for the periodic Current Time notifications. A
+*              FreeRTOS software timer wakes up shortly before each due
+*              second and issues the callback as soon as the RTC rolls over,
+*              so that all subscribers get one freshly encoded value per
+*              period.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_cts_sched.h"
+#include "app_cts_time.h"
+#include "wiced_bt_types.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include "timers.h"
+#include <stddef.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define APP_CTS_SCHED_MS_PER_S          (1000u)
+#define APP_CTS_SCHED_FRACTIONS         (256)
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static TimerHandle_t          app_cts_sched_timer;
+static app_cts_sched_cback_t  app_cts_sched_cback;
+static uint32_t               app_cts_sched_period_s = APP_CTS_SCHED_PERIOD_S;
+static app_cts_sched_stats_t  app_cts_sched_stats;
+static volatile wiced_bool_t  app_cts_sched_running;
+
+/* RTC second at which the next callback is due */
+static int64_t                app_cts_sched_due;
+
+/* Set when the clock was set; the timer task makes the current second due */
+static volatile wiced_bool_t  app_cts_sched_resync_pending;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/* Re-arms the one-shot timer; safe from inside the timer callback */
+static void app_cts_sched_arm(uint32_t delay_ms)
+{
+    TickType_t ticks = pdMS_TO_TICKS(delay_ms);
+
+    xTimerChangePeriod(app_cts_sched_timer, (0u == ticks) ? 1u : ticks, 0);
+}
+
+/*******************************************************************************
+* Function Name: app_cts_sched_timer_cb
+********************************************************************************
+* Summary:
+*  Runs in the timer task. Issues the callback once the RTC reaches the due
+*  second, otherwise keeps polling for the rollover. After each callback the
+*  timer sleeps until shortly before the next due second. After a resync the
+*  current second is due at once, wherever the clock was set to.
+*
+* Parameters:
+*  TimerHandle_t timer: Not used
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_cts_sched_timer_cb(TimerHandle_t timer)
+{
+    int64_t now = app_cts_time_now();
+    int64_t now256;
+    int64_t left_ms;
+
+    (void)timer;
+
+    /* A stop can race with a callback that is already running */
+    if (!app_cts_sched_running)
+    {
+        return;
+    }
+
+    if (app_cts_sched_resync_pending)
+    {
+        app_cts_sched_resync_pending = WICED_FALSE;
+        app_cts_sched_due = now;
+        app_cts_sched_stats.resyncs++;
+    }
+
+    if (now < app_cts_sched_due)
+    {
+        app_cts_sched_stats.polls++;
+        app_cts_sched_arm(APP_CTS_SCHED_POLL_MS);
+        return;
+    }
+
+    /* A wake-up past the due second means the rollover was missed */
+    if (now > app_cts_sched_due)
+    {
+        app_cts_sched_stats.late++;
+    }
+
+    app_cts_sched_stats.ticks++;
+    app_cts_sched_cback();
+
+    /* Measured from the fraction of the second already gone, which is not
+     * zero after a resync */
+    app_cts_sched_due = now + app_cts_sched_period_s;
+    if (0 > (now256 = app_cts_time_now256()))
+    {
+        now256 = now * APP_CTS_SCHED_FRACTIONS;
+    }
+    left_ms = (((app_cts_sched_due * APP_CTS_SCHED_FRACTIONS) - now256) *
+               APP_CTS_SCHED_MS_PER_S) / APP_CTS_SCHED_FRACTIONS;
+    app_cts_sched_arm((left_ms > (int64_t)APP_CTS_SCHED_GUARD_MS) ?
+                      (uint32_t)(left_ms - APP_CTS_SCHED_GUARD_MS) : APP_CTS_SCHED_POLL_MS);
+}
+
+/*******************************************************************************
+* Function Name: app_cts_sched_init
+********************************************************************************
+* Summary:
+*  Creates the scheduler timer. The scheduler stays idle until
+*  app_cts_sched_start() is called. Seconds are taken from app_cts_time_now().
+*
+* Parameters:
+*  app_cts_sched_cback_t p_cback : Function called once per period
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS or WICED_BT_NO_RESOURCES
+*
+*******************************************************************************/
+wiced_result_t app_cts_sched_init(app_cts_sched_cback_t p_cback)
+{
+    app_cts_sched_cback = p_cback;
+
+    if (NULL == app_cts_sched_timer)
+    {
+        app_cts_sched_timer = xTimerCreate("CTS Notify",
+                                           pdMS_TO_TICKS(APP_CTS_SCHED_POLL_MS),
+                                           pdFALSE, NULL, app_cts_sched_timer_cb);
+    }
+    return (NULL == app_cts_sched_timer) ? WICED_BT_NO_RESOURCES : WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_sched_start
+********************************************************************************
+* Summary:
+*  Starts the periodic callback. The first one follows on the next RTC second
+*  rollover. Does nothing if the scheduler is already running.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, or WICED_BT_ERROR if the RTC cannot be
+*                  read or the timer cannot be started
+*
+*******************************************************************************/
+wiced_result_t app_cts_sched_start(void)
+{
+    int64_t now;
+
+    if (app_cts_sched_running)
+    {
+        return WICED_BT_SUCCESS;
+    }
+    if (0 > (now = app_cts_time_now()))
+    {
+        return WICED_BT_ERROR;
+    }
+
+    app_cts_sched_due = now + 1;
+    app_cts_sched_running = WICED_TRUE;
+    if (pdPASS != xTimerChangePeriod(app_cts_sched_timer, pdMS_TO_TICKS(APP_CTS_SCHED_POLL_MS), 0))
+    {
+        app_cts_sched_running = WICED_FALSE;
+        return WICED_BT_ERROR;
+    }
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_sched_stop
+********************************************************************************
+* Summary:
+*  Stops the periodic callback.
+*
+*******************************************************************************/
+void app_cts_sched_stop(void)
+{
+    app_cts_sched_running = WICED_FALSE;
+    xTimerStop(app_cts_sched_timer, 0);
+}
+
+/*******************************************************************************
+* Function Name: app_cts_sched_resync
+********************************************************************************
+* Summary:
+*  Issues the callback right away and counts the next period from there. Call
+*  it after the clock was set: a due second from before the change may be far
+*  in the future or already past. Does nothing while the scheduler is stopped.
+*
+*******************************************************************************/
+void app_cts_sched_resync(void)
+{
+    if (!app_cts_sched_running)
+    {
+        return;
+    }
+    app_cts_sched_resync_pending = WICED_TRUE;
+    xTimerChangePeriod(app_cts_sched_timer, 1u, 0);
+}
+
+/*******************************************************************************
+* Function Name: app_cts_sched_set_period
+********************************************************************************
+* Summary:
+*  Changes the number of seconds between callbacks. Takes effect after the
+*  next callback.
+*
+* Parameters:
+*  uint32_t period_s: 1 to APP_CTS_SCHED_PERIOD_MAX_S seconds
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS or WICED_BT_BADARG
+*
+*******************************************************************************/
+wiced_result_t app_cts_sched_set_period(uint32_t period_s)
+{
+    if ((0u == period_s) || (APP_CTS_SCHED_PERIOD_MAX_S < period_s))
+    {
+        return WICED_BT_BADARG;
+    }
+    app_cts_sched_period_s = period_s;
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_sched_get_stats
+********************************************************************************
+* Summary:
+*  Copies the scheduler counters.
+*
+*******************************************************************************/
+void app_cts_sched_get_stats(app_cts_sched_stats_t *p_stats)
+{
+    *p_stats = app_cts_sched_stats;
+}
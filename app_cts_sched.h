@@ -0,0 +1,99 @@
+/******************************************************************************
+* File Name: app_cts_sched.h
+*
+* Description: Scheduler for the periodic Current Time notifications. Fires
+*              on the RTC second rollover at a configurable period.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_CTS_SCHED_H__
+#define __APP_CTS_SCHED_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_result.h"
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Seconds between two Current Time notifications */
+#ifndef APP_CTS_SCHED_PERIOD_S
+#define APP_CTS_SCHED_PERIOD_S          (1u)
+#endif
+#define APP_CTS_SCHED_PERIOD_MAX_S      (3600u)
+
+/* The RTC only counts whole seconds. The timer wakes up this early before
+ * the expected rollover and then polls the RTC at APP_CTS_SCHED_POLL_MS until
+ * the second changes, which also absorbs drift between the RTC and the tick. */
+#ifndef APP_CTS_SCHED_GUARD_MS
+#define APP_CTS_SCHED_GUARD_MS          (20u)
+#endif
+#ifndef APP_CTS_SCHED_POLL_MS
+#define APP_CTS_SCHED_POLL_MS           (2u)
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Called once per period, right after the RTC second rolled over */
+typedef void (*app_cts_sched_cback_t)(void);
+
+typedef struct
+{
+    uint32_t ticks;         /* Callbacks issued */
+    uint32_t late;          /* Wake-ups that found the rollover already passed */
+    uint32_t polls;         /* RTC reads spent waiting for the rollover */
+    uint32_t resyncs;       /* Callbacks issued at once after the clock was set */
+} app_cts_sched_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_result_t app_cts_sched_init(app_cts_sched_cback_t p_cback);
+
+wiced_result_t app_cts_sched_start(void);
+
+void app_cts_sched_stop(void);
+
+void app_cts_sched_resync(void);
+
+wiced_result_t app_cts_sched_set_period(uint32_t period_s);
+
+void app_cts_sched_get_stats(app_cts_sched_stats_t *p_stats);
+
+#endif      /*__APP_CTS_SCHED_H__ */
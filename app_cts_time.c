@@ -0,0 +1,648 @@
+/******************************************************************************
+* File Name: app_cts_time.c
+*
+* Description: Current Time engine. Combines the 1 Hz RTC with the FreeRTOS
+*              tick into a monotonic time with 1/256 s resolution, keeps the
+*              Current Time value encoded from it, and marks adjustments with
+*              the Adjust Reason bits.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_cts_time.h"
+#include "app_cts_sched.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define DAYS_PER_WEEK                   (7u)
+#define SECONDS_PER_DAY                 (86400L)
+#define FRACTIONS_PER_SECOND            (256u)
+#define MS_PER_SECOND                   (1000u)
+
+/* Structure tm stores years since 1900 */
+#define TM_YEAR_BASE                    (1900u)
+
+/* 1970-01-01 was a Thursday (4 with Monday = 1) */
+#define EPOCH_DAY_OF_WEEK               (4)
+
+/* Range of a known Current Time value; Year 0 and Month 0 mean unknown */
+#define CTS_YEAR_MIN                    (1582)
+#define CTS_YEAR_MAX                    (9999)
+#define CTS_DAY_OF_WEEK_MAX             (7u)
+
+/* Local Time Information counts both offsets in 15 minute steps */
+#define LTI_SECONDS_PER_STEP            (900L)
+#define LTI_TIME_ZONE_MIN               (-48)
+#define LTI_TIME_ZONE_MAX               (56)
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static cyhal_rtc_t          *app_cts_time_rtc;
+static uint8_t              *app_cts_time_payload;
+static app_cts_time_stats_t  app_cts_time_stats;
+
+/* The RTC second app_cts_time_anchor_sec began at app_cts_time_anchor_tick.
+ * The tick count since then gives the fraction of the second. */
+static int64_t               app_cts_time_anchor_sec = -1;
+static TickType_t            app_cts_time_anchor_tick;
+static wiced_bool_t          app_cts_time_synced;
+
+/* Last engine time handed out, in 1/256 s; time never runs backwards
+ * except through app_cts_time_set() */
+static int64_t               app_cts_time_last256;
+
+/* Time zone plus DST offset applied to the encoded local time */
+static int32_t               app_cts_time_tz_s;
+static int32_t               app_cts_time_dst_s;
+
+/* Adjust Reason bits waiting for the next encoded second. While held they
+ * stay in the payload until app_cts_time_clear_reason(). */
+static uint8_t               app_cts_time_pending_reason;
+static wiced_bool_t          app_cts_time_reason_held;
+
+/* Local second and day the payload currently holds */
+static int64_t               app_cts_time_encoded_sec = -1;
+static int64_t               app_cts_time_encoded_day = -1;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/* Days since 1970-01-01 of a civil date, month 1..12 */
+static int64_t app_cts_time_days_from_civil(int32_t year, int32_t month, int32_t day)
+{
+    int32_t era;
+    int32_t yoe;
+    int32_t doy;
+    int32_t doe;
+
+    /* March is the first month of the computational year */
+    year -= (month <= 2) ? 1 : 0;
+    era   = ((year >= 0) ? year : (year - 399)) / 400;
+    yoe   = year - (era * 400);
+    doy   = ((153 * (month + ((month > 2) ? -3 : 9))) + 2) / 5 + day - 1;
+    doe   = (yoe * 365) + (yoe / 4) - (yoe / 100) + doy;
+
+    return ((int64_t)era * 146097) + doe - 719468;
+}
+
+/* Civil date of a day count since 1970-01-01; the inverse of the above */
+static void app_cts_time_civil_from_days(int64_t days, int32_t *p_year, uint8_t *p_month,
+                                         uint8_t *p_day)
+{
+    int64_t  z   = days + 719468;
+    int64_t  era = ((z >= 0) ? z : (z - 146096)) / 146097;
+    uint32_t doe = (uint32_t)(z - (era * 146097));
+    uint32_t yoe = (doe - (doe / 1460) + (doe / 36524) - (doe / 146096)) / 365;
+    uint32_t doy = doe - ((365 * yoe) + (yoe / 4) - (yoe / 100));
+    uint32_t mp  = ((5 * doy) + 2) / 153;
+    uint32_t month = (mp < 10) ? (mp + 3) : (mp - 9);
+
+    *p_day   = (uint8_t)(doy - (((153 * mp) + 2) / 5) + 1);
+    *p_month = (uint8_t)month;
+    *p_year  = (int32_t)(yoe + (era * 400) + ((month <= 2) ? 1 : 0));
+}
+
+/* Floor division, so that times before 1970 still map to the right day */
+static int64_t app_cts_time_floor_div(int64_t value, int64_t divisor)
+{
+    int64_t quotient = value / divisor;
+
+    return ((value % divisor) < 0) ? (quotient - 1) : quotient;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_sample
+********************************************************************************
+* Summary:
+*  Reads the RTC and returns the engine time. When the RTC second has moved on
+*  since the last sample, the current tick becomes the start of that second.
+*  Sampling often, as the notification scheduler does around each rollover,
+*  keeps the fractions accurate to the polling interval.
+*
+* Parameters:
+*  int64_t *p_rtc_sec: Receives the RTC time in seconds since 1970-01-01
+*
+* Return:
+*  int64_t: Engine time in 1/256 s since 1970-01-01, or -1 if the RTC cannot
+*           be read
+*
+*******************************************************************************/
+static int64_t app_cts_time_sample(int64_t *p_rtc_sec)
+{
+    struct tm date_time;
+    int64_t rtc_sec;
+    int64_t now256;
+    uint32_t elapsed_ms;
+    uint32_t fraction;
+
+    if (CY_RSLT_SUCCESS != cyhal_rtc_read(app_cts_time_rtc, &date_time))
+    {
+        return -1;
+    }
+
+    rtc_sec = (app_cts_time_days_from_civil(date_time.tm_year + TM_YEAR_BASE,
+                                            date_time.tm_mon + 1,
+                                            date_time.tm_mday) * SECONDS_PER_DAY) +
+              (date_time.tm_hour * 3600) + (date_time.tm_min * 60) + date_time.tm_sec;
+
+    taskENTER_CRITICAL();
+
+    if (rtc_sec != app_cts_time_anchor_sec)
+    {
+        /* Only a change seen from the previous second marks a real edge */
+        app_cts_time_synced = (rtc_sec == (app_cts_time_anchor_sec + 1)) ? WICED_TRUE :
+                                                                          WICED_FALSE;
+        app_cts_time_anchor_sec  = rtc_sec;
+        app_cts_time_anchor_tick = xTaskGetTickCount();
+    }
+
+    /* The tick is not disciplined by the RTC; stay inside the RTC second */
+    elapsed_ms = (uint32_t)(((uint64_t)(xTaskGetTickCount() - app_cts_time_anchor_tick) *
+                             MS_PER_SECOND) / configTICK_RATE_HZ);
+    fraction   = (elapsed_ms >= MS_PER_SECOND) ? FRACTIONS_PER_SECOND :
+                 ((elapsed_ms * FRACTIONS_PER_SECOND) / MS_PER_SECOND);
+    if (fraction >= FRACTIONS_PER_SECOND)
+    {
+        fraction = FRACTIONS_PER_SECOND - 1u;
+    }
+
+    now256 = (rtc_sec * FRACTIONS_PER_SECOND) + fraction;
+    if (now256 < app_cts_time_last256)
+    {
+        now256 = app_cts_time_last256;
+    }
+    app_cts_time_last256 = now256;
+
+    taskEXIT_CRITICAL();
+
+    *p_rtc_sec = rtc_sec;
+    return now256;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_init
+********************************************************************************
+* Summary:
+*  Binds the time engine to the RTC and to the buffer that holds the Current
+*  Time value, and encodes the current time into it.
+*
+* Parameters:
+*  cyhal_rtc_t *p_rtc  : Initialized RTC
+*  uint8_t *p_payload  : APP_CTS_TIME_PAYLOAD_LEN bytes, normally the GATT DB
+*                        value of the Current Time characteristic
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_cts_time_init(cyhal_rtc_t *p_rtc, uint8_t *p_payload)
+{
+    app_cts_time_rtc            = p_rtc;
+    app_cts_time_payload        = p_payload;
+    app_cts_time_anchor_sec     = -1;
+    app_cts_time_synced         = WICED_FALSE;
+    app_cts_time_last256        = 0;
+    app_cts_time_pending_reason = 0;
+    app_cts_time_encoded_sec    = -1;
+    app_cts_time_encoded_day    = -1;
+    app_cts_time_update();
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_now
+********************************************************************************
+* Summary:
+*  Returns the current RTC time in whole seconds since 1970-01-01. Each call
+*  also lets the engine catch the start of a new second.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  int64_t: Seconds since the epoch, or -1 if the RTC cannot be read
+*
+*******************************************************************************/
+int64_t app_cts_time_now(void)
+{
+    int64_t rtc_sec;
+
+    return (0 > app_cts_time_sample(&rtc_sec)) ? -1 : rtc_sec;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_now256
+********************************************************************************
+* Summary:
+*  Returns the monotonic engine time with sub-second resolution. Until the
+*  first observed RTC rollover the fraction is relative to the first sample.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  int64_t: Time in 1/256 s since 1970-01-01, or -1 if the RTC cannot be read
+*
+*******************************************************************************/
+int64_t app_cts_time_now256(void)
+{
+    int64_t rtc_sec;
+
+    return app_cts_time_sample(&rtc_sec);
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_set
+********************************************************************************
+* Summary:
+*  Sets the RTC and the engine to a new time. The next encoded value carries
+*  the given Adjust Reason, which lets clients tell the jump from a tick.
+*  Writing the RTC restarts its second, so the fraction cannot run past the
+*  end of that second until the next rollover is observed. The notification
+*  scheduler is resynced, which sends the adjusted time right away.
+*
+* Parameters:
+*  int64_t epoch          : New time in seconds since 1970-01-01, not negative
+*  uint8_t fractions256   : Fraction of the second, 1/256 s
+*  uint8_t adjust_reason  : APP_CTS_TIME_ADJUST_MANUAL and/or
+*                           APP_CTS_TIME_ADJUST_EXTERNAL
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, WICED_BT_BADARG, or WICED_BT_ERROR if the
+*                  RTC write fails
+*
+*******************************************************************************/
+wiced_result_t app_cts_time_set(int64_t epoch, uint8_t fractions256, uint8_t adjust_reason)
+{
+    struct tm date_time;
+    int64_t days = app_cts_time_floor_div(epoch, SECONDS_PER_DAY);
+    int32_t sod  = (int32_t)(epoch - (days * SECONDS_PER_DAY));
+    int32_t year;
+    uint8_t month;
+    uint8_t day;
+
+    if (0 > epoch)
+    {
+        return WICED_BT_BADARG;
+    }
+
+    app_cts_time_civil_from_days(days, &year, &month, &day);
+    memset(&date_time, 0, sizeof(date_time));
+    date_time.tm_year = year - TM_YEAR_BASE;
+    date_time.tm_mon  = month - 1;
+    date_time.tm_mday = day;
+    date_time.tm_hour = sod / 3600;
+    date_time.tm_min  = (sod / 60) % 60;
+    date_time.tm_sec  = sod % 60;
+    date_time.tm_wday = (int)((days + EPOCH_DAY_OF_WEEK) % DAYS_PER_WEEK);
+
+    if (CY_RSLT_SUCCESS != cyhal_rtc_write(app_cts_time_rtc, &date_time))
+    {
+        return WICED_BT_ERROR;
+    }
+
+    taskENTER_CRITICAL();
+    app_cts_time_anchor_sec  = epoch;
+    app_cts_time_anchor_tick = xTaskGetTickCount() -
+                               pdMS_TO_TICKS(((uint32_t)fractions256 * MS_PER_SECOND) /
+                                             FRACTIONS_PER_SECOND);
+    app_cts_time_synced      = WICED_FALSE;
+    app_cts_time_last256     = (epoch * FRACTIONS_PER_SECOND) + fractions256;
+    app_cts_time_pending_reason |= adjust_reason;
+    app_cts_time_encoded_sec = -1;
+    app_cts_time_stats.adjustments++;
+    taskEXIT_CRITICAL();
+
+    app_cts_time_update();
+    app_cts_sched_resync();
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_decode
+********************************************************************************
+* Summary:
+*  Decodes a Current Time value written by a client into the time to give
+*  app_cts_time_set(). The value holds local time, so the current time zone
+*  and DST offsets are taken off. The date has to exist; Day of Week may be
+*  0 (unknown) and is otherwise ignored, since it follows from the date.
+*
+* Parameters:
+*  const uint8_t *p_payload : APP_CTS_TIME_PAYLOAD_LEN bytes
+*  int64_t *p_epoch         : Receives the time in seconds since 1970-01-01
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, or WICED_BT_BADARG if a field is out of
+*                  range
+*
+*******************************************************************************/
+wiced_result_t app_cts_time_decode(const uint8_t *p_payload, int64_t *p_epoch)
+{
+    int32_t year = (int32_t)p_payload[APP_CTS_TIME_YEAR_LSB] |
+                   ((int32_t)p_payload[APP_CTS_TIME_YEAR_MSB] << 8);
+    uint8_t month = p_payload[APP_CTS_TIME_MONTH];
+    uint8_t day   = p_payload[APP_CTS_TIME_DAY];
+    int64_t days;
+    int32_t check_year;
+    uint8_t check_month;
+    uint8_t check_day;
+
+    if ((CTS_YEAR_MIN > year) || (CTS_YEAR_MAX < year) || (1u > month) || (12u < month) ||
+        (1u > day) || (24u <= p_payload[APP_CTS_TIME_HOURS]) ||
+        (60u <= p_payload[APP_CTS_TIME_MINUTES]) || (60u <= p_payload[APP_CTS_TIME_SECONDS]) ||
+        (CTS_DAY_OF_WEEK_MAX < p_payload[APP_CTS_TIME_DAY_OF_WEEK]))
+    {
+        return WICED_BT_BADARG;
+    }
+
+    /* A day past the end of the month comes back as a date in the next one */
+    days = app_cts_time_days_from_civil(year, month, day);
+    app_cts_time_civil_from_days(days, &check_year, &check_month, &check_day);
+    if ((check_month != month) || (check_day != day))
+    {
+        return WICED_BT_BADARG;
+    }
+
+    taskENTER_CRITICAL();
+    *p_epoch = (days * SECONDS_PER_DAY) + (p_payload[APP_CTS_TIME_HOURS] * 3600L) +
+               (p_payload[APP_CTS_TIME_MINUTES] * 60L) + p_payload[APP_CTS_TIME_SECONDS] -
+               app_cts_time_tz_s - app_cts_time_dst_s;
+    taskEXIT_CRITICAL();
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_decode_local_info
+********************************************************************************
+* Summary:
+*  Decodes a Local Time Information value into the offsets to give
+*  app_cts_time_set_local_offset(). The unknown values, -128 for the time
+*  zone and 255 for DST, are refused like any other value out of range.
+*
+* Parameters:
+*  const uint8_t *p_info : APP_CTS_TIME_LTI_LEN bytes
+*  int32_t *p_tz_s       : Receives the time zone offset in seconds
+*  int32_t *p_dst_s      : Receives the DST offset in seconds
+*
+* Return:
+*  wiced_result_t: WICED_BT_SUCCESS, or WICED_BT_BADARG if a field is out of
+*                  range
+*
+*******************************************************************************/
+wiced_result_t app_cts_time_decode_local_info(const uint8_t *p_info, int32_t *p_tz_s,
+                                              int32_t *p_dst_s)
+{
+    int32_t tz  = (int8_t)p_info[APP_CTS_TIME_LTI_TIME_ZONE];
+    uint8_t dst = p_info[APP_CTS_TIME_LTI_DST_OFFSET];
+
+    /* DST is standard time, +0.5 h, +1 h or +2 h */
+    if ((LTI_TIME_ZONE_MIN > tz) || (LTI_TIME_ZONE_MAX < tz) ||
+        ((0u != dst) && (2u != dst) && (4u != dst) && (8u != dst)))
+    {
+        return WICED_BT_BADARG;
+    }
+
+    *p_tz_s  = tz * LTI_SECONDS_PER_STEP;
+    *p_dst_s = dst * LTI_SECONDS_PER_STEP;
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_set_local_offset
+********************************************************************************
+* Summary:
+*  Sets the time zone and DST offsets of the encoded local time. A change of
+*  either sets the matching Adjust Reason bit in the next encoded value, which
+*  the resynced notification scheduler sends right away.
+*
+* Parameters:
+*  int32_t tz_s   : Time zone offset from UTC in seconds
+*  int32_t dst_s  : DST offset in seconds
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_cts_time_set_local_offset(int32_t tz_s, int32_t dst_s)
+{
+    taskENTER_CRITICAL();
+    if (tz_s != app_cts_time_tz_s)
+    {
+        app_cts_time_pending_reason |= APP_CTS_TIME_ADJUST_TIME_ZONE;
+    }
+    if (dst_s != app_cts_time_dst_s)
+    {
+        app_cts_time_pending_reason |= APP_CTS_TIME_ADJUST_DST;
+    }
+    app_cts_time_tz_s        = tz_s;
+    app_cts_time_dst_s       = dst_s;
+    app_cts_time_encoded_sec = -1;
+    taskEXIT_CRITICAL();
+
+    app_cts_time_update();
+    app_cts_sched_resync();
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_update
+********************************************************************************
+* Summary:
+*  Brings the payload up to the current engine time. Fractions256 is always
+*  refreshed. Within the same local day only the time of day is rewritten;
+*  the date and day of the week are derived from the day count again only
+*  when the day changes. A pending Adjust Reason goes out with the first
+*  second after the adjustment. It is cleared on the following one, or, while
+*  held, once app_cts_time_clear_reason() reports it sent.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  wiced_bool_t: WICED_TRUE if the encoded second changed
+*
+*******************************************************************************/
+wiced_bool_t app_cts_time_update(void)
+{
+    int64_t rtc_sec;
+    int64_t now256 = app_cts_time_sample(&rtc_sec);
+    int64_t local;
+    int64_t days;
+    int32_t sod;
+
+    if (0 > now256)
+    {
+        return WICED_FALSE;
+    }
+
+    /* Readers may send the payload from another task */
+    taskENTER_CRITICAL();
+
+    app_cts_time_payload[APP_CTS_TIME_FRACTIONS256] = (uint8_t)(now256 % FRACTIONS_PER_SECOND);
+
+    local = (now256 / FRACTIONS_PER_SECOND) + app_cts_time_tz_s + app_cts_time_dst_s;
+    if (local == app_cts_time_encoded_sec)
+    {
+        taskEXIT_CRITICAL();
+        return WICED_FALSE;
+    }
+
+    days = app_cts_time_floor_div(local, SECONDS_PER_DAY);
+    sod  = (int32_t)(local - (days * SECONDS_PER_DAY));
+
+    if (days == app_cts_time_encoded_day)
+    {
+        app_cts_time_stats.incremental++;
+    }
+    else
+    {
+        int32_t year;
+        uint8_t month;
+        uint8_t day;
+
+        app_cts_time_civil_from_days(days, &year, &month, &day);
+        app_cts_time_payload[APP_CTS_TIME_YEAR_LSB]    = (uint8_t)(year & 0xFF);
+        app_cts_time_payload[APP_CTS_TIME_YEAR_MSB]    = (uint8_t)(year >> 8);
+        app_cts_time_payload[APP_CTS_TIME_MONTH]       = month;
+        app_cts_time_payload[APP_CTS_TIME_DAY]         = day;
+        app_cts_time_payload[APP_CTS_TIME_DAY_OF_WEEK] =
+            (uint8_t)((((days + EPOCH_DAY_OF_WEEK - 1) % DAYS_PER_WEEK) + DAYS_PER_WEEK) %
+                      DAYS_PER_WEEK + 1);
+        app_cts_time_encoded_day = days;
+        app_cts_time_stats.full++;
+    }
+
+    app_cts_time_payload[APP_CTS_TIME_HOURS]   = (uint8_t)(sod / 3600);
+    app_cts_time_payload[APP_CTS_TIME_MINUTES] = (uint8_t)((sod / 60) % 60);
+    app_cts_time_payload[APP_CTS_TIME_SECONDS] = (uint8_t)(sod % 60);
+
+    app_cts_time_payload[APP_CTS_TIME_ADJUST_REASON] = app_cts_time_pending_reason;
+    if (!app_cts_time_reason_held)
+    {
+        app_cts_time_pending_reason = 0;
+    }
+
+    app_cts_time_encoded_sec = local;
+    app_cts_time_stats.updates++;
+
+    taskEXIT_CRITICAL();
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_hold_reason
+********************************************************************************
+* Summary:
+*  Keeps the Adjust Reason in the payload until app_cts_time_clear_reason()
+*  instead of clearing it on the next second. Hold it while a notification
+*  will carry the value; a longer notification period would otherwise never
+*  send the reason. Releasing the hold clears a held reason on the next
+*  second.
+*
+* Parameters:
+*  wiced_bool_t hold: WICED_TRUE to hold the Adjust Reason
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_cts_time_hold_reason(wiced_bool_t hold)
+{
+    taskENTER_CRITICAL();
+    app_cts_time_reason_held = hold;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_clear_reason
+********************************************************************************
+* Summary:
+*  Clears the Adjust Reason once a value that carries it has been sent.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_cts_time_clear_reason(void)
+{
+    taskENTER_CRITICAL();
+    app_cts_time_pending_reason = 0;
+    app_cts_time_payload[APP_CTS_TIME_ADJUST_REASON] = 0;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_get_payload
+********************************************************************************
+* Summary:
+*  Copies the encoded payload as a whole, so that a copy never mixes two
+*  seconds.
+*
+* Parameters:
+*  uint8_t *p_payload: Receives APP_CTS_TIME_PAYLOAD_LEN bytes
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_cts_time_get_payload(uint8_t *p_payload)
+{
+    taskENTER_CRITICAL();
+    memcpy(p_payload, app_cts_time_payload, APP_CTS_TIME_PAYLOAD_LEN);
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: app_cts_time_get_stats
+********************************************************************************
+* Summary:
+*  Copies the time engine counters.
+*
+*******************************************************************************/
+void app_cts_time_get_stats(app_cts_time_stats_t *p_stats)
+{
+    *p_stats = app_cts_time_stats;
+    p_stats->synced = app_cts_time_synced;
+}
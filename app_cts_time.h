@@ -0,0 +1,122 @@
+/******************************************************************************
+* File Name: app_cts_time.h
+*
+* Description: Current Time engine. Provides a monotonic time with 1/256 s
+*              resolution and keeps the Current Time characteristic value
+*              encoded from it, rewriting only the fields that change.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_CTS_TIME_H__
+#define __APP_CTS_TIME_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "cyhal.h"
+#include "wiced_bt_types.h"
+#include "wiced_result.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Layout of the Current Time characteristic value */
+#define APP_CTS_TIME_YEAR_LSB           (0u)
+#define APP_CTS_TIME_YEAR_MSB           (1u)
+#define APP_CTS_TIME_MONTH              (2u)
+#define APP_CTS_TIME_DAY                (3u)
+#define APP_CTS_TIME_HOURS              (4u)
+#define APP_CTS_TIME_MINUTES            (5u)
+#define APP_CTS_TIME_SECONDS            (6u)
+#define APP_CTS_TIME_DAY_OF_WEEK        (7u)
+#define APP_CTS_TIME_FRACTIONS256       (8u)
+#define APP_CTS_TIME_ADJUST_REASON      (9u)
+#define APP_CTS_TIME_PAYLOAD_LEN        (10u)
+
+/* Layout of the Local Time Information characteristic value */
+#define APP_CTS_TIME_LTI_TIME_ZONE      (0u)
+#define APP_CTS_TIME_LTI_DST_OFFSET     (1u)
+#define APP_CTS_TIME_LTI_LEN            (2u)
+
+/* Adjust Reason bits of the Current Time characteristic */
+#define APP_CTS_TIME_ADJUST_MANUAL      (0x01u)
+#define APP_CTS_TIME_ADJUST_EXTERNAL    (0x02u)
+#define APP_CTS_TIME_ADJUST_TIME_ZONE   (0x04u)
+#define APP_CTS_TIME_ADJUST_DST         (0x08u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t updates;       /* Calls that found a new second */
+    uint32_t incremental;   /* Updates that only rewrote the time of day */
+    uint32_t full;          /* Updates that re-encoded the date as well */
+    uint32_t adjustments;   /* Calls to app_cts_time_set() */
+    wiced_bool_t synced;    /* Fractions are measured from an observed RTC rollover */
+} app_cts_time_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_cts_time_init(cyhal_rtc_t *p_rtc, uint8_t *p_payload);
+
+int64_t app_cts_time_now(void);
+
+int64_t app_cts_time_now256(void);
+
+wiced_result_t app_cts_time_set(int64_t epoch, uint8_t fractions256, uint8_t adjust_reason);
+
+wiced_result_t app_cts_time_decode(const uint8_t *p_payload, int64_t *p_epoch);
+
+wiced_result_t app_cts_time_decode_local_info(const uint8_t *p_info, int32_t *p_tz_s,
+                                              int32_t *p_dst_s);
+
+void app_cts_time_set_local_offset(int32_t tz_s, int32_t dst_s);
+
+wiced_bool_t app_cts_time_update(void);
+
+void app_cts_time_hold_reason(wiced_bool_t hold);
+
+void app_cts_time_clear_reason(void);
+
+void app_cts_time_get_payload(uint8_t *p_payload);
+
+void app_cts_time_get_stats(app_cts_time_stats_t *p_stats);
+
+#endif      /*__APP_CTS_TIME_H__ */
@@ -0,0 +1,215 @@
+/******************************************************************************
+* File Name: app_gatt_db_index.h
+*
+* Description: Handle-indexed lookup into the application's GATT attribute
+*              table. The index itself is generated at build time from
+*              cycfg_gatt_db.c.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_GATT_DB_INDEX_H__
+#define __APP_GATT_DB_INDEX_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include "cycfg_gatt_db.h"
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* An attribute of the type index: its handle and its entry in the attribute
+ * table */
+typedef struct
+{
+    uint16_t handle;
+    uint16_t entry;
+} app_gatt_db_type_handle_t;
+
+/* All attributes of one 16-bit type: a run of count entries in the handle
+ * list, starting at first and sorted by handle */
+typedef struct
+{
+    uint16_t uuid;
+    uint16_t first;
+    uint16_t count;
+} app_gatt_db_type_t;
+
+/******************************************************************************
+ *                                EXTERNS
+ ******************************************************************************/
+/* Generated at build time by scripts/gen_gatt_db_index.py from the
+ * app_gatt_db_ext_attr_tbl in cycfg_gatt_db.c. Entry [handle] holds the index
+ * of that handle's table entry plus one, or 0 if the handle has no entry. */
+extern const uint16_t app_gatt_db_handle_index[];
+extern const uint16_t app_gatt_db_handle_index_size;
+
+/* Generated the same way: the types of the attributes in
+ * app_gatt_db_ext_attr_tbl sorted by value, each with its handles in
+ * app_gatt_db_type_handles. Only 16-bit types are indexed. */
+extern const app_gatt_db_type_t        app_gatt_db_types[];
+extern const uint16_t                  app_gatt_db_types_size;
+extern const app_gatt_db_type_handle_t app_gatt_db_type_handles[];
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_gatt_db_index_find
+********************************************************************************
+* Summary:
+*  Resolves a handle through a dense handle index into its attribute table
+*  entry. The cost is one bounds check and two array reads regardless of the
+*  size of the table.
+*
+* Parameters:
+*  const uint16_t *p_index          : Handle index (see app_gatt_db_handle_index)
+*  uint16_t index_size              : Number of entries in p_index
+*  gatt_db_lookup_table_t *p_table  : Attribute table the index refers to
+*  uint16_t handle                  : Handle to look up
+*
+* Return:
+*  gatt_db_lookup_table_t *: Matching table entry, or NULL if none
+*
+*******************************************************************************/
+static inline gatt_db_lookup_table_t *app_gatt_db_index_find(const uint16_t *p_index,
+                                                             uint16_t index_size,
+                                                             gatt_db_lookup_table_t *p_table,
+                                                             uint16_t handle)
+{
+    uint16_t slot;
+
+    if (handle >= index_size)
+    {
+        return NULL;
+    }
+    slot = p_index[handle];
+    return (0u == slot) ? NULL : &p_table[slot - 1u];
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_db_type_find
+********************************************************************************
+* Summary:
+*  Finds the attributes of a 16-bit type within a handle range through a type
+*  index: one binary search for the type, two for the ends of the range. The
+*  matches are consecutive entries in handle order.
+*
+* Parameters:
+*  const app_gatt_db_type_t *p_types               : Types (see app_gatt_db_types)
+*  uint16_t types_size                             : Number of entries in p_types
+*  const app_gatt_db_type_handle_t *p_handles      : Handles the types refer to
+*  uint16_t uuid                                   : Type to look for
+*  uint16_t s_handle                               : First handle of the range
+*  uint16_t e_handle                               : Last handle of the range
+*  uint16_t *p_count                               : Receives the number of matches
+*
+* Return:
+*  const app_gatt_db_type_handle_t *: First match, or NULL if none
+*
+*******************************************************************************/
+static inline const app_gatt_db_type_handle_t *app_gatt_db_type_find(
+    const app_gatt_db_type_t *p_types, uint16_t types_size,
+    const app_gatt_db_type_handle_t *p_handles, uint16_t uuid, uint16_t s_handle,
+    uint16_t e_handle, uint16_t *p_count)
+{
+    const app_gatt_db_type_handle_t *p_first;
+    uint16_t count;
+    uint16_t lo = 0;
+    uint16_t hi = types_size;
+    uint16_t mid;
+
+    *p_count = 0;
+    while (lo < hi)
+    {
+        mid = (uint16_t)((lo + hi) / 2u);
+        if (p_types[mid].uuid < uuid)
+        {
+            lo = (uint16_t)(mid + 1u);
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if ((lo >= types_size) || (p_types[lo].uuid != uuid))
+    {
+        return NULL;
+    }
+    p_first = &p_handles[p_types[lo].first];
+    count = p_types[lo].count;
+
+    /* First handle at or after s_handle */
+    lo = 0;
+    hi = count;
+    while (lo < hi)
+    {
+        mid = (uint16_t)((lo + hi) / 2u);
+        if (p_first[mid].handle < s_handle)
+        {
+            lo = (uint16_t)(mid + 1u);
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    p_first += lo;
+    count = (uint16_t)(count - lo);
+
+    /* First handle after e_handle */
+    lo = 0;
+    hi = count;
+    while (lo < hi)
+    {
+        mid = (uint16_t)((lo + hi) / 2u);
+        if (p_first[mid].handle <= e_handle)
+        {
+            lo = (uint16_t)(mid + 1u);
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    *p_count = lo;
+    return (0u == lo) ? NULL : p_first;
+}
+
+#endif      /*__APP_GATT_DB_INDEX_H__ */
@@ -0,0 +1,279 @@
+/******************************************************************************
+* File Name: app_latency.c
+*
+* Description: Latency histograms: fixed log2 buckets of cycle counts per
+*              path, with p50, p99 and the longest latency.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_latency.h"
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static const char *const app_latency_names[APP_LATENCY_PATHS] =
+{
+    [APP_LATENCY_GATT_MTU]            = "mtu",
+    [APP_LATENCY_GATT_READ]           = "read",
+    [APP_LATENCY_GATT_READ_BLOB]      = "read_blob",
+    [APP_LATENCY_GATT_READ_BY_TYPE]   = "read_by_type",
+    [APP_LATENCY_GATT_READ_MULTI]     = "read_multi",
+    [APP_LATENCY_GATT_READ_MULTI_VAR] = "read_multi_var",
+    [APP_LATENCY_GATT_WRITE]          = "write",
+    [APP_LATENCY_GATT_WRITE_CMD]      = "write_cmd",
+    [APP_LATENCY_GATT_PREPARE_WRITE]  = "prepare_write",
+    [APP_LATENCY_GATT_EXECUTE_WRITE]  = "execute_write",
+    [APP_LATENCY_GATT_CONFIRM]        = "confirm",
+    [APP_LATENCY_GATT_OTHER]          = "other",
+    [APP_LATENCY_GATT_QUEUE]          = "gatt_queue",
+    [APP_LATENCY_NOTIFY]              = "notify",
+    [APP_LATENCY_BUTTON]              = "button",
+};
+
+static app_latency_hist_t app_latency_hists[APP_LATENCY_PATHS];
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_latency_bucket
+********************************************************************************
+* Summary:
+*  Bucket of a latency: the number of bits it takes, up to the last bucket.
+*
+*******************************************************************************/
+static uint32_t app_latency_bucket(uint32_t cycles)
+{
+    uint32_t bucket = (0 == cycles) ? 0u : (32u - (uint32_t)APP_LATENCY_CLZ(cycles));
+
+    return (bucket < APP_LATENCY_BUCKETS) ? bucket : (APP_LATENCY_BUCKETS - 1u);
+}
+
+/*******************************************************************************
+* Function Name: app_latency_gatt_path
+********************************************************************************
+* Summary:
+*  Path an attribute request opcode is recorded under.
+*
+*******************************************************************************/
+static app_latency_path_t app_latency_gatt_path(wiced_bt_gatt_opcode_t opcode)
+{
+    switch (opcode)
+    {
+        case GATT_REQ_MTU:                   return APP_LATENCY_GATT_MTU;
+        case GATT_REQ_READ:                  return APP_LATENCY_GATT_READ;
+        case GATT_REQ_READ_BLOB:             return APP_LATENCY_GATT_READ_BLOB;
+        case GATT_REQ_READ_BY_TYPE:          return APP_LATENCY_GATT_READ_BY_TYPE;
+        case GATT_REQ_READ_MULTI:            return APP_LATENCY_GATT_READ_MULTI;
+        case GATT_REQ_READ_MULTI_VAR_LENGTH: return APP_LATENCY_GATT_READ_MULTI_VAR;
+        case GATT_REQ_WRITE:                 return APP_LATENCY_GATT_WRITE;
+        case GATT_CMD_WRITE:                 return APP_LATENCY_GATT_WRITE_CMD;
+        case GATT_REQ_PREPARE_WRITE:         return APP_LATENCY_GATT_PREPARE_WRITE;
+        case GATT_REQ_EXECUTE_WRITE:         return APP_LATENCY_GATT_EXECUTE_WRITE;
+        case GATT_HANDLE_VALUE_CONF:         return APP_LATENCY_GATT_CONFIRM;
+        default:                             return APP_LATENCY_GATT_OTHER;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_latency_record
+********************************************************************************
+* Summary:
+*  Adds a latency to the histogram of a path. Cheap enough for every request:
+*  a count of leading zeros and a few increments.
+*
+* Parameters:
+*  app_latency_path_t path: Path timed
+*  uint32_t cycles: Latency, in app_cpu_counter() units
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_latency_record(app_latency_path_t path, uint32_t cycles)
+{
+    app_latency_hist_t *p_hist = &app_latency_hists[path];
+
+    p_hist->count++;
+    p_hist->sum += cycles;
+    if (cycles > p_hist->max)
+    {
+        p_hist->max = cycles;
+    }
+    p_hist->buckets[app_latency_bucket(cycles)]++;
+}
+
+/*******************************************************************************
+* Function Name: app_latency_since
+********************************************************************************
+* Summary:
+*  Records the time since start on a path.
+*
+* Parameters:
+*  app_latency_path_t path: Path timed
+*  uint32_t start: app_cpu_counter() when the path was entered
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_latency_since(app_latency_path_t path, uint32_t start)
+{
+    app_latency_record(path, app_cpu_counter() - start);
+}
+
+/*******************************************************************************
+* Function Name: app_latency_gatt
+********************************************************************************
+* Summary:
+*  Records the time since start on the path of an attribute request opcode.
+*
+* Parameters:
+*  wiced_bt_gatt_opcode_t opcode: Opcode of the request
+*  uint32_t start: app_cpu_counter() when the request was taken up
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_latency_gatt(wiced_bt_gatt_opcode_t opcode, uint32_t start)
+{
+    app_latency_since(app_latency_gatt_path(opcode), start);
+}
+
+/*******************************************************************************
+* Function Name: app_latency_percentile
+********************************************************************************
+* Summary:
+*  Latency that percent of the samples do not exceed, as the upper bound of
+*  the bucket it falls in, and never more than the longest seen.
+*
+* Parameters:
+*  const app_latency_hist_t *p_hist: Histogram
+*  uint32_t percent: 1 to 100
+*
+* Return:
+*  uint32_t: Latency, in app_cpu_counter() units; 0 if there are no samples
+*
+*******************************************************************************/
+uint32_t app_latency_percentile(const app_latency_hist_t *p_hist, uint32_t percent)
+{
+    uint32_t rank = (uint32_t)((((uint64_t)p_hist->count * percent) + 99u) / 100u);
+    uint32_t seen = 0;
+    uint32_t bound;
+    uint32_t i;
+
+    if (0 == p_hist->count)
+    {
+        return 0;
+    }
+    for (i = 0; i < (APP_LATENCY_BUCKETS - 1u); i++)
+    {
+        seen += p_hist->buckets[i];
+        if (seen >= rank)
+        {
+            bound = (0 == i) ? 0u : (uint32_t)((1ull << i) - 1u);
+            return (bound < p_hist->max) ? bound : p_hist->max;
+        }
+    }
+    return p_hist->max;
+}
+
+/*******************************************************************************
+* Function Name: app_latency_print
+********************************************************************************
+* Summary:
+*  Prints the count, p50, p99, longest and mean latency of every path that
+*  has samples.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_latency_print(void)
+{
+    uint32_t i;
+
+    printf("Latency (%s; p50 and p99 are log2 bucket bounds)\n", APP_LATENCY_UNIT);
+    printf("%-16s %8s %10s %10s %10s %10s\n", "path", "count", "p50", "p99", "max", "mean");
+    for (i = 0; i < APP_LATENCY_PATHS; i++)
+    {
+        const app_latency_hist_t *p_hist = &app_latency_hists[i];
+
+        if (0 == p_hist->count)
+        {
+            continue;
+        }
+        printf("%-16s %8u %10u %10u %10u %10u\n", app_latency_names[i],
+               (unsigned)p_hist->count,
+               (unsigned)app_latency_percentile(p_hist, 50u),
+               (unsigned)app_latency_percentile(p_hist, 99u),
+               (unsigned)p_hist->max,
+               (unsigned)(p_hist->sum / p_hist->count));
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_latency_reset
+********************************************************************************
+* Summary:
+*  Clears all histograms, to measure from a known point.
+*
+*******************************************************************************/
+void app_latency_reset(void)
+{
+    memset(app_latency_hists, 0, sizeof(app_latency_hists));
+}
+
+/*******************************************************************************
+* Function Name: app_latency_get_hist
+********************************************************************************
+* Summary:
+*  Copies the histogram of a path.
+*
+*******************************************************************************/
+void app_latency_get_hist(app_latency_path_t path, app_latency_hist_t *p_hist)
+{
+    *p_hist = app_latency_hists[path];
+}
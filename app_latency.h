@@ -0,0 +1,132 @@
+/******************************************************************************
+* File Name: app_latency.h
+*
+* Description: Latency histograms: log2 histograms of the time spent on each
+*              attribute request opcode, the notification fan-out and the
+*              button wakeup.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_LATENCY_H__
+#define __APP_LATENCY_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_gatt.h"
+#include "app_cpu.h"
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Unit of app_cpu_counter(), which the latencies are taken with, for the
+ * report. The host's stand-in counts nanoseconds. */
+#ifndef APP_LATENCY_UNIT
+#define APP_LATENCY_UNIT                "cycles"
+#endif
+
+/* Buckets of each histogram. Bucket 0 counts latencies of 0, bucket n those
+ * from 2^(n-1) to 2^n - 1, and the last one everything longer: 2^22 cycles
+ * and up, 28 ms at 150 MHz, with the default. */
+#ifndef APP_LATENCY_BUCKETS
+#define APP_LATENCY_BUCKETS             (24u)
+#endif
+
+/* 1: every button press prints the histograms after starting the scan */
+#ifndef APP_LATENCY_DUMP_ON_BUTTON
+#define APP_LATENCY_DUMP_ON_BUTTON      (1)
+#endif
+
+#if defined (__ICCARM__)
+#define APP_LATENCY_CLZ(x)              __CLZ(x)
+#else
+#define APP_LATENCY_CLZ(x)              __builtin_clz(x)
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Paths timed: one per attribute request opcode the server handles, the
+ * wait of a request in the GATT task queue, the Current Time fan-out, and
+ * the button interrupt to the button task */
+typedef enum
+{
+    APP_LATENCY_GATT_MTU,
+    APP_LATENCY_GATT_READ,
+    APP_LATENCY_GATT_READ_BLOB,
+    APP_LATENCY_GATT_READ_BY_TYPE,
+    APP_LATENCY_GATT_READ_MULTI,
+    APP_LATENCY_GATT_READ_MULTI_VAR,
+    APP_LATENCY_GATT_WRITE,
+    APP_LATENCY_GATT_WRITE_CMD,
+    APP_LATENCY_GATT_PREPARE_WRITE,
+    APP_LATENCY_GATT_EXECUTE_WRITE,
+    APP_LATENCY_GATT_CONFIRM,
+    APP_LATENCY_GATT_OTHER,
+    APP_LATENCY_GATT_QUEUE,
+    APP_LATENCY_NOTIFY,
+    APP_LATENCY_BUTTON,
+    APP_LATENCY_PATHS
+} app_latency_path_t;
+
+/* Histogram of one path. Each path is recorded from one task at a time. */
+typedef struct
+{
+    uint32_t count;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t buckets[APP_LATENCY_BUCKETS];
+} app_latency_hist_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_latency_record(app_latency_path_t path, uint32_t cycles);
+
+void app_latency_since(app_latency_path_t path, uint32_t start);
+
+void app_latency_gatt(wiced_bt_gatt_opcode_t opcode, uint32_t start);
+
+uint32_t app_latency_percentile(const app_latency_hist_t *p_hist, uint32_t percent);
+
+void app_latency_print(void);
+
+void app_latency_reset(void);
+
+void app_latency_get_hist(app_latency_path_t path, app_latency_hist_t *p_hist);
+
+#endif      /*__APP_LATENCY_H__ */
@@ -0,0 +1,391 @@
+/******************************************************************************
+* File Name: app_log.c
+*
+* Description: Deferred logging. A bounded lock-free ring with multiple
+*              producers and one consumer holds compact log records; a low-
+*              priority task formats and prints them, counting records
+*              dropped while the ring was full.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_log.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef APP_LOG_TOKENIZED
+#include "cyhal.h"
+#include "cy_retarget_io.h"
+#endif
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define APP_LOG_RING_MASK               (APP_LOG_RING_SIZE - 1u)
+
+#if (0u != (APP_LOG_RING_SIZE & APP_LOG_RING_MASK))
+#error "APP_LOG_RING_SIZE must be a power of two"
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* A slot is free for the producer that claims position seq, and holds a
+ * record for the consumer once seq equals that position plus one. */
+typedef struct
+{
+    atomic_uint_fast32_t seq;
+    app_log_record_t     record;
+} app_log_slot_t;
+
+typedef struct
+{
+#ifndef APP_LOG_TOKENIZED
+    const char *p_fmt;
+#endif
+    uint8_t     nargs;
+    uint8_t     names;                  /* app_log_name_t */
+} app_log_event_info_t;
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static app_log_slot_t       app_log_ring[APP_LOG_RING_SIZE];
+static atomic_uint_fast32_t app_log_head;       /* Next position to claim */
+static uint32_t             app_log_tail;       /* Next position to drain; drain task only */
+static atomic_uint_fast32_t app_log_dropped;
+static atomic_uint_fast32_t app_log_written;
+static uint32_t             app_log_drained;
+static uint32_t             app_log_high_water;
+static uint32_t             app_log_dropped_reported;
+
+static TaskHandle_t         app_log_task_handle;
+
+static const app_log_event_info_t app_log_events[APP_LOG_EVENT_COUNT] =
+{
+#ifdef APP_LOG_TOKENIZED
+#define APP_LOG_EVENT(id, nargs, names, fmt) [id] = { nargs, names },
+#else
+#define APP_LOG_EVENT(id, nargs, names, fmt) [id] = { fmt, nargs, names },
+#endif
+#include "app_log_events.h"
+#undef APP_LOG_EVENT
+};
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+#ifdef APP_LOG_TOKENIZED
+/*******************************************************************************
+* Function Name: app_log_put_varint
+********************************************************************************
+* Summary:
+*  Encodes a value as an unsigned LEB128 varint: seven bits per byte, low
+*  bits first, the top bit set on every byte but the last.
+*
+* Parameters:
+*  uint8_t *p_buf : Room for APP_LOG_VARINT_MAX_LEN bytes
+*  uint32_t value : Value to encode
+*
+* Return:
+*  uint32_t: Number of bytes written
+*
+*******************************************************************************/
+static uint32_t app_log_put_varint(uint8_t *p_buf, uint32_t value)
+{
+    uint32_t len = 0;
+
+    while (value >= 0x80u)
+    {
+        p_buf[len++] = (uint8_t)(value | 0x80u);
+        value >>= 7;
+    }
+    p_buf[len++] = (uint8_t)value;
+    return len;
+}
+#endif
+
+/*******************************************************************************
+* Function Name: app_log_emit
+********************************************************************************
+* Summary:
+*  Outputs one record: as text, or as a binary frame in tokenized mode.
+*
+* Parameters:
+*  const app_log_record_t *p_record: Record to output; the id must be valid
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_log_emit(const app_log_record_t *p_record)
+{
+    const app_log_event_info_t *p_event = &app_log_events[p_record->id];
+#ifdef APP_LOG_TOKENIZED
+    uint8_t frame[APP_LOG_FRAME_MAX_LEN];
+    uint32_t len = 0;
+    uint32_t i;
+
+    frame[len++] = APP_LOG_FRAME_SYNC;
+    frame[len++] = (uint8_t)(p_record->id & 0xFFu);
+    frame[len++] = (uint8_t)(p_record->id >> 8);
+    len += app_log_put_varint(&frame[len], p_record->timestamp);
+    for (i = 0; i < p_event->nargs; i++)
+    {
+        len += app_log_put_varint(&frame[len], p_record->args[i]);
+    }
+
+    /* Same blocking byte path as retarget-io, without the formatting */
+    for (i = 0; i < len; i++)
+    {
+        cyhal_uart_putc(&cy_retarget_io_uart_obj, frame[i]);
+    }
+#else
+    printf("[%6lu] ", (unsigned long)p_record->timestamp);
+    app_log_format(p_event->p_fmt, (app_log_name_t)p_event->names, p_record->args,
+                   p_event->nargs);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: app_log_task
+********************************************************************************
+* Summary:
+*  Low-priority task that periodically prints the logged records, so the
+*  UART is never written from a Bluetooth stack callback or an interrupt.
+*
+* Parameters:
+*  void *pvParameters: Not used
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+static void app_log_task(void *pvParameters)
+{
+    (void)pvParameters;
+
+    for (;;)
+    {
+        vTaskDelay(pdMS_TO_TICKS(APP_LOG_DRAIN_PERIOD_MS));
+        app_log_drain();
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_init
+********************************************************************************
+* Summary:
+*  Empties the ring and creates the drain task. Call before the first log.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_log_init(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < APP_LOG_RING_SIZE; i++)
+    {
+        atomic_init(&app_log_ring[i].seq, i);
+    }
+    atomic_init(&app_log_head, 0);
+    atomic_init(&app_log_dropped, 0);
+    atomic_init(&app_log_written, 0);
+    app_log_tail = 0;
+    app_log_drained = 0;
+    app_log_high_water = 0;
+    app_log_dropped_reported = 0;
+
+    if (NULL == app_log_task_handle)
+    {
+        if (pdPASS != xTaskCreate(app_log_task, "log_task", APP_LOG_TASK_STACK_SIZE,
+                                  NULL, APP_LOG_TASK_PRIORITY, &app_log_task_handle))
+        {
+            printf("Failed to create log task! \n");
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_write
+********************************************************************************
+* Summary:
+*  Stores one record. Any number of tasks and interrupts may log at the same
+*  time: a producer claims a position with a compare-and-swap on the head and
+*  publishes the record through the slot sequence number. When the ring is
+*  full the record is counted as dropped instead of waiting.
+*
+* Parameters:
+*  app_log_event_t id     : Event to log
+*  const uint32_t *p_args : APP_LOG_MAX_ARGS arguments, or NULL for none
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_log_write(app_log_event_t id, const uint32_t *p_args)
+{
+    uint_fast32_t pos = atomic_load_explicit(&app_log_head, memory_order_relaxed);
+    app_log_slot_t *p_slot;
+
+    for (;;)
+    {
+        int32_t diff;
+
+        p_slot = &app_log_ring[pos & APP_LOG_RING_MASK];
+        diff = (int32_t)(atomic_load_explicit(&p_slot->seq, memory_order_acquire) - pos);
+        if (0 == diff)
+        {
+            /* On failure pos is reloaded with the current head */
+            if (atomic_compare_exchange_weak_explicit(&app_log_head, &pos, pos + 1u,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (0 > diff)
+        {
+            /* The slot still holds a record from one lap ago */
+            atomic_fetch_add_explicit(&app_log_dropped, 1u, memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&app_log_head, memory_order_relaxed);
+        }
+    }
+
+    p_slot->record.timestamp = xPortIsInsideInterrupt() ? xTaskGetTickCountFromISR() :
+                                                          xTaskGetTickCount();
+    p_slot->record.id = (uint16_t)id;
+    if (NULL != p_args)
+    {
+        memcpy(p_slot->record.args, p_args, sizeof(p_slot->record.args));
+    }
+
+    atomic_store_explicit(&p_slot->seq, pos + 1u, memory_order_release);
+    atomic_fetch_add_explicit(&app_log_written, 1u, memory_order_relaxed);
+}
+
+/*******************************************************************************
+* Function Name: app_log_drain
+********************************************************************************
+* Summary:
+*  Outputs every record published so far, then the number of records dropped
+*  since the last report. Must only be called from one context at a time;
+*  normally this is the drain task.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  uint32_t: Number of records output
+*
+*******************************************************************************/
+uint32_t app_log_drain(void)
+{
+    uint32_t count = 0;
+    uint32_t waiting = (uint32_t)(atomic_load_explicit(&app_log_head, memory_order_relaxed) -
+                                  app_log_tail);
+    uint32_t dropped;
+
+    if (waiting > app_log_high_water)
+    {
+        app_log_high_water = waiting;
+    }
+
+    for (;;)
+    {
+        app_log_slot_t *p_slot = &app_log_ring[app_log_tail & APP_LOG_RING_MASK];
+        app_log_record_t record;
+
+        /* Stop at the first position that is claimed but not yet published */
+        if (atomic_load_explicit(&p_slot->seq, memory_order_acquire) != (app_log_tail + 1u))
+        {
+            break;
+        }
+
+        record = p_slot->record;
+        atomic_store_explicit(&p_slot->seq, app_log_tail + APP_LOG_RING_SIZE,
+                              memory_order_release);
+        app_log_tail++;
+
+        if (record.id < APP_LOG_EVENT_COUNT)
+        {
+            app_log_emit(&record);
+        }
+        count++;
+    }
+    app_log_drained += count;
+
+    dropped = (uint32_t)atomic_load_explicit(&app_log_dropped, memory_order_relaxed);
+    if (dropped != app_log_dropped_reported)
+    {
+        app_log_record_t record = { 0 };
+
+        record.timestamp = xTaskGetTickCount();
+        record.id = APP_LOG_DROPPED;
+        record.args[0] = dropped - app_log_dropped_reported;
+        app_log_emit(&record);
+        app_log_dropped_reported = dropped;
+    }
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: app_log_get_stats
+********************************************************************************
+* Summary:
+*  Copies the log counters.
+*
+*******************************************************************************/
+void app_log_get_stats(app_log_stats_t *p_stats)
+{
+    p_stats->written    = (uint32_t)atomic_load(&app_log_written);
+    p_stats->dropped    = (uint32_t)atomic_load(&app_log_dropped);
+    p_stats->drained    = app_log_drained;
+    p_stats->high_water = app_log_high_water;
+}
@@ -0,0 +1,146 @@
+/******************************************************************************
+* File Name: app_log.h
+*
+* Description: Deferred logging. Callbacks and interrupts store compact
+*              records in a lock-free ring; a low-priority task formats and
+*              prints them.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_LOG_H__
+#define __APP_LOG_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Records the ring holds; must be a power of two */
+#ifndef APP_LOG_RING_SIZE
+#define APP_LOG_RING_SIZE               (32u)
+#endif
+
+/* How often the drain task empties the ring */
+#ifndef APP_LOG_DRAIN_PERIOD_MS
+#define APP_LOG_DRAIN_PERIOD_MS         (20u)
+#endif
+
+#define APP_LOG_TASK_PRIORITY           (1u)
+#define APP_LOG_TASK_STACK_SIZE         (configMINIMAL_STACK_SIZE * 4)
+
+#define APP_LOG_MAX_ARGS                (6u)
+
+/* Log an event with up to APP_LOG_MAX_ARGS uint32_t arguments. Never blocks,
+ * safe from tasks and interrupts. */
+#define APP_LOG(id, ...)                app_log_write((id), \
+                                            (const uint32_t[APP_LOG_MAX_ARGS]){ __VA_ARGS__ })
+#define APP_LOG0(id)                    app_log_write((id), NULL)
+
+/* The six arguments of a BD address */
+#define APP_LOG_BDA(bda)                (bda)[0], (bda)[1], (bda)[2], (bda)[3], (bda)[4], (bda)[5]
+
+/* Tokenized mode (APP_LOG_TOKENIZED): the drain task writes binary frames
+ * straight to the debug UART instead of formatting text, and the format
+ * strings and name tables are left out of the image. A frame is
+ *   APP_LOG_FRAME_SYNC, token (uint16_t, little endian), timestamp, arguments
+ * where the token is the position of the event in app_log_events.h and the
+ * timestamp and each argument are unsigned LEB128 varints. The host tool
+ * host/log_decode turns the stream back into text using the token database
+ * that scripts/gen_log_token_db.py generates at build time. Plain text
+ * printed outside the log passes through the decoder unchanged. */
+#define APP_LOG_FRAME_SYNC              (0xA5u)
+#define APP_LOG_VARINT_MAX_LEN          (5u)
+#define APP_LOG_FRAME_MAX_LEN           (3u + (APP_LOG_VARINT_MAX_LEN * (1u + APP_LOG_MAX_ARGS)))
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* How a %s conversion names its argument */
+typedef enum
+{
+    APP_LOG_NAME_NONE,                  /* No %s in the format */
+    APP_LOG_NAME_BTM_EVENT,             /* wiced_bt_management_evt_t */
+    APP_LOG_NAME_GATT_STATUS,           /* wiced_bt_gatt_status_t */
+    APP_LOG_NAME_DISCONN_REASON,        /* wiced_bt_gatt_disconn_reason_t */
+    APP_LOG_NAME_SMP_STATUS,            /* wiced_bt_smp_status_t */
+    APP_LOG_NAME_ADVERT_MODE,           /* wiced_bt_ble_advert_mode_t */
+} app_log_name_t;
+
+typedef enum
+{
+#define APP_LOG_EVENT(id, nargs, names, fmt) id,
+#include "app_log_events.h"
+#undef APP_LOG_EVENT
+    APP_LOG_EVENT_COUNT
+} app_log_event_t;
+
+typedef struct
+{
+    uint32_t timestamp;                 /* RTOS tick when the event was logged */
+    uint16_t id;                        /* app_log_event_t */
+    uint16_t reserved;
+    uint32_t args[APP_LOG_MAX_ARGS];
+} app_log_record_t;
+
+typedef struct
+{
+    uint32_t written;                   /* Records stored in the ring */
+    uint32_t dropped;                   /* Records lost because the ring was full */
+    uint32_t drained;                   /* Records printed by the drain task */
+    uint32_t high_water;                /* Most records waiting at the same time */
+} app_log_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_log_init(void);
+
+void app_log_write(app_log_event_t id, const uint32_t *p_args);
+
+uint32_t app_log_drain(void);
+
+void app_log_get_stats(app_log_stats_t *p_stats);
+
+/* Text formatting, app_log_format.c; not built in tokenized mode */
+const char *app_log_name(app_log_name_t names, uint32_t value);
+
+void app_log_format(const char *p_fmt, app_log_name_t names, const uint32_t *p_args,
+                    uint8_t nargs);
+
+#endif      /*__APP_LOG_H__ */
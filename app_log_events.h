@@ -0,0 +1,91 @@
+/******************************************************************************
+* File Name: app_log_events.h
+*
+* Description: Events of the deferred log. Each entry gives the event ID, its
+*              number of arguments and the format the drain task prints it
+*              with.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* No include guard: included once per expansion of APP_LOG_EVENT.
+ *
+ * APP_LOG_EVENT(id, number of arguments, name table, printf format)
+ * Arguments are uint32_t. A BD address takes six arguments, one per byte.
+ * A %s conversion prints its argument through the name table (app_log_name_t),
+ * so a status code is logged as a number and named by whoever formats it.
+ * Append new events at the end: in tokenized builds the position is the token.
+ */
+APP_LOG_EVENT(APP_LOG_SCAN_STATE_HIGH_DUTY,  0, APP_LOG_NAME_NONE,            "Scan State Change: BTM_BLE_SCAN_TYPE_HIGH_DUTY\n")
+APP_LOG_EVENT(APP_LOG_SCAN_STATE_LOW_DUTY,   0, APP_LOG_NAME_NONE,            "Scan State Change: BTM_BLE_SCAN_TYPE_LOW_DUTY\n")
+APP_LOG_EVENT(APP_LOG_SCAN_STATE_STOPPED,    0, APP_LOG_NAME_NONE,            "Scan stopped\n")
+APP_LOG_EVENT(APP_LOG_SCAN_STATE_INVALID,    0, APP_LOG_NAME_NONE,            "Invalid scan state\n")
+APP_LOG_EVENT(APP_LOG_SCAN_PEER_FOUND,       6, APP_LOG_NAME_NONE,            "\nFound the peer device! BD Addr: %02X:%02X:%02X:%02X:%02X:%02X \n")
+APP_LOG_EVENT(APP_LOG_SCAN_OFF_FAILED,       1, APP_LOG_NAME_NONE,            "\r\nscan off status %d\n")
+APP_LOG_EVENT(APP_LOG_SCAN_COMPLETED,        0, APP_LOG_NAME_NONE,            "Scan completed\n\n")
+APP_LOG_EVENT(APP_LOG_SCAN_CONNECTING,       0, APP_LOG_NAME_NONE,            "Initiating connection\n")
+APP_LOG_EVENT(APP_LOG_SCAN_CONNECT_FAILED,   0, APP_LOG_NAME_NONE,            "\rwiced_bt_gatt_connect failed\n")
+APP_LOG_EVENT(APP_LOG_SCAN_OTHER_DEVICE,     6, APP_LOG_NAME_NONE,            "BD Addr: %02X:%02X:%02X:%02X:%02X:%02X \n")
+APP_LOG_EVENT(APP_LOG_GATT_WRITE_INVALID,    1, APP_LOG_NAME_NONE,            "Write Request to Invalid Handle: 0x%x\n")
+APP_LOG_EVENT(APP_LOG_GATT_READ,             2, APP_LOG_NAME_NONE,            "GATT Read handler: handle:0x%X, len:%d\n")
+APP_LOG_EVENT(APP_LOG_GATT_NO_MEMORY,        1, APP_LOG_NAME_NONE,            "No memory, len_requested: %d!!\r\n")
+APP_LOG_EVENT(APP_LOG_GATT_TYPE_NO_ATTR,     1, APP_LOG_NAME_NONE,            "found type but no attribute for %d \r\n")
+APP_LOG_EVENT(APP_LOG_GATT_TYPE_NOT_FOUND,   3, APP_LOG_NAME_NONE,            "attr not found  start_handle: 0x%04x, end_handle: 0x%04x, Type: 0x%04x\r\n")
+APP_LOG_EVENT(APP_LOG_NOTIFY_FAILED,         1, APP_LOG_NAME_NONE,            "Send notification failed, Connection ID '%d'\n")
+APP_LOG_EVENT(APP_LOG_DROPPED,               1, APP_LOG_NAME_NONE,            "Log: %lu records dropped\n")
+APP_LOG_EVENT(APP_LOG_BTM_LOCAL_ADDR,        6, APP_LOG_NAME_NONE,            "Local Bluetooth Address: %02X:%02X:%02X:%02X:%02X:%02X \n")
+APP_LOG_EVENT(APP_LOG_BTM_UNHANDLED,         2, APP_LOG_NAME_BTM_EVENT,       "Unhandled Bluetooth Management Event: 0x%x %s\n")
+APP_LOG_EVENT(APP_LOG_GATT_REGISTER,         1, APP_LOG_NAME_GATT_STATUS,     "GATT event Handler registration status: %s \n")
+APP_LOG_EVENT(APP_LOG_GATT_DB_INIT,          1, APP_LOG_NAME_GATT_STATUS,     "GATT database initialization status: %s \n")
+APP_LOG_EVENT(APP_LOG_CONN_UP,               6, APP_LOG_NAME_NONE,            "Connected : BD Addr: %02X:%02X:%02X:%02X:%02X:%02X \n")
+APP_LOG_EVENT(APP_LOG_CONN_UP_ID,            1, APP_LOG_NAME_NONE,            "Connection ID '%d'\n")
+APP_LOG_EVENT(APP_LOG_CONN_DOWN,             6, APP_LOG_NAME_NONE,            "\nDisconnected : BD Addr: %02X:%02X:%02X:%02X:%02X:%02X \n")
+APP_LOG_EVENT(APP_LOG_CONN_DOWN_REASON,      2, APP_LOG_NAME_DISCONN_REASON,  "Connection ID '%d', Reason '%s'\n")
+APP_LOG_EVENT(APP_LOG_BOND_PAIRING_DONE,     1, APP_LOG_NAME_SMP_STATUS,      "Pairing complete, reason: %s\n")
+APP_LOG_EVENT(APP_LOG_BOND_SAVED,            6, APP_LOG_NAME_NONE,            "Bonded with %02X:%02X:%02X:%02X:%02X:%02X \n")
+APP_LOG_EVENT(APP_LOG_BOND_ENCRYPTED,        2, APP_LOG_NAME_NONE,            "Link encrypted, Connection ID '%d', CCCD restored: %d\n")
+APP_LOG_EVENT(APP_LOG_BOND_ENCRYPT_FAILED,   1, APP_LOG_NAME_NONE,            "Encryption failed, result: %d\n")
+APP_LOG_EVENT(APP_LOG_BOND_STORE_FAILED,     1, APP_LOG_NAME_NONE,            "Bond store failed, result: %d\n")
+APP_LOG_EVENT(APP_LOG_CONN_PARAM_UPDATE,     4, APP_LOG_NAME_NONE,            "Connection parameters: status %d, interval %d, latency %d, timeout %d\n")
+APP_LOG_EVENT(APP_LOG_MTU_EXCHANGED,         2, APP_LOG_NAME_NONE,            "MTU: Connection ID '%d', MTU %d\n")
+APP_LOG_EVENT(APP_LOG_DATA_LENGTH_UPDATE,    2, APP_LOG_NAME_NONE,            "Data length: tx %d, rx %d octets\n")
+APP_LOG_EVENT(APP_LOG_PHY_UPDATE,            3, APP_LOG_NAME_NONE,            "PHY: status %d, tx %d, rx %d\n")
+APP_LOG_EVENT(APP_LOG_GATT_MULTI_INVALID,    1, APP_LOG_NAME_NONE,            "Read Multiple Request to Invalid Handle: 0x%x\n")
+APP_LOG_EVENT(APP_LOG_INDICATE_RTT,          4, APP_LOG_NAME_NONE,            "Indications: Connection ID '%d', %d confirmed, round trip avg %d ms, max %d ms\n")
+APP_LOG_EVENT(APP_LOG_CONN_TABLE_FULL,       1, APP_LOG_NAME_NONE,            "Connection table full, disconnecting Connection ID '%d'\n")
+APP_LOG_EVENT(APP_LOG_SCAN_STARTED,          0, APP_LOG_NAME_NONE,            "\r\nScanning.....\n")
+APP_LOG_EVENT(APP_LOG_SCAN_START_FAILED,     1, APP_LOG_NAME_NONE,            "Cannot restart scanning. Error: %d \n")
+APP_LOG_EVENT(APP_LOG_NOTIFY_TIMER_FAILED,   0, APP_LOG_NAME_NONE,            "Starting the notification timer failed\n")
+APP_LOG_EVENT(APP_LOG_NOTIFY_STARTED,        6, APP_LOG_NAME_NONE,            "\rNotifying the time from %04d-%02d-%02d %02d:%02d:%02d\r\n\n")
@@ -0,0 +1,167 @@
+/******************************************************************************
+* File Name: app_log_format.c
+*
+* Description: Formats deferred log records as text, for the drain task and
+*              the host-side token decoder.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_log.h"
+#include "app_bt_utils.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifndef APP_LOG_TOKENIZED
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Longest conversion the log formats use, e.g. "%02X" or "%lu" */
+#define APP_LOG_SPEC_MAX_LEN            (8u)
+
+/* Flags, width, precision and length characters of a conversion */
+#define APP_LOG_SPEC_CHARS              "0123456789.-+ #hl"
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_log_name
+********************************************************************************
+* Summary:
+*  Returns the name of a logged value through the matching app_bt_utils
+*  table.
+*
+* Parameters:
+*  app_log_name_t names : Table to look the value up in
+*  uint32_t value       : Logged value
+*
+* Return:
+*  const char *: Name of the value
+*
+*******************************************************************************/
+const char *app_log_name(app_log_name_t names, uint32_t value)
+{
+    switch (names)
+    {
+        case APP_LOG_NAME_BTM_EVENT:
+            return get_btm_event_name((wiced_bt_management_evt_t)value);
+        case APP_LOG_NAME_GATT_STATUS:
+            return get_bt_gatt_status_name((wiced_bt_gatt_status_t)value);
+        case APP_LOG_NAME_DISCONN_REASON:
+            return get_bt_gatt_disconn_reason_name((wiced_bt_gatt_disconn_reason_t)value);
+        case APP_LOG_NAME_SMP_STATUS:
+            return get_bt_smp_status_name((wiced_bt_smp_status_t)value);
+        case APP_LOG_NAME_ADVERT_MODE:
+            return get_bt_advert_mode_name((wiced_bt_ble_advert_mode_t)value);
+        default:
+            return "?";
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_format
+********************************************************************************
+* Summary:
+*  Prints a log format with its uint32_t arguments. Each conversion takes the
+*  next argument; %s prints the name of the argument instead of a string.
+*  Used by the drain task in text mode and by the host decoder.
+*
+* Parameters:
+*  const char *p_fmt      : printf format of the event
+*  app_log_name_t names   : Table for the %s conversions
+*  const uint32_t *p_args : Arguments
+*  uint8_t nargs          : Number of arguments
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_log_format(const char *p_fmt, app_log_name_t names, const uint32_t *p_args,
+                    uint8_t nargs)
+{
+    char spec[APP_LOG_SPEC_MAX_LEN + 1];
+    const char *p_pct;
+    uint8_t arg = 0;
+
+    while (NULL != (p_pct = strchr(p_fmt, '%')))
+    {
+        size_t len;
+        uint32_t value;
+        char conv;
+
+        fwrite(p_fmt, 1, (size_t)(p_pct - p_fmt), stdout);
+        if ('%' == p_pct[1])
+        {
+            putchar('%');
+            p_fmt = p_pct + 2;
+            continue;
+        }
+
+        /* '%', flags to length, then the conversion character */
+        len = strspn(p_pct + 1, APP_LOG_SPEC_CHARS) + 2u;
+        conv = p_pct[len - 1u];
+        if (('\0' == conv) || (len > APP_LOG_SPEC_MAX_LEN))
+        {
+            fputs(p_pct, stdout);
+            return;
+        }
+        memcpy(spec, p_pct, len);
+        spec[len] = '\0';
+        p_fmt = p_pct + len;
+
+        value = (arg < nargs) ? p_args[arg] : 0u;
+        arg++;
+        if ('s' == conv)
+        {
+            fputs(app_log_name(names, value), stdout);
+        }
+        else if (NULL != strchr(spec, 'l'))
+        {
+            printf(spec, (unsigned long)value);
+        }
+        else
+        {
+            printf(spec, (unsigned int)value);
+        }
+    }
+    fputs(p_fmt, stdout);
+}
+
+#endif /* APP_LOG_TOKENIZED */
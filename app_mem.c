@@ -0,0 +1,428 @@
+/******************************************************************************
+* File Name: app_mem.c
+*
+* Description: Memory monitor: samples the stack high-water mark of every
+*              task and the use of the heap, and recommends trimmed stack and
+*              heap sizes.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_mem.h"
+#include "app_log.h"
+#include "app_cpu.h"
+#include "app_bt_gatt_task.h"
+#include "cyhal.h"
+#include "cts_server.h"
+#include <task.h>
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* heap_4 and heap_5 keep their own statistics. heap_3 hands out the C
+ * library heap, which only newlib can describe; there the size is that of
+ * the heap region of the linker script. */
+#if (configHEAP_ALLOCATION_SCHEME == HEAP_ALLOCATION_TYPE4) || \
+    (configHEAP_ALLOCATION_SCHEME == HEAP_ALLOCATION_TYPE5)
+#define APP_MEM_HEAP_STATS              (1)
+#define APP_MEM_HEAP_MACRO              "configTOTAL_HEAP_SIZE"
+#elif defined (__GNUC__) && !defined (__ARMCC_VERSION)
+#include <malloc.h>
+#define APP_MEM_HEAP_MALLINFO           (1)
+#define APP_MEM_HEAP_MACRO              "heap region"
+extern uint8_t __HeapBase[];
+extern uint8_t __HeapLimit[];
+#endif
+
+/* A task whose stack size the application sets, and the macro that sets it */
+#define APP_MEM_KNOWN(name, macro)      { name, #macro, (macro) }
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef struct
+{
+    const char *p_name;
+    const char *p_macro;
+    uint32_t    depth;
+} app_mem_known_t;
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+static const app_mem_known_t app_mem_known[] =
+{
+    APP_MEM_KNOWN("IDLE",        configMINIMAL_STACK_SIZE),
+    APP_MEM_KNOWN("Tmr Svc",     configTIMER_TASK_STACK_DEPTH),
+    APP_MEM_KNOWN("button_task", BUTTON_TASK_STACK_SIZE),
+    APP_MEM_KNOWN("log_task",    APP_LOG_TASK_STACK_SIZE),
+    APP_MEM_KNOWN("gatt_task",   APP_BT_GATT_TASK_STACK_SIZE),
+    APP_MEM_KNOWN("cpu_stats",   APP_CPU_TASK_STACK_SIZE),
+};
+
+#if (0 != APP_MEM_REPORT_MS)
+/* Tick of the last report */
+static TickType_t      app_mem_last_report;
+#endif
+
+/* Counted by the allocation hooks from the first allocation on, so they are
+ * not cleared by app_mem_init() */
+static app_mem_stats_t app_mem_stats;
+
+/* Only used from the CPU statistics task */
+static TaskStatus_t    app_mem_status[APP_MEM_MAX_TASKS];
+static app_mem_task_t  app_mem_tasks[APP_MEM_MAX_TASKS];
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_mem_align
+********************************************************************************
+* Summary:
+*  Rounds value up to a multiple of align.
+*
+*******************************************************************************/
+static uint32_t app_mem_align(uint32_t value, uint32_t align)
+{
+    return ((value + align - 1u) / align) * align;
+}
+
+/*******************************************************************************
+* Function Name: app_mem_stack_recommend
+********************************************************************************
+* Summary:
+*  Stack size, in words, that keeps the margin above the deepest use seen.
+*
+*******************************************************************************/
+static uint32_t app_mem_stack_recommend(uint32_t depth, uint32_t min_free)
+{
+    uint32_t used = (depth > min_free) ? (depth - min_free) : 0u;
+    uint32_t margin = (used * APP_MEM_STACK_MARGIN_PCT) / 100u;
+    uint32_t size;
+
+    if (margin < APP_MEM_STACK_MARGIN_MIN)
+    {
+        margin = APP_MEM_STACK_MARGIN_MIN;
+    }
+    size = app_mem_align(used + margin, APP_MEM_STACK_ALIGN);
+    return (size < configMINIMAL_STACK_SIZE) ? configMINIMAL_STACK_SIZE : size;
+}
+
+/*******************************************************************************
+* Function Name: app_mem_heap
+********************************************************************************
+* Summary:
+*  Takes the size and the use of the heap and recommends a size for it.
+*
+*******************************************************************************/
+static void app_mem_heap(void)
+{
+    uint32_t peak;
+
+#if defined (APP_MEM_HEAP_STATS)
+    HeapStats_t heap;
+
+    vPortGetHeapStats(&heap);
+    app_mem_stats.heap_size = configTOTAL_HEAP_SIZE;
+    app_mem_stats.heap_free = (uint32_t)heap.xAvailableHeapSpaceInBytes;
+    app_mem_stats.heap_min_free = (uint32_t)heap.xMinimumEverFreeBytesRemaining;
+    app_mem_stats.heap_largest = (uint32_t)heap.xSizeOfLargestFreeBlockInBytes;
+    app_mem_stats.heap_blocks = (uint32_t)heap.xNumberOfFreeBlocks;
+#elif defined (APP_MEM_HEAP_MALLINFO)
+    /* newlib does not give memory back to the region, so what it took is the
+     * peak, and what lies above it is one free block at least */
+    struct mallinfo info = mallinfo();
+    uint32_t size = (uint32_t)(__HeapLimit - __HeapBase);
+    uint32_t min_free = size - (uint32_t)info.arena;
+
+    app_mem_stats.heap_size = size;
+    app_mem_stats.heap_free = size - (uint32_t)info.uordblks;
+    if ((0 == app_mem_stats.samples) || (min_free < app_mem_stats.heap_min_free))
+    {
+        app_mem_stats.heap_min_free = min_free;
+    }
+    app_mem_stats.heap_largest = min_free;
+    app_mem_stats.heap_blocks = 0;
+#endif
+
+    if (0 == app_mem_stats.heap_size)
+    {
+        app_mem_stats.heap_recommend = 0;
+        return;
+    }
+    peak = app_mem_stats.heap_size - app_mem_stats.heap_min_free;
+    app_mem_stats.heap_recommend = app_mem_align(peak + ((peak * APP_MEM_HEAP_MARGIN_PCT) / 100u),
+                                                 APP_MEM_HEAP_ALIGN);
+}
+
+/*******************************************************************************
+* Function Name: app_mem_init
+********************************************************************************
+* Summary:
+*  Starts the period of the report, which app_mem_poll() prints every
+*  APP_MEM_REPORT_MS.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_mem_init(void)
+{
+#if (0 != APP_MEM_REPORT_MS)
+    app_mem_last_report = xTaskGetTickCount();
+#endif
+}
+
+/*******************************************************************************
+* Function Name: app_mem_poll
+********************************************************************************
+* Summary:
+*  Samples and prints the report once APP_MEM_REPORT_MS has passed since the
+*  last one. Called by the low-priority CPU statistics task after each window,
+*  so the report neither runs in nor delays the timer task.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_mem_poll(void)
+{
+#if (0 != APP_MEM_REPORT_MS)
+    TickType_t now = xTaskGetTickCount();
+
+    if ((TickType_t)(now - app_mem_last_report) < pdMS_TO_TICKS(APP_MEM_REPORT_MS))
+    {
+        return;
+    }
+    app_mem_last_report = now;
+    app_mem_sample();
+    app_mem_print();
+#endif
+}
+
+/*******************************************************************************
+* Function Name: app_mem_malloc
+********************************************************************************
+* Summary:
+*  Counts an allocation. Called by the heap through traceMALLOC(), with the
+*  scheduler suspended, so it only does the counting.
+*
+*******************************************************************************/
+void app_mem_malloc(void *p_block, size_t size)
+{
+    if (NULL == p_block)
+    {
+        app_mem_stats.failures++;
+        app_mem_stats.failed_size = (uint32_t)size;
+    }
+    else
+    {
+        app_mem_stats.allocs++;
+    }
+    if (size > app_mem_stats.largest_alloc)
+    {
+        app_mem_stats.largest_alloc = (uint32_t)size;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_mem_free
+********************************************************************************
+* Summary:
+*  Counts a free. Called by the heap through traceFREE().
+*
+*******************************************************************************/
+void app_mem_free(void *p_block)
+{
+    if (NULL != p_block)
+    {
+        app_mem_stats.frees++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_mem_sample
+********************************************************************************
+* Summary:
+*  Takes the stack high-water mark of every task and the use of the heap,
+*  and works out the sizes to recommend. The high-water marks are the least
+*  free stack since each task was created, so one sample covers all that
+*  happened before it.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_mem_sample(void)
+{
+    app_mem_task_t *p_task;
+    uint32_t count;
+    uint32_t i;
+    uint32_t k;
+
+    count = (uint32_t)uxTaskGetSystemState(app_mem_status, APP_MEM_MAX_TASKS, NULL);
+    if (0 == count)
+    {
+        app_mem_stats.overflows++;
+        return;
+    }
+
+    app_mem_stats.tasks = count;
+    app_mem_stats.stack_words = 0;
+    app_mem_stats.stack_recommend = 0;
+    for (i = 0; i < count; i++)
+    {
+        p_task = &app_mem_tasks[i];
+        memset(p_task, 0, sizeof(*p_task));
+        strncpy(p_task->name, app_mem_status[i].pcTaskName, APP_MEM_NAME_LEN - 1u);
+        p_task->min_free = app_mem_status[i].usStackHighWaterMark;
+
+        for (k = 0; k < (sizeof(app_mem_known) / sizeof(app_mem_known[0])); k++)
+        {
+            if (0 == strcmp(p_task->name, app_mem_known[k].p_name))
+            {
+                p_task->p_macro = app_mem_known[k].p_macro;
+                p_task->depth = app_mem_known[k].depth;
+                p_task->recommend = app_mem_stack_recommend(p_task->depth, p_task->min_free);
+                app_mem_stats.stack_words += p_task->depth;
+                app_mem_stats.stack_recommend += p_task->recommend;
+                break;
+            }
+        }
+    }
+
+    app_mem_heap();
+    app_mem_stats.samples++;
+}
+
+/*******************************************************************************
+* Function Name: app_mem_print
+********************************************************************************
+* Summary:
+*  Prints the heap use and the least free stack of every task as of the last
+*  sample, with the sizes they could be trimmed to. Stacks are in words.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_mem_print(void)
+{
+    const app_mem_stats_t *p_stats = &app_mem_stats;
+    uint32_t i;
+
+    if (0 == p_stats->samples)
+    {
+        return;
+    }
+
+    printf("Memory: heap %u bytes, %u free (least %u, largest block %u, %u blocks), "
+           "%u allocs, %u frees, %u failed",
+           (unsigned)p_stats->heap_size, (unsigned)p_stats->heap_free,
+           (unsigned)p_stats->heap_min_free, (unsigned)p_stats->heap_largest,
+           (unsigned)p_stats->heap_blocks, (unsigned)p_stats->allocs,
+           (unsigned)p_stats->frees, (unsigned)p_stats->failures);
+    if (0 != p_stats->failures)
+    {
+        printf(" (last %u bytes)", (unsigned)p_stats->failed_size);
+    }
+    printf("\n");
+
+#if defined (APP_MEM_HEAP_MACRO)
+    if (0 != p_stats->heap_size)
+    {
+        printf("Memory: heap peak %u bytes, recommend %s %u\n",
+               (unsigned)(p_stats->heap_size - p_stats->heap_min_free),
+               APP_MEM_HEAP_MACRO, (unsigned)p_stats->heap_recommend);
+    }
+#endif
+
+    printf("%-16s %6s %6s %9s  %s\n", "task", "stack", "free", "recommend", "set by");
+    for (i = 0; i < p_stats->tasks; i++)
+    {
+        const app_mem_task_t *p_task = &app_mem_tasks[i];
+
+        if (0 == p_task->depth)
+        {
+            printf("%-16s %6s %6u %9s\n", p_task->name, "-", (unsigned)p_task->min_free, "-");
+            continue;
+        }
+        printf("%-16s %6u %6u %9u  %s\n", p_task->name, (unsigned)p_task->depth,
+               (unsigned)p_task->min_free, (unsigned)p_task->recommend, p_task->p_macro);
+    }
+
+    if (p_stats->stack_recommend < p_stats->stack_words)
+    {
+        printf("Memory: stacks %u words, recommend %u, %u bytes to reclaim\n",
+               (unsigned)p_stats->stack_words, (unsigned)p_stats->stack_recommend,
+               (unsigned)((p_stats->stack_words - p_stats->stack_recommend) *
+                          sizeof(StackType_t)));
+    }
+    else
+    {
+        printf("Memory: stacks %u words, recommend %u\n",
+               (unsigned)p_stats->stack_words, (unsigned)p_stats->stack_recommend);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_mem_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics.
+*
+*******************************************************************************/
+void app_mem_get_stats(app_mem_stats_t *p_stats)
+{
+    *p_stats = app_mem_stats;
+}
@@ -0,0 +1,138 @@
+/******************************************************************************
+* File Name: app_mem.h
+*
+* Description: Memory monitor: stack high-water marks of every task, heap
+*              use, and the sizes they could be trimmed to.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_MEM_H__
+#define __APP_MEM_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <FreeRTOS.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Period of the report on the console; 0 prints only on request */
+#ifndef APP_MEM_REPORT_MS
+#define APP_MEM_REPORT_MS               (60000u)
+#endif
+
+/* Tasks that can be sampled, the idle and timer tasks and those of the
+ * Bluetooth stack included */
+#ifndef APP_MEM_MAX_TASKS
+#define APP_MEM_MAX_TASKS               (12u)
+#endif
+
+/* Room left above the deepest stack use seen: a share of that use, but at
+ * least APP_MEM_STACK_MARGIN_MIN words. Recommendations are rounded up to
+ * APP_MEM_STACK_ALIGN words and never go below configMINIMAL_STACK_SIZE. */
+#ifndef APP_MEM_STACK_MARGIN_PCT
+#define APP_MEM_STACK_MARGIN_PCT        (25u)
+#endif
+
+#ifndef APP_MEM_STACK_MARGIN_MIN
+#define APP_MEM_STACK_MARGIN_MIN        (32u)
+#endif
+
+#define APP_MEM_STACK_ALIGN             (16u)
+
+/* Room left above the peak heap use, rounded up to APP_MEM_HEAP_ALIGN bytes */
+#ifndef APP_MEM_HEAP_MARGIN_PCT
+#define APP_MEM_HEAP_MARGIN_PCT         (25u)
+#endif
+
+#define APP_MEM_HEAP_ALIGN              (256u)
+
+#define APP_MEM_NAME_LEN                (16u)
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* Stack of one task. Sizes are in words, as FreeRTOS takes them. */
+typedef struct
+{
+    char        name[APP_MEM_NAME_LEN];
+    const char *p_macro;        /* Macro that sets the size, or NULL if unknown */
+    uint32_t    depth;          /* Size it was created with; 0 if unknown */
+    uint32_t    min_free;       /* Least ever free: the high-water mark */
+    uint32_t    recommend;      /* Size to give it; 0 if depth is unknown */
+} app_mem_task_t;
+
+typedef struct
+{
+    uint32_t samples;           /* Reports taken */
+    uint32_t tasks;             /* Tasks in the last sample */
+    uint32_t overflows;         /* Samples skipped because there were too many tasks */
+    uint32_t stack_words;       /* Stacks of known size, in words */
+    uint32_t stack_recommend;   /* What they are recommended to shrink to */
+    uint32_t heap_size;         /* Bytes the heap can hand out; 0 if unknown */
+    uint32_t heap_free;         /* Free now */
+    uint32_t heap_min_free;     /* Least ever free */
+    uint32_t heap_largest;      /* Largest free block; 0 if unknown */
+    uint32_t heap_blocks;       /* Free blocks; 0 if unknown */
+    uint32_t heap_recommend;    /* Size to give the heap; 0 if unknown */
+    uint32_t allocs;            /* pvPortMalloc() calls that succeeded */
+    uint32_t frees;             /* vPortFree() calls */
+    uint32_t failures;          /* pvPortMalloc() calls that failed */
+    uint32_t failed_size;       /* Size asked for by the last one that failed */
+    uint32_t largest_alloc;     /* Largest size asked for */
+} app_mem_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_mem_init(void);
+
+void app_mem_poll(void);
+
+void app_mem_malloc(void *p_block, size_t size);
+
+void app_mem_free(void *p_block);
+
+void app_mem_sample(void);
+
+void app_mem_print(void);
+
+void app_mem_get_stats(app_mem_stats_t *p_stats);
+
+#endif      /*__APP_MEM_H__ */
@@ -0,0 +1,304 @@
+/******************************************************************************
+* File Name: app_scan_cache.c
+*
+* Description: Fixed-size hashed LRU cache of recently seen advertisers. Lets
+*              the scan callback reject repeated reports of other devices
+*              without parsing the advertising data or logging.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "app_scan_cache.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+#define APP_SCAN_CACHE_NONE             (0xFFFFu)
+#define APP_SCAN_CACHE_BUCKET_MASK      (APP_SCAN_CACHE_BUCKETS - 1u)
+
+#if (0u != (APP_SCAN_CACHE_BUCKETS & APP_SCAN_CACHE_BUCKET_MASK))
+#error "APP_SCAN_CACHE_BUCKETS must be a power of two"
+#endif
+
+#if (APP_SCAN_CACHE_SIZE >= APP_SCAN_CACHE_NONE)
+#error "APP_SCAN_CACHE_SIZE is too large"
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+/* An advertiser sends different data in its advertisements and in its scan
+ * responses, so the event type is part of the key. */
+typedef struct
+{
+    wiced_bt_device_address_t bd_addr;
+    uint8_t                   evt_type;
+    uint8_t                   result;       /* app_scan_cache_result_t */
+    uint16_t                  hash_next;    /* Next entry in the bucket, or in the free list */
+    uint16_t                  lru_prev;     /* Towards the most recently seen entry */
+    uint16_t                  lru_next;     /* Towards the least recently seen entry */
+    TickType_t                parsed_tick;  /* When the report was last parsed */
+} app_scan_cache_entry_t;
+
+/******************************************************************************
+ *                                Variables
+ ******************************************************************************/
+/* Only used from the Bluetooth stack context, so no locking is needed */
+static app_scan_cache_entry_t app_scan_cache_entries[APP_SCAN_CACHE_SIZE];
+static uint16_t               app_scan_cache_buckets[APP_SCAN_CACHE_BUCKETS];
+static uint16_t               app_scan_cache_free;
+static uint16_t               app_scan_cache_mru;
+static uint16_t               app_scan_cache_lru;
+static app_scan_cache_stats_t app_scan_cache_stats;
+
+/****************************************************************************
+ *                              FUNCTION DEFINITIONS
+ ***************************************************************************/
+/* FNV-1a over the address and event type, folded onto the bucket mask.
+ * Random addresses and public addresses sharing an OUI both spread well. */
+static uint32_t app_scan_cache_hash(const uint8_t *p_bd_addr, uint8_t evt_type)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+
+    for (i = 0; i < BD_ADDR_LEN; i++)
+    {
+        hash = (hash ^ p_bd_addr[i]) * 16777619u;
+    }
+    hash = (hash ^ evt_type) * 16777619u;
+    return (hash ^ (hash >> 16)) & APP_SCAN_CACHE_BUCKET_MASK;
+}
+
+static void app_scan_cache_lru_unlink(uint16_t index)
+{
+    app_scan_cache_entry_t *p_entry = &app_scan_cache_entries[index];
+
+    if (APP_SCAN_CACHE_NONE != p_entry->lru_prev)
+    {
+        app_scan_cache_entries[p_entry->lru_prev].lru_next = p_entry->lru_next;
+    }
+    else
+    {
+        app_scan_cache_mru = p_entry->lru_next;
+    }
+    if (APP_SCAN_CACHE_NONE != p_entry->lru_next)
+    {
+        app_scan_cache_entries[p_entry->lru_next].lru_prev = p_entry->lru_prev;
+    }
+    else
+    {
+        app_scan_cache_lru = p_entry->lru_prev;
+    }
+}
+
+static void app_scan_cache_lru_push(uint16_t index)
+{
+    app_scan_cache_entry_t *p_entry = &app_scan_cache_entries[index];
+
+    p_entry->lru_prev = APP_SCAN_CACHE_NONE;
+    p_entry->lru_next = app_scan_cache_mru;
+    if (APP_SCAN_CACHE_NONE != app_scan_cache_mru)
+    {
+        app_scan_cache_entries[app_scan_cache_mru].lru_prev = index;
+    }
+    else
+    {
+        app_scan_cache_lru = index;
+    }
+    app_scan_cache_mru = index;
+}
+
+/* Takes an entry out of its bucket and the recency list */
+static void app_scan_cache_unlink(uint16_t index)
+{
+    app_scan_cache_entry_t *p_entry = &app_scan_cache_entries[index];
+    uint16_t *p_link = &app_scan_cache_buckets[app_scan_cache_hash(p_entry->bd_addr,
+                                                                   p_entry->evt_type)];
+
+    while (index != *p_link)
+    {
+        p_link = &app_scan_cache_entries[*p_link].hash_next;
+    }
+    *p_link = p_entry->hash_next;
+    app_scan_cache_lru_unlink(index);
+    app_scan_cache_stats.entries--;
+}
+
+/*******************************************************************************
+* Function Name: app_scan_cache_init
+********************************************************************************
+* Summary:
+*  Empties the cache and clears the counters.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_scan_cache_init(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < APP_SCAN_CACHE_BUCKETS; i++)
+    {
+        app_scan_cache_buckets[i] = APP_SCAN_CACHE_NONE;
+    }
+    for (i = 0; i < APP_SCAN_CACHE_SIZE; i++)
+    {
+        app_scan_cache_entries[i].hash_next = (uint16_t)(i + 1u);
+    }
+    app_scan_cache_entries[APP_SCAN_CACHE_SIZE - 1u].hash_next = APP_SCAN_CACHE_NONE;
+    app_scan_cache_free = 0;
+    app_scan_cache_mru = APP_SCAN_CACHE_NONE;
+    app_scan_cache_lru = APP_SCAN_CACHE_NONE;
+    memset(&app_scan_cache_stats, 0, sizeof(app_scan_cache_stats));
+}
+
+/*******************************************************************************
+* Function Name: app_scan_cache_lookup
+********************************************************************************
+* Summary:
+*  Looks up the result of an earlier report of the same advertiser and event
+*  type, and marks the entry as most recently seen. A result older than
+*  APP_SCAN_CACHE_TTL_MS is dropped and reported as a miss.
+*
+* Parameters:
+*  const wiced_bt_ble_scan_results_t *p_scan_result: Advertising report
+*
+* Return:
+*  app_scan_cache_result_t: Cached result, or APP_SCAN_CACHE_MISS
+*
+*******************************************************************************/
+app_scan_cache_result_t app_scan_cache_lookup(const wiced_bt_ble_scan_results_t *p_scan_result)
+{
+    uint16_t index = app_scan_cache_buckets[app_scan_cache_hash(p_scan_result->remote_bd_addr,
+                                                                p_scan_result->ble_evt_type)];
+
+    while (APP_SCAN_CACHE_NONE != index)
+    {
+        app_scan_cache_entry_t *p_entry = &app_scan_cache_entries[index];
+
+        if ((p_entry->evt_type == p_scan_result->ble_evt_type) &&
+            (0 == memcmp(p_entry->bd_addr, p_scan_result->remote_bd_addr, BD_ADDR_LEN)))
+        {
+            if ((xTaskGetTickCount() - p_entry->parsed_tick) >=
+                pdMS_TO_TICKS(APP_SCAN_CACHE_TTL_MS))
+            {
+                app_scan_cache_unlink(index);
+                p_entry->hash_next = app_scan_cache_free;
+                app_scan_cache_free = index;
+                app_scan_cache_stats.expired++;
+                break;
+            }
+            if (index != app_scan_cache_mru)
+            {
+                app_scan_cache_lru_unlink(index);
+                app_scan_cache_lru_push(index);
+            }
+            app_scan_cache_stats.hits++;
+            return (app_scan_cache_result_t)p_entry->result;
+        }
+        index = p_entry->hash_next;
+    }
+
+    app_scan_cache_stats.misses++;
+    return APP_SCAN_CACHE_MISS;
+}
+
+/*******************************************************************************
+* Function Name: app_scan_cache_insert
+********************************************************************************
+* Summary:
+*  Remembers the result of a parsed report after a miss. When the cache is
+*  full, the least recently seen entry is replaced.
+*
+* Parameters:
+*  const wiced_bt_ble_scan_results_t *p_scan_result: Advertising report
+*  app_scan_cache_result_t result                  : What the report turned out to be
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void app_scan_cache_insert(const wiced_bt_ble_scan_results_t *p_scan_result,
+                           app_scan_cache_result_t result)
+{
+    app_scan_cache_entry_t *p_entry;
+    uint16_t *p_bucket;
+    uint16_t index = app_scan_cache_free;
+
+    if (APP_SCAN_CACHE_NONE != index)
+    {
+        app_scan_cache_free = app_scan_cache_entries[index].hash_next;
+    }
+    else
+    {
+        index = app_scan_cache_lru;
+        app_scan_cache_unlink(index);
+        app_scan_cache_stats.evictions++;
+    }
+
+    p_entry = &app_scan_cache_entries[index];
+    memcpy(p_entry->bd_addr, p_scan_result->remote_bd_addr, BD_ADDR_LEN);
+    p_entry->evt_type = p_scan_result->ble_evt_type;
+    p_entry->result = (uint8_t)result;
+    p_entry->parsed_tick = xTaskGetTickCount();
+
+    p_bucket = &app_scan_cache_buckets[app_scan_cache_hash(p_entry->bd_addr, p_entry->evt_type)];
+    p_entry->hash_next = *p_bucket;
+    *p_bucket = index;
+    app_scan_cache_lru_push(index);
+    app_scan_cache_stats.entries++;
+}
+
+/*******************************************************************************
+* Function Name: app_scan_cache_get_stats
+********************************************************************************
+* Summary:
+*  Copies the cache counters.
+*
+*******************************************************************************/
+void app_scan_cache_get_stats(app_scan_cache_stats_t *p_stats)
+{
+    *p_stats = app_scan_cache_stats;
+}
@@ -0,0 +1,101 @@
+/******************************************************************************
+* File Name: app_scan_cache.h
+*
+* Description: Cache of recently seen advertisers, so that repeated
+*              advertising reports are classified without parsing the
+*              advertising data again.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_SCAN_CACHE_H__
+#define __APP_SCAN_CACHE_H__
+
+/******************************************************************************
+ *                                INCLUDES
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+
+/******************************************************************************
+ *                                Constants
+ ******************************************************************************/
+/* Advertising reports remembered at the same time */
+#ifndef APP_SCAN_CACHE_SIZE
+#define APP_SCAN_CACHE_SIZE             (128u)
+#endif
+
+/* Hash buckets; must be a power of two */
+#ifndef APP_SCAN_CACHE_BUCKETS
+#define APP_SCAN_CACHE_BUCKETS          (2u * APP_SCAN_CACHE_SIZE)
+#endif
+
+/* How long a result is trusted before the report is parsed again, so that a
+ * device that changes its name is noticed */
+#ifndef APP_SCAN_CACHE_TTL_MS
+#define APP_SCAN_CACHE_TTL_MS           (10000u)
+#endif
+
+/******************************************************************************
+ *                                Structures
+ ******************************************************************************/
+typedef enum
+{
+    APP_SCAN_CACHE_MISS,                /* Not seen recently; parse the report */
+    APP_SCAN_CACHE_OTHER,               /* Seen, not the peer we look for */
+    APP_SCAN_CACHE_PEER,                /* Seen, the peer we look for */
+} app_scan_cache_result_t;
+
+typedef struct
+{
+    uint32_t hits;                      /* Reports answered from the cache */
+    uint32_t misses;                    /* Reports that had to be parsed */
+    uint32_t evictions;                 /* Least recently seen entries replaced */
+    uint32_t expired;                   /* Entries dropped after APP_SCAN_CACHE_TTL_MS */
+    uint32_t entries;                   /* Entries in use */
+} app_scan_cache_stats_t;
+
+/****************************************************************************
+ *                              FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_scan_cache_init(void);
+
+app_scan_cache_result_t app_scan_cache_lookup(const wiced_bt_ble_scan_results_t *p_scan_result);
+
+void app_scan_cache_insert(const wiced_bt_ble_scan_results_t *p_scan_result,
+                           app_scan_cache_result_t result);
+
+void app_scan_cache_get_stats(app_scan_cache_stats_t *p_stats);
+
+#endif      /*__APP_SCAN_CACHE_H__ */
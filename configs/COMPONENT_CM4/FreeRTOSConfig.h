@@ -80,6 +80,7 @@
 /* Memory allocation related definitions. */
 #define configSUPPORT_STATIC_ALLOCATION         1
 #define configSUPPORT_DYNAMIC_ALLOCATION        1
+/* Only used by heap_4 and heap_5; heap_3 hands out the C library heap */
 #define configTOTAL_HEAP_SIZE                   10240
 #define configAPPLICATION_ALLOCATED_HEAP        0
 
@@ -91,10 +92,27 @@
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 
 /* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS           0
+#define configGENERATE_RUN_TIME_STATS           1
 #define configUSE_TRACE_FACILITY                1
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+/* Run time is counted in core cycles and context switches per task; both
+ * are read by app_cpu.c */
+#if defined (__ICCARM__) || (__GNUC__)
+extern void app_cpu_counter_init(void);
+extern uint32_t app_cpu_counter(void);
+extern void app_cpu_switched_in(uint32_t task_number);
+extern void app_mem_malloc(void *p_block, size_t size);
+extern void app_mem_free(void *p_block);
+#endif
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    app_cpu_counter_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()            app_cpu_counter()
+#define traceTASK_SWITCHED_IN()                     app_cpu_switched_in(pxCurrentTCB->uxTCBNumber)
+
+/* Allocations, frees and failed allocations are counted by app_mem.c */
+#define traceMALLOC(pvAddress, uiSize)              app_mem_malloc(pvAddress, uiSize)
+#define traceFREE(pvAddress, uiSize)                app_mem_free(pvAddress)
+
 /* Co-routine related definitions. */
 #define configUSE_CO_ROUTINES                   0
 #define configMAX_CO_ROUTINE_PRIORITIES         1
@@ -103,7 +121,11 @@
 #define configUSE_TIMERS                        1
 #define configTIMER_TASK_PRIORITY               3
 #define configTIMER_QUEUE_LENGTH                10
-#define configTIMER_TASK_STACK_DEPTH            configMINIMAL_STACK_SIZE
+/* The timer callbacks only read the RTC and hand work to the GATT task,
+ * except the reconnection timeout, which cancels the connection and starts
+ * the scan through the Bluetooth stack as the button task does. The memory
+ * report prints the least free stack of "Tmr Svc" to trim this by. */
+#define configTIMER_TASK_STACK_DEPTH            ( configMINIMAL_STACK_SIZE * 2 )
 
 /*
 Interrupt nesting behavior configuration.
@@ -162,7 +184,7 @@ to exclude the API function. */
 #define INCLUDE_xTaskGetSchedulerState          1
 #define INCLUDE_xTaskGetCurrentTaskHandle       1
 #define INCLUDE_uxTaskGetStackHighWaterMark     0
-#define INCLUDE_xTaskGetIdleTaskHandle          0
+#define INCLUDE_xTaskGetIdleTaskHandle          1
 #define INCLUDE_eTaskGetState                   0
 #define INCLUDE_xEventGroupSetBitFromISR        1
 #define INCLUDE_xTimerPendFunctionCall          1
@@ -55,21 +55,114 @@
 #include "cycfg_gap.h"
 #include "wiced_bt_dev.h"
 #include "app_bt_utils.h"
+#include "app_gatt_db_index.h"
+#include "app_bt_pool.h"
+#include "app_bt_conn.h"
+#include "app_cts_sched.h"
+#include "app_cts_time.h"
+#include "app_log.h"
+#include "app_scan_cache.h"
+#include "app_adv.h"
+#include "app_bt_reconnect.h"
+#include "app_bt_bond.h"
+#include "app_bt_conn_param.h"
+#include "app_bt_mtu.h"
+#include "app_bt_phy.h"
+#include "app_bt_prep_write.h"
+#include "app_bt_notify.h"
+#include "app_bt_gatt_task.h"
+#include "app_cpu.h"
+#include "app_latency.h"
 #include "cts_server.h"
 #include <stdlib.h>
 
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+/* A connection coming up or going down, as handed over to the GATT task. The
+ * stack only lends the peer address for the callback, so it is copied. */
+typedef struct
+{
+    wiced_bt_device_address_t bd_addr;
+    uint8_t                   addr_type;
+    uint8_t                   connected;
+    uint16_t                  conn_id;
+    uint16_t                  reason;
+} ctss_conn_event_t;
+
+/* A peer the stack thread found, encrypted a link to or stored keys of, as
+ * handed over to the GATT task */
+typedef struct
+{
+    wiced_bt_device_address_t bd_addr;
+    uint8_t                   addr_type;
+    wiced_result_t            result;
+} ctss_peer_event_t;
+
+/* The confirmation of an indication, as handed over to the GATT task */
+typedef struct
+{
+    uint16_t conn_id;
+    uint16_t handle;
+} ctss_confirm_event_t;
+
+/* Every event handed over must fit in the GATT task queue */
+typedef char ctss_conn_event_fits[(sizeof(ctss_conn_event_t) <=
+                                   APP_BT_GATT_TASK_CALL_DATA_LEN) ? 1 : -1];
+typedef char ctss_peer_event_fits[(sizeof(ctss_peer_event_t) <=
+                                   APP_BT_GATT_TASK_CALL_DATA_LEN) ? 1 : -1];
+typedef char ctss_confirm_event_fits[(sizeof(ctss_confirm_event_t) <=
+                                      APP_BT_GATT_TASK_CALL_DATA_LEN) ? 1 : -1];
+typedef char ctss_operation_fits[(sizeof(wiced_bt_gatt_operation_complete_t) <=
+                                  APP_BT_GATT_TASK_CALL_DATA_LEN) ? 1 : -1];
+typedef char ctss_conn_param_fits[(sizeof(wiced_bt_ble_connection_param_update_t) <=
+                                   APP_BT_GATT_TASK_CALL_DATA_LEN) ? 1 : -1];
+typedef char ctss_data_length_fits[(sizeof(wiced_bt_ble_data_length_update_t) <=
+                                    APP_BT_GATT_TASK_CALL_DATA_LEN) ? 1 : -1];
+typedef char ctss_phy_update_fits[(sizeof(wiced_bt_ble_phy_update_t) <=
+                                   APP_BT_GATT_TASK_CALL_DATA_LEN) ? 1 : -1];
+
 /*******************************************************************************
 *        Variable Definitions
 *******************************************************************************/
-static uint16_t bt_connection_id = 0;
 cyhal_rtc_t my_rtc;
 
+/* What makes an advertiser a CTS client: its name, or a request for the
+ * Current Time Service in its solicited service UUIDs */
+static const app_adv_rule_t ctss_peer_rules[] =
+{
+    { 0, APP_ADV_RULE_NAME,      0,                           "CTS Client" },
+    { 1, APP_ADV_RULE_SOLICIT16, __UUID_SERVICE_CURRENT_TIME, NULL },
+};
+static app_adv_matcher_t ctss_peer_matcher;
+
+/* Set by the scan callback when it hands a peer over to the GATT task and
+ * cleared by the task once it took it up */
+static volatile wiced_bool_t ctss_peer_handed_over;
+
+/* Read By Type responses are packed here, up to the MTU of the link, and
+ * then copied to a pool block of the size they need. Only used from the GATT
+ * task. */
+static uint8_t ctss_rsp_scratch[CY_BT_MTU_SIZE];
+
+/* Cycle count when the button interrupt woke the button task */
+static volatile uint32_t button_pressed_cycles;
+
 /*******************************************************************************
 *        Function Prototypes
 *******************************************************************************/
 static void           ble_app_init                (void);
-static void           ctss_send_notification      (void);
-static int            get_day_of_week             (int day, int month, int year);
+static void           ctss_notification_due       (void);
+static void           ctss_send_notification      (void *p_data);
+static void           ctss_notify                 (app_bt_conn_t *p_conn);
+static void           ctss_link_encrypted         (void *p_data);
+static void           ctss_keys_saved             (void *p_data);
+static void           ctss_peer_found             (void *p_data);
+static void           ctss_conn_param_updated     (void *p_data);
+static void           ctss_data_length_updated    (void *p_data);
+static void           ctss_phy_updated            (void *p_data);
+static void           ctss_update_notify_schedule (void);
+static void           ctss_start_scan             (void);
 static void           ctss_scan_result_cback      (wiced_bt_ble_scan_results_t *p_scan_result,
                                                    uint8_t *p_adv_data );
 
@@ -79,12 +172,22 @@ static wiced_bt_gatt_status_t ble_app_write_handler(uint16_t conn_id,
                                                     wiced_bt_gatt_opcode_t opcode,
                                                     wiced_bt_gatt_write_req_t *p_data, 
                                                     uint16_t *p_error_handle);
+static wiced_bt_gatt_status_t ble_app_prep_write_handler(uint16_t conn_id,
+                                                         wiced_bt_gatt_opcode_t opcode,
+                                                         wiced_bt_gatt_write_req_t *p_data,
+                                                         uint16_t *p_error_handle);
+static wiced_bt_gatt_status_t ctss_write_current_time(wiced_bt_gatt_write_req_t *p_data);
+static wiced_bt_gatt_status_t ctss_write_local_time_info(wiced_bt_gatt_write_req_t *p_data);
 static wiced_bt_gatt_status_t ble_app_read_handler(uint16_t conn_id,
                                                    wiced_bt_gatt_opcode_t opcode,
                                                    wiced_bt_gatt_read_t *p_read_data,
                                                    uint16_t len_requested, 
                                                    uint16_t *p_error_handle);
 static wiced_bt_gatt_status_t ble_app_connect_handler(wiced_bt_gatt_connection_status_t *p_conn_status);
+static void ble_app_connection_event(void *p_data);
+static void ble_app_mtu_event(void *p_data);
+static void ble_app_congestion_event(void *p_data);
+static void ble_app_confirm_event(void *p_data);
 static wiced_bt_gatt_status_t ble_app_server_handler(wiced_bt_gatt_attribute_request_t *p_data, 
                                                      uint16_t *p_error_handle);
 static wiced_bt_gatt_status_t ble_app_gatt_event_callback(wiced_bt_gatt_evt_t event,
@@ -94,9 +197,18 @@ static wiced_bt_gatt_status_t app_bt_gatt_req_read_by_type_handler(uint16_t conn
                                                                    wiced_bt_gatt_read_by_type_t *p_read_req,
                                                                    uint16_t len_requested, 
                                                                    uint16_t *p_error_handle);
+static int app_put_read_by_type_pair(uint16_t conn_id, gatt_db_lookup_table_t *puAttribute,
+                                     int used, int rsp_len, uint8_t *p_pair_len);
+static wiced_bt_gatt_status_t app_bt_gatt_req_read_multi_handler(uint16_t conn_id,
+                                                                 wiced_bt_gatt_opcode_t opcode,
+                                                                 wiced_bt_gatt_read_multiple_req_t *p_read_req,
+                                                                 uint16_t len_requested,
+                                                                 uint16_t *p_error_handle);
 static void* app_alloc_buffer(int len);
 static void app_free_buffer(uint8_t *p_event_data);
 gatt_db_lookup_table_t* app_get_attribute(uint16_t handle);
+static uint8_t* app_get_attribute_value(uint16_t conn_id, gatt_db_lookup_table_t *puAttribute,
+                                        uint16_t *p_len);
 
 /* Configure GPIO interrupt. */
 cyhal_gpio_callback_data_t button_cb_data =
@@ -126,6 +238,8 @@ wiced_result_t app_bt_management_callback(wiced_bt_management_evt_t event,
 {
     wiced_result_t result = WICED_BT_SUCCESS;
     wiced_bt_device_address_t bda = { 0 };
+    wiced_bt_dev_ble_io_caps_req_t *p_io_caps;
+    ctss_peer_event_t peer;
 
     switch (event)
     {
@@ -136,8 +250,7 @@ wiced_result_t app_bt_management_callback(wiced_bt_management_evt_t event,
             {
                 /* Bluetooth is enabled */
                 wiced_bt_dev_read_local_addr(bda);
-                printf("Local Bluetooth Address: ");
-                print_bd_address(bda);
+                APP_LOG(APP_LOG_BTM_LOCAL_ADDR, APP_LOG_BDA(bda));
 
                 /* Perform application-specific initialization */
                 ble_app_init();
@@ -149,25 +262,122 @@ wiced_result_t app_bt_management_callback(wiced_bt_management_evt_t event,
 
             if(p_event_data->ble_scan_state_changed == BTM_BLE_SCAN_TYPE_HIGH_DUTY)
             {
-                printf("Scan State Change: BTM_BLE_SCAN_TYPE_HIGH_DUTY\n");
+                APP_LOG0(APP_LOG_SCAN_STATE_HIGH_DUTY);
             }
             else if(p_event_data->ble_scan_state_changed == BTM_BLE_SCAN_TYPE_LOW_DUTY)
             {
-                printf("Scan State Change: BTM_BLE_SCAN_TYPE_LOW_DUTY\n");
+                APP_LOG0(APP_LOG_SCAN_STATE_LOW_DUTY);
             }
             else if(p_event_data->ble_scan_state_changed == BTM_BLE_SCAN_TYPE_NONE)
             {
-                printf("Scan stopped\n");
+                APP_LOG0(APP_LOG_SCAN_STATE_STOPPED);
+            }
+            else
+            {
+                APP_LOG0(APP_LOG_SCAN_STATE_INVALID);
+            }
+            break;
+
+        case BTM_PAIRING_IO_CAPABILITIES_BLE_REQUEST_EVT:
+            /* No display and no keyboard: Just Works pairing, with bonding */
+            p_io_caps = &p_event_data->pairing_io_capabilities_ble_request;
+            p_io_caps->local_io_cap = BTM_IO_CAPABILITIES_NONE;
+            p_io_caps->oob_data     = BTM_OOB_NONE;
+            p_io_caps->auth_req     = BTM_LE_AUTH_REQ_SC_BOND;
+            p_io_caps->max_key_size = 0x10;
+            p_io_caps->init_keys    = BTM_LE_KEY_PENC | BTM_LE_KEY_PID;
+            p_io_caps->resp_keys    = BTM_LE_KEY_PENC | BTM_LE_KEY_PID;
+            break;
+
+        case BTM_SECURITY_REQUEST_EVT:
+            wiced_bt_ble_security_grant(p_event_data->security_request.bd_addr,
+                                        WICED_BT_SUCCESS);
+            break;
+
+        case BTM_PAIRING_COMPLETE_EVT:
+            APP_LOG(APP_LOG_BOND_PAIRING_DONE,
+                    p_event_data->pairing_complete.pairing_complete_info.ble.reason);
+            break;
+
+        case BTM_ENCRYPTION_STATUS_EVT:
+            /* The CCCD of the client is restored by the GATT task */
+            memset(&peer, 0, sizeof(peer));
+            memcpy(peer.bd_addr, p_event_data->encryption_status.bd_addr, BD_ADDR_LEN);
+            peer.result = p_event_data->encryption_status.result;
+            app_bt_gatt_task_defer(ctss_link_encrypted, &peer, sizeof(peer));
+            break;
+
+        case BTM_PAIRED_DEVICE_LINK_KEYS_UPDATE_EVT:
+            /* The keys are stored right away; the GATT task then adds what
+             * the client has subscribed to so far */
+            result = app_bt_bond_save_keys(&p_event_data->paired_device_link_keys_update);
+            APP_LOG(APP_LOG_BOND_SAVED,
+                    APP_LOG_BDA(p_event_data->paired_device_link_keys_update.bd_addr));
+            if (WICED_BT_SUCCESS != result)
+            {
+                APP_LOG(APP_LOG_BOND_STORE_FAILED, result);
+                result = WICED_BT_SUCCESS;
             }
             else
             {
-                printf("Invalid scan state\n");
+                memset(&peer, 0, sizeof(peer));
+                memcpy(peer.bd_addr, p_event_data->paired_device_link_keys_update.bd_addr,
+                       BD_ADDR_LEN);
+                app_bt_gatt_task_defer(ctss_keys_saved, &peer, sizeof(peer));
+            }
+            break;
+
+        case BTM_PAIRED_DEVICE_LINK_KEYS_REQUEST_EVT:
+            /* Unknown peers get an error, which makes the stack pair with them */
+            result = app_bt_bond_load_keys(&p_event_data->paired_device_link_keys_request);
+            break;
+
+        case BTM_LOCAL_IDENTITY_KEYS_UPDATE_EVT:
+            result = app_bt_bond_save_identity(&p_event_data->local_identity_keys_update);
+            if (WICED_BT_SUCCESS != result)
+            {
+                APP_LOG(APP_LOG_BOND_STORE_FAILED, result);
+                result = WICED_BT_SUCCESS;
             }
             break;
 
+        case BTM_LOCAL_IDENTITY_KEYS_REQUEST_EVT:
+            /* None stored yet: the stack generates them and sends an update */
+            result = app_bt_bond_load_identity(&p_event_data->local_identity_keys_request);
+            break;
+
+        case BTM_BLE_CONNECTION_PARAM_UPDATE:
+            APP_LOG(APP_LOG_CONN_PARAM_UPDATE,
+                    p_event_data->ble_connection_param_update.status,
+                    p_event_data->ble_connection_param_update.conn_interval,
+                    p_event_data->ble_connection_param_update.conn_latency,
+                    p_event_data->ble_connection_param_update.supervision_timeout);
+            app_bt_gatt_task_defer(ctss_conn_param_updated,
+                                   &p_event_data->ble_connection_param_update,
+                                   sizeof(p_event_data->ble_connection_param_update));
+            break;
+
+        case BTM_BLE_DATA_LENGTH_UPDATE_EVENT:
+            APP_LOG(APP_LOG_DATA_LENGTH_UPDATE,
+                    p_event_data->ble_data_length_update_event.max_tx_octets,
+                    p_event_data->ble_data_length_update_event.max_rx_octets);
+            app_bt_gatt_task_defer(ctss_data_length_updated,
+                                   &p_event_data->ble_data_length_update_event,
+                                   sizeof(p_event_data->ble_data_length_update_event));
+            break;
+
+        case BTM_BLE_PHY_UPDATE_EVT:
+            APP_LOG(APP_LOG_PHY_UPDATE,
+                    p_event_data->ble_phy_update_event.status,
+                    p_event_data->ble_phy_update_event.tx_phy,
+                    p_event_data->ble_phy_update_event.rx_phy);
+            app_bt_gatt_task_defer(ctss_phy_updated,
+                                   &p_event_data->ble_phy_update_event,
+                                   sizeof(p_event_data->ble_phy_update_event));
+            break;
+
         default:
-            printf("Unhandled Bluetooth Management Event: 0x%x %s\n", event,
-                                                   get_btm_event_name(event));
+            APP_LOG(APP_LOG_BTM_UNHANDLED, event, event);
             break;
     }
     return result;
@@ -194,6 +404,23 @@ static void ble_app_init(void)
     cy_rslt_t              cy_result = CY_RSLT_SUCCESS;
     wiced_bt_gatt_status_t status    = WICED_BT_GATT_ERROR;
 
+    /* Response buffers come from the fixed-block pool */
+    app_bt_pool_init();
+
+    /* No clients are connected yet */
+    app_bt_conn_init();
+    app_bt_mtu_init();
+    app_bt_prep_write_init();
+    app_bt_notify_init();
+    app_scan_cache_init();
+    if (WICED_BT_SUCCESS != app_adv_matcher_init(&ctss_peer_matcher, ctss_peer_rules,
+                                                 (uint8_t)(sizeof(ctss_peer_rules) /
+                                                           sizeof(ctss_peer_rules[0]))))
+    {
+        printf("[Error] : Invalid peer match rules!! ");
+        CY_ASSERT(0);
+    }
+
     /* Initialize GPIO for button interrupt*/
     cy_result = cyhal_gpio_init(CYBSP_USER_BTN, CYHAL_GPIO_DIR_INPUT,
                                 CYHAL_GPIO_DRIVE_PULLUP, CYBSP_BTN_OFF);
@@ -217,18 +444,56 @@ static void ble_app_init(void)
         CY_ASSERT(0);
     }
 
-   /* Disable pairing for this application */
-    wiced_bt_set_pairable_mode(WICED_FALSE, 0);
+    /* Keep the Current Time value encoded from now on */
+    app_cts_time_init(&my_rtc, app_cts_current_time);
+
+    /* Notifications are sent on the RTC second rollover once a client subscribes */
+    if (WICED_BT_SUCCESS != app_cts_sched_init(ctss_notification_due))
+    {
+        printf("[Error] : Notification timer creation failed!! ");
+        CY_ASSERT(0);
+    }
+
+    /* Clients that drop are reconnected directly, with a scan as fallback */
+    if (WICED_BT_SUCCESS != app_bt_reconnect_init(ctss_start_scan))
+    {
+        printf("[Error] : Reconnect timer creation failed!! ");
+        CY_ASSERT(0);
+    }
+
+    /* Links run fast while clients send requests and relax when they only
+     * receive notifications */
+    if (WICED_BT_SUCCESS != app_bt_conn_param_init())
+    {
+        printf("[Error] : Connection parameter timer creation failed!! ");
+        CY_ASSERT(0);
+    }
+
+    /* Close clients move to the LE 2M PHY, distant ones to LE Coded */
+    if (WICED_BT_SUCCESS != app_bt_phy_init())
+    {
+        printf("[Error] : PHY timer creation failed!! ");
+        CY_ASSERT(0);
+    }
+
+    /* Clients pair and bond, so that they come back encrypted and subscribed */
+    wiced_bt_set_pairable_mode(WICED_TRUE, 0);
+    app_bt_bond_load_resolving_list();
+
+    /* Attribute requests are handled by the GATT task, not the stack thread */
+    if (WICED_BT_SUCCESS != app_bt_gatt_task_init(ble_app_server_handler))
+    {
+        printf("[Error] : GATT task creation failed!! ");
+        CY_ASSERT(0);
+    }
 
     /* Register with BT stack to receive GATT callback */
     status = wiced_bt_gatt_register(ble_app_gatt_event_callback );
-    printf("GATT event Handler registration status: %s \n",
-            get_bt_gatt_status_name(status));
+    APP_LOG(APP_LOG_GATT_REGISTER, status);
 
     /* Initialize GATT Database */
     status = wiced_bt_gatt_db_init(gatt_database, gatt_database_len, NULL);
-    printf("GATT database initialization status: %s \n",
-            get_bt_gatt_status_name(status));
+    APP_LOG(APP_LOG_GATT_DB_INIT, status);
 
     printf("Press User button to start scanning.....\n");
 }
@@ -252,57 +517,108 @@ static void ble_app_init(void)
 void ctss_scan_result_cback(wiced_bt_ble_scan_results_t *p_scan_result,
                             uint8_t *p_adv_data )
 {
-    wiced_result_t         result = WICED_BT_SUCCESS;
-    uint8_t                length = 0u;
-    uint8_t                *adv_name;
-    uint8_t                client_device_name[15] = {'C','T','S',' ','C','l',
-                                                     'i','e','n','t','\0'};
+    app_scan_cache_result_t cached;
+    app_adv_info_t          adv_info;
+    ctss_peer_event_t       peer;
 
     if (p_scan_result)
     {
-        adv_name = wiced_bt_ble_check_advertising_data(p_adv_data,
-                                BTM_BLE_ADVERT_TYPE_NAME_COMPLETE,
-                                                         &length);
-        if(NULL == adv_name)
+        /* Advertisers repeat the same report many times a second; answer the
+         * repeats from the cache without parsing or logging them again */
+        cached = app_scan_cache_lookup(p_scan_result);
+        if(APP_SCAN_CACHE_OTHER == cached)
         {
             return;
         }
-        /* Check if the peer device's name is "BLE CTS Client" */
-        if(0 == memcmp(adv_name, client_device_name, strlen((const char *)client_device_name)))
+        if(APP_SCAN_CACHE_MISS == cached)
         {
-            printf("\nFound the peer device! BD Addr: ");
-            print_bd_address(p_scan_result->remote_bd_addr);
-
-            /* Device found. Stop scan. */
-            if((result = wiced_bt_ble_scan(BTM_BLE_SCAN_TYPE_NONE, WICED_TRUE,
-                                           ctss_scan_result_cback))!= WICED_BT_SUCCESS)
+            /* Parse the report once and check it against the peer rules */
+            app_adv_parse(p_adv_data, APP_ADV_DATA_MAX_LEN, &adv_info);
+            if(!app_adv_match(&ctss_peer_matcher, &adv_info))
             {
-                printf("\r\nscan off status %d\n", result);
-            }
-            else
-            {
-                printf("Scan completed\n\n");
+                app_scan_cache_insert(p_scan_result, APP_SCAN_CACHE_OTHER);
+                if(0 != (adv_info.present & (APP_ADV_HAS_NAME | APP_ADV_HAS_NAME_SHORT)))
+                {
+                    APP_LOG(APP_LOG_SCAN_OTHER_DEVICE,
+                            APP_LOG_BDA(p_scan_result->remote_bd_addr));
+                }
+                return;    //Skip - This is not the device we are looking for.
             }
+            app_scan_cache_insert(p_scan_result, APP_SCAN_CACHE_PEER);
+        }
 
-            printf("Initiating connection\n");
-            /* Initiate the connection */
-            if(wiced_bt_gatt_le_connect(p_scan_result->remote_bd_addr,
-                                        p_scan_result->ble_addr_type,
-                                        BLE_CONN_MODE_HIGH_DUTY,
-                                        WICED_TRUE)!= WICED_TRUE)
-            {
-                printf("\rwiced_bt_gatt_connect failed\n");
-            }
+        /* The GATT task knows which clients are connected; it connects to
+         * this one unless it already is. Repeats that come in before it got
+         * to the first one are not handed over again. */
+        if (ctss_peer_handed_over)
+        {
+            return;
         }
-        else
+        memset(&peer, 0, sizeof(peer));
+        memcpy(peer.bd_addr, p_scan_result->remote_bd_addr, BD_ADDR_LEN);
+        peer.addr_type = (uint8_t)p_scan_result->ble_addr_type;
+        ctss_peer_handed_over = WICED_TRUE;
+        if (WICED_BT_SUCCESS != app_bt_gatt_task_defer(ctss_peer_found, &peer, sizeof(peer)))
         {
-            printf("BD Addr: ");
-            print_bd_address(p_scan_result->remote_bd_addr);
-            return;    //Skip - This is not the device we are looking for.
+            ctss_peer_handed_over = WICED_FALSE;
         }
     }
 }
 
+/********************************************************************************
+* Function Name: ctss_peer_found
+*********************************************************************************
+* Summary:
+*   Runs in the GATT task when the scan found a CTS client. Stops the scan
+*   and connects to the client, unless it is already connected or being
+*   reconnected.
+*
+* Parameters:
+*   void *p_data: ctss_peer_event_t of the client
+*
+* Return:
+*   None
+*
+*********************************************************************************/
+static void ctss_peer_found(void *p_data)
+{
+    ctss_peer_event_t *p_peer = (ctss_peer_event_t *)p_data;
+    wiced_result_t result;
+
+    /* The scan may hand over the next report */
+    ctss_peer_handed_over = WICED_FALSE;
+
+    /* Skip clients that are already connected or being reconnected */
+    if((NULL != app_bt_conn_find_by_addr(p_peer->bd_addr)) ||
+       app_bt_reconnect_is_direct(p_peer->bd_addr))
+    {
+        return;
+    }
+
+    APP_LOG(APP_LOG_SCAN_PEER_FOUND, APP_LOG_BDA(p_peer->bd_addr));
+
+    /* Device found. Stop scan. */
+    if((result = wiced_bt_ble_scan(BTM_BLE_SCAN_TYPE_NONE, WICED_TRUE,
+                                   ctss_scan_result_cback))!= WICED_BT_SUCCESS)
+    {
+        APP_LOG(APP_LOG_SCAN_OFF_FAILED, result);
+    }
+    else
+    {
+        APP_LOG0(APP_LOG_SCAN_COMPLETED);
+    }
+
+    APP_LOG0(APP_LOG_SCAN_CONNECTING);
+    /* Initiate the connection */
+    if(wiced_bt_gatt_le_connect(p_peer->bd_addr,
+                                (wiced_bt_ble_address_type_t)p_peer->addr_type,
+                                BLE_CONN_MODE_HIGH_DUTY,
+                                WICED_TRUE)!= WICED_TRUE)
+    {
+        APP_LOG0(APP_LOG_SCAN_CONNECT_FAILED);
+    }
+}
+
 /********************************************************************************
 * Function Name: ble_app_gatt_event_callback
 *********************************************************************************
@@ -322,9 +638,12 @@ static wiced_bt_gatt_status_t ble_app_gatt_event_callback (wiced_bt_gatt_evt_t e
                                                            wiced_bt_gatt_event_data_t *p_event_data)
 {
     wiced_bt_gatt_status_t gatt_status = WICED_BT_GATT_SUCCESS;
+    uint32_t entered = app_cpu_counter();
 
     uint16_t error_handle = 0;
     wiced_bt_gatt_attribute_request_t *p_attr_req = &p_event_data->attribute_request;
+    wiced_bt_gatt_connection_status_t *p_conn_status = &p_event_data->connection_status;
+    ctss_conn_event_t conn_event;
 
     /* Call the appropriate callback function based on the GATT event type,
        and pass the relevant event
@@ -333,12 +652,44 @@ static wiced_bt_gatt_status_t ble_app_gatt_event_callback (wiced_bt_gatt_evt_t e
     switch ( event )
     {
         case GATT_CONNECTION_STATUS_EVT:
-            gatt_status = ble_app_connect_handler(&p_event_data->connection_status);
+            /* The GATT task owns the connection table; the event goes
+             * behind the requests already queued for the connection */
+            memset(&conn_event, 0, sizeof(conn_event));
+            memcpy(conn_event.bd_addr, p_conn_status->bd_addr, BD_ADDR_LEN);
+            conn_event.addr_type = (uint8_t)p_conn_status->addr_type;
+            conn_event.connected = p_conn_status->connected ? 1u : 0u;
+            conn_event.conn_id   = p_conn_status->conn_id;
+            conn_event.reason    = (uint16_t)p_conn_status->reason;
+            if (WICED_BT_SUCCESS != app_bt_gatt_task_defer_reserved(ble_app_connection_event,
+                                                                    &conn_event,
+                                                                    sizeof(conn_event)))
+            {
+                gatt_status = WICED_BT_GATT_INSUF_RESOURCE;
+            }
             break;
 
         case GATT_ATTRIBUTE_REQUEST_EVT:
+            /* A confirmation takes no response, not even an error. It goes
+             * through the reserved call slots: lost, it would hold back the
+             * link's indications for good. */
+            if (GATT_HANDLE_VALUE_CONF == p_attr_req->opcode)
+            {
+                ctss_confirm_event_t confirm;
+
+                confirm.conn_id = p_attr_req->conn_id;
+                confirm.handle  = p_attr_req->data.confirm_handle;
+                app_bt_gatt_task_defer_reserved(ble_app_confirm_event, &confirm,
+                                                sizeof(confirm));
+                app_bt_gatt_task_residency(entered);
+                break;
+            }
+#if APP_BT_GATT_TASK_ENABLE
+            /* Only copied here; the GATT task handles it and responds */
+            gatt_status = app_bt_gatt_task_post(p_attr_req);
+#else
             gatt_status = ble_app_server_handler(&p_event_data->attribute_request, 
                                                  &error_handle);
+#endif
             if(gatt_status != WICED_BT_GATT_SUCCESS)
             {  
               wiced_bt_gatt_server_send_error_rsp(p_attr_req->conn_id, 
@@ -346,7 +697,36 @@ static wiced_bt_gatt_status_t ble_app_gatt_event_callback (wiced_bt_gatt_evt_t e
                                                   error_handle, 
                                                   gatt_status);
             }
+            app_bt_gatt_task_residency(entered);
+            break;
+
+        case GATT_OPERATION_CPLT_EVT:
+            /* Completion of the MTU exchange started on connection */
+            if ((GATTC_OPTYPE_CONFIG_MTU == p_event_data->operation_complete.op) &&
+                (WICED_BT_GATT_SUCCESS == p_event_data->operation_complete.status))
+            {
+                app_bt_gatt_task_defer(ble_app_mtu_event, &p_event_data->operation_complete,
+                                       sizeof(p_event_data->operation_complete));
+            }
+            break;
+
+        case GATT_CONGESTION_EVT:
+            /* Queued notifications wait until the stack takes data again */
+            app_bt_gatt_task_defer(ble_app_congestion_event, &p_event_data->congestion,
+                                   sizeof(p_event_data->congestion));
+            break;
+
+        case GATT_APP_BUFFER_TRANSMITTED_EVT:
+        {
+            pfn_free_buffer_t pfn_free = (pfn_free_buffer_t)p_event_data->buffer_xmitted.p_app_ctxt;
 
+            /* If the buffer is dynamic, the context will point to a function to free it:
+             * a pool block, or an entry of the notification queue. */
+            if (pfn_free)
+            {
+                pfn_free(p_event_data->buffer_xmitted.p_app_data);
+            }
+        }
             break;
 
         default:
@@ -378,50 +758,206 @@ static wiced_bt_gatt_status_t ble_app_write_handler(uint16_t conn_id,
                                                     uint16_t *p_error_handle)
 {
     wiced_bt_gatt_status_t gatt_status = WICED_BT_GATT_INVALID_HANDLE;
-    int i = 0;
-    wiced_bool_t isHandleInTable = WICED_FALSE;
-    wiced_bool_t validLen = WICED_FALSE;
+    gatt_db_lookup_table_t *puAttribute;
+    app_bt_conn_t *p_conn;
 
     *p_error_handle = p_data->handle;
 
-    /* Check for a matching handle entry */
-    for(i = 0; i < app_gatt_db_ext_attr_tbl_size; i++)
+    /* The Current Time CCCD is kept separately for every client */
+    if (HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG == p_data->handle)
     {
-        if(app_gatt_db_ext_attr_tbl[i].handle == p_data->handle)
+        if (NULL == (p_conn = app_bt_conn_find(conn_id)))
         {
-            /* Detected a matching handle in external lookup table */
-            isHandleInTable = WICED_TRUE;
-
-            /* Check if the buffer has space to store the data */
-            validLen = (app_gatt_db_ext_attr_tbl[i].max_len >= p_data->val_len);
-
-            if(validLen)
-            {
-                /* Value fits within the supplied buffer; copy over the value */
-                app_gatt_db_ext_attr_tbl[i].cur_len = p_data->val_len;
-                memcpy(app_gatt_db_ext_attr_tbl[i].p_data, p_data->p_val,
-                       p_data->val_len);
-                gatt_status = WICED_BT_GATT_SUCCESS;
-            }
-            else
-            {
-                /* Value to write does not meet size constraints */
-                gatt_status = WICED_BT_GATT_INVALID_ATTR_LEN;
-            }
-            break;
+            return WICED_BT_GATT_INVALID_HANDLE;
+        }
+        if (APP_BT_CONN_CCCD_LEN != p_data->val_len)
+        {
+            return WICED_BT_GATT_INVALID_ATTR_LEN;
         }
+        app_bt_conn_set_cccd(p_conn, p_data->p_val);
+        app_bt_bond_set_peer(p_conn);
+        ctss_update_notify_schedule();
+        return WICED_BT_GATT_SUCCESS;
+    }
+
+    /* Writes to the time set the clock rather than the stored value */
+    if (HDLC_CTS_CURRENT_TIME_VALUE == p_data->handle)
+    {
+        return ctss_write_current_time(p_data);
+    }
+    if (HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE == p_data->handle)
+    {
+        return ctss_write_local_time_info(p_data);
     }
 
-    if (!isHandleInTable)
+    /* Check for a matching handle entry */
+    if (NULL == (puAttribute = app_get_attribute(p_data->handle)))
     {
         /* The write operation was not performed for the indicated handle */
-        printf("Write Request to Invalid Handle: 0x%x\n", p_data->handle);
-        gatt_status = WICED_BT_GATT_INVALID_HANDLE;
+        APP_LOG(APP_LOG_GATT_WRITE_INVALID, p_data->handle);
+        return WICED_BT_GATT_INVALID_HANDLE;
+    }
+
+    /* Check if the buffer has space to store the data */
+    if (puAttribute->max_len >= p_data->val_len)
+    {
+        /* Value fits within the supplied buffer; copy over the value */
+        puAttribute->cur_len = p_data->val_len;
+        memcpy(puAttribute->p_data, p_data->p_val, p_data->val_len);
+        gatt_status = WICED_BT_GATT_SUCCESS;
+    }
+    else
+    {
+        /* Value to write does not meet size constraints */
+        gatt_status = WICED_BT_GATT_INVALID_ATTR_LEN;
+    }
+
+    return gatt_status;
+}
+
+/*******************************************************************************
+* Function Name: ble_app_prep_write_handler
+********************************************************************************
+* Summary:
+*   This function handles Prepare Write Requests received from the client
+*   device. The value is queued for the connection and written to the GATT
+*   database when the client sends an Execute Write Request.
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*  wiced_bt_gatt_opcode_t opcode: GATT opcode
+*  wiced_bt_gatt_write_req_t * p_data: Write data structure
+*  uint16_t *p_error_handle: Receives the handle an error refers to
+*
+* Return:
+*  wiced_bt_gatt_status_t: See possible status codes in wiced_bt_gatt_status_e
+*                          in wiced_bt_gatt.h
+*
+*******************************************************************************/
+static wiced_bt_gatt_status_t ble_app_prep_write_handler(uint16_t conn_id,
+                                                         wiced_bt_gatt_opcode_t opcode,
+                                                         wiced_bt_gatt_write_req_t *p_data,
+                                                         uint16_t *p_error_handle)
+{
+    wiced_bt_gatt_status_t gatt_status;
+    gatt_db_lookup_table_t *puAttribute;
+    uint8_t *p_staged;
+
+    *p_error_handle = p_data->handle;
+
+    /* The Current Time CCCD is kept for every client, and the time values
+     * set the clock; all are written whole */
+    if ((HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG == p_data->handle) ||
+        (HDLC_CTS_CURRENT_TIME_VALUE == p_data->handle) ||
+        (HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE == p_data->handle))
+    {
+        return WICED_BT_GATT_NOT_LONG;
+    }
+
+    if (NULL == (puAttribute = app_get_attribute(p_data->handle)))
+    {
+        APP_LOG(APP_LOG_GATT_WRITE_INVALID, p_data->handle);
+        return WICED_BT_GATT_INVALID_HANDLE;
+    }
+
+    gatt_status = app_bt_prep_write_add(conn_id, puAttribute, p_data, &p_staged);
+    if (WICED_BT_GATT_SUCCESS != gatt_status)
+    {
+        return gatt_status;
     }
 
+    /* Echo the value from the queue, where it stays until executed */
+    gatt_status = wiced_bt_gatt_server_send_prepare_write_rsp(conn_id, opcode, p_data->handle,
+                                                              p_data->offset, p_data->val_len,
+                                                              p_staged, NULL);
+    if (WICED_BT_GATT_SUCCESS == gatt_status)
+    {
+        app_bt_mtu_sent(conn_id, (uint16_t)(APP_BT_MTU_PREP_WRITE_HDR_LEN + p_data->val_len));
+    }
     return gatt_status;
 }
 
+/*******************************************************************************
+* Function Name: ctss_write_current_time
+********************************************************************************
+* Summary:
+*   Sets the clock from a Current Time value written by a client. The written
+*   Fractions256 is kept, and the Manual and External Update bits of its
+*   Adjust Reason go out with the next encoded value; a write with neither is
+*   marked as a manual update. The other bits are the server's to set.
+*
+* Parameters:
+*  wiced_bt_gatt_write_req_t *p_data: Write data structure
+*
+* Return:
+*  wiced_bt_gatt_status_t: See possible status codes in wiced_bt_gatt_status_e
+*                          in wiced_bt_gatt.h
+*
+*******************************************************************************/
+static wiced_bt_gatt_status_t ctss_write_current_time(wiced_bt_gatt_write_req_t *p_data)
+{
+    uint8_t reason;
+    int64_t epoch;
+    wiced_result_t result;
+
+    if (APP_CTS_TIME_PAYLOAD_LEN != p_data->val_len)
+    {
+        return WICED_BT_GATT_INVALID_ATTR_LEN;
+    }
+    if (WICED_BT_SUCCESS != app_cts_time_decode(p_data->p_val, &epoch))
+    {
+        return WICED_BT_GATT_VALUE_NOT_ALLOWED;
+    }
+
+    reason = p_data->p_val[APP_CTS_TIME_ADJUST_REASON] &
+             (APP_CTS_TIME_ADJUST_MANUAL | APP_CTS_TIME_ADJUST_EXTERNAL);
+    if (0u == reason)
+    {
+        reason = APP_CTS_TIME_ADJUST_MANUAL;
+    }
+
+    result = app_cts_time_set(epoch, p_data->p_val[APP_CTS_TIME_FRACTIONS256], reason);
+    if (WICED_BT_BADARG == result)
+    {
+        return WICED_BT_GATT_VALUE_NOT_ALLOWED;
+    }
+    return (WICED_BT_SUCCESS == result) ? WICED_BT_GATT_SUCCESS : WICED_BT_GATT_ERROR;
+}
+
+/*******************************************************************************
+* Function Name: ctss_write_local_time_info
+********************************************************************************
+* Summary:
+*   Sets the time zone and DST offsets of the Current Time from a Local Time
+*   Information value written by a client, and keeps the value for reads.
+*
+* Parameters:
+*  wiced_bt_gatt_write_req_t *p_data: Write data structure
+*
+* Return:
+*  wiced_bt_gatt_status_t: See possible status codes in wiced_bt_gatt_status_e
+*                          in wiced_bt_gatt.h
+*
+*******************************************************************************/
+static wiced_bt_gatt_status_t ctss_write_local_time_info(wiced_bt_gatt_write_req_t *p_data)
+{
+    int32_t tz_s;
+    int32_t dst_s;
+
+    if (APP_CTS_TIME_LTI_LEN != p_data->val_len)
+    {
+        return WICED_BT_GATT_INVALID_ATTR_LEN;
+    }
+    if (WICED_BT_SUCCESS != app_cts_time_decode_local_info(p_data->p_val, &tz_s, &dst_s))
+    {
+        return WICED_BT_GATT_VALUE_NOT_ALLOWED;
+    }
+
+    memcpy(app_cts_local_time_information, p_data->p_val, APP_CTS_TIME_LTI_LEN);
+    app_cts_time_set_local_offset(tz_s, dst_s);
+    return WICED_BT_GATT_SUCCESS;
+}
+
 /*******************************************************************************
 * Function Name: ble_app_read_handler
 ********************************************************************************
@@ -447,6 +983,8 @@ static wiced_bt_gatt_status_t ble_app_read_handler( uint16_t conn_id,
 {
     wiced_bt_gatt_status_t gatt_status = WICED_BT_SUCCESS;
     gatt_db_lookup_table_t *puAttribute;
+    uint8_t *p_value;
+    uint16_t value_len;
     int attr_len_to_copy;
 
     *p_error_handle = p_read_data->handle;
@@ -457,25 +995,59 @@ static wiced_bt_gatt_status_t ble_app_read_handler( uint16_t conn_id,
         return WICED_BT_GATT_INVALID_HANDLE;
     }
 
-    attr_len_to_copy = puAttribute->cur_len;
+    p_value = app_get_attribute_value(conn_id, puAttribute, &value_len);
+    attr_len_to_copy = value_len;
 
-    printf("GATT Read handler: handle:0x%X, len:%d\n",
-            p_read_data->handle, attr_len_to_copy);
+    APP_LOG(APP_LOG_GATT_READ, p_read_data->handle, attr_len_to_copy);
 
     /* If the incoming offset is greater than the current length in the GATT DB
     then the data cannot be read back*/
-    if (p_read_data->offset >= puAttribute->cur_len)
+    if (p_read_data->offset >= attr_len_to_copy)
     {
         return (WICED_BT_GATT_INVALID_OFFSET);
     }
 
-    int to_send = MIN(len_requested, attr_len_to_copy - p_read_data->offset);
+    int to_send = MIN(app_bt_mtu_payload_len(conn_id, len_requested, APP_BT_MTU_READ_RSP_HDR_LEN),
+                      attr_len_to_copy - p_read_data->offset);
 
-    uint8_t *from = ((uint8_t *)puAttribute->p_data) + p_read_data->offset;
+    uint8_t *from = p_value + p_read_data->offset;
 
     gatt_status = wiced_bt_gatt_server_send_read_handle_rsp(conn_id, opcode, to_send, from, NULL);
+    if (WICED_BT_GATT_SUCCESS == gatt_status)
+    {
+        app_bt_mtu_sent(conn_id, (uint16_t)(APP_BT_MTU_READ_RSP_HDR_LEN + to_send));
+    }
     return gatt_status;
 }
+/*******************************************************************************
+* Function Name: app_put_read_by_type_pair
+********************************************************************************
+* Summary:
+* This function appends the handle and value of one attribute to the Read By
+* Type response being built in the scratch buffer
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*  gatt_db_lookup_table_t *puAttribute: Attribute to add
+*  int used: Bytes of the response already filled
+*  int rsp_len: Size the response may grow to
+*  uint8_t *p_pair_len: Length of each handle-value pair, set by the first one
+*
+* Return:
+*  int: Bytes added, 0 if the pair does not fit
+*
+*******************************************************************************/
+static int app_put_read_by_type_pair(uint16_t conn_id, gatt_db_lookup_table_t *puAttribute,
+                                     int used, int rsp_len, uint8_t *p_pair_len)
+{
+    uint16_t value_len;
+    uint8_t *p_value = app_get_attribute_value(conn_id, puAttribute, &value_len);
+
+    return wiced_bt_gatt_put_read_by_type_rsp_in_stream(ctss_rsp_scratch + used, rsp_len - used,
+                                                        p_pair_len, puAttribute->handle,
+                                                        value_len, p_value);
+}
+
 /*******************************************************************************
 * Function Name: app_gatt_read_by_type_handler
 ********************************************************************************
@@ -499,68 +1071,88 @@ static wiced_bt_gatt_status_t app_bt_gatt_req_read_by_type_handler(uint16_t conn
                                                                    uint16_t *p_error_handle)
 {
     gatt_db_lookup_table_t *puAttribute;
+    const app_gatt_db_type_handle_t *p_match;
     wiced_bt_gatt_status_t gatt_status;
+    uint16_t match_count;
     uint16_t last_handle = 0;
     uint16_t attr_handle = p_read_req->s_handle;
-    uint8_t *p_rsp = app_alloc_buffer(len_requested);
+    uint16_t rsp_len = app_bt_mtu_payload_len(conn_id, len_requested,
+                                              APP_BT_MTU_READ_BY_TYPE_HDR_LEN);
+    uint8_t *p_rsp;
     uint8_t pair_len = 0;
+    uint16_t i;
     int used = 0;
+    int filled;
 
-    if (p_rsp == NULL)
-    {
-        printf("No memory, len_requested: %d!!\r\n",len_requested);
-        return WICED_BT_GATT_INSUF_RESOURCE;
-    }
-
-    /* Read by type returns all attributes of the specified type, between the
-       start and end handles */
-    while (WICED_TRUE)
+    *p_error_handle = attr_handle;
+    if (LEN_UUID_16 == p_read_req->uuid.len)
     {
-        *p_error_handle = attr_handle;
-        last_handle = attr_handle;
-        attr_handle = wiced_bt_gatt_find_handle_by_type(attr_handle,
-                                                        p_read_req->e_handle,
-                                                        &p_read_req->uuid);
-        if (attr_handle == 0)
-            break;
-
-        if ((puAttribute = app_get_attribute(attr_handle)) == NULL)
-        {
-            printf("found type but no attribute for %d \r\n",last_handle);
-            app_free_buffer(p_rsp);
-            return WICED_BT_GATT_INVALID_HANDLE;
-        }
-
+        /* The attributes of a 16-bit type come in handle order from the type
+           index generated at build time */
+        p_match = app_gatt_db_type_find(app_gatt_db_types, app_gatt_db_types_size,
+                                        app_gatt_db_type_handles, p_read_req->uuid.uu.uuid16,
+                                        p_read_req->s_handle, p_read_req->e_handle,
+                                        &match_count);
+        for (i = 0; i < match_count; i++)
         {
-            int filled = wiced_bt_gatt_put_read_by_type_rsp_in_stream(p_rsp + used,
-                                                                      len_requested - used,
-                                                                      &pair_len,
-                                                                      attr_handle,
-                                                                      puAttribute->cur_len,
-                                                                      puAttribute->p_data);
+            filled = app_put_read_by_type_pair(conn_id,
+                                               &app_gatt_db_ext_attr_tbl[p_match[i].entry],
+                                               used, rsp_len, &pair_len);
             if (filled == 0)
             {
                 break;
             }
             used += filled;
         }
-
-        /* Increment starting handle for next search to one past current */
-        attr_handle++;
+    }
+    else
+    {
+        /* Other types are not indexed: search the database, restarting one
+           past each match */
+        while (WICED_TRUE)
+        {
+            *p_error_handle = attr_handle;
+            last_handle = attr_handle;
+            attr_handle = wiced_bt_gatt_find_handle_by_type(attr_handle,
+                                                            p_read_req->e_handle,
+                                                            &p_read_req->uuid);
+            if (attr_handle == 0)
+                break;
+
+            if ((puAttribute = app_get_attribute(attr_handle)) == NULL)
+            {
+                APP_LOG(APP_LOG_GATT_TYPE_NO_ATTR, last_handle);
+                return WICED_BT_GATT_INVALID_HANDLE;
+            }
+
+            filled = app_put_read_by_type_pair(conn_id, puAttribute, used, rsp_len,
+                                               &pair_len);
+            if (filled == 0)
+            {
+                break;
+            }
+            used += filled;
+
+            /* Increment starting handle for next search to one past current */
+            attr_handle++;
+        }
     }
 
     if(used == 0)
     {
-        printf("attr not found  start_handle: 0x%04x, end_handle: 0x%04x,"
-                                                     " Type: 0x%04x\r\n",
-                                                    p_read_req->s_handle,
-                                                    p_read_req->e_handle,
-                                             p_read_req->uuid.uu.uuid16);
+        APP_LOG(APP_LOG_GATT_TYPE_NOT_FOUND, p_read_req->s_handle, p_read_req->e_handle,
+                p_read_req->uuid.uu.uuid16);
 
-        app_free_buffer(p_rsp);
         return WICED_BT_GATT_INVALID_HANDLE;
     }
 
+    if (NULL == (p_rsp = app_alloc_buffer(used)))
+    {
+        APP_LOG(APP_LOG_GATT_NO_MEMORY, used);
+        return WICED_BT_GATT_INSUF_RESOURCE;
+    }
+    memcpy(p_rsp, ctss_rsp_scratch, used);
+
     /* Send the response */
     gatt_status = wiced_bt_gatt_server_send_read_by_type_rsp(conn_id,
                                                               opcode,
@@ -572,14 +1164,188 @@ static wiced_bt_gatt_status_t app_bt_gatt_req_read_by_type_handler(uint16_t conn
     {
         app_free_buffer(p_rsp);
     }
+    else
+    {
+        app_bt_mtu_sent(conn_id, (uint16_t)(APP_BT_MTU_READ_BY_TYPE_HDR_LEN + used));
+    }
 
     return gatt_status;
 }
+/*******************************************************************************
+* Function Name: app_bt_gatt_req_read_multi_handler
+********************************************************************************
+* Summary:
+* This function handles the GATT Read Multiple and Read Multiple Variable
+* Length requests. The values are gathered in the scratch buffer, cut where the
+* MTU ends, and sent as one response
+*
+* Parameters:
+*  uint16_t conn_id: Connection ID
+*  wiced_bt_gatt_opcode_t opcode: GATT opcode
+*  wiced_bt_gatt_read_multiple_req_t *p_read_req: Handles to read
+*  uint16_t len_requested: Length requested
+*  uint16_t *p_error_handle: Receives the handle an error refers to
+*
+* Return:
+*  wiced_bt_gatt_status_t: GATT result
+*
+*******************************************************************************/
+static wiced_bt_gatt_status_t app_bt_gatt_req_read_multi_handler(uint16_t conn_id,
+                                                                 wiced_bt_gatt_opcode_t opcode,
+                                                                 wiced_bt_gatt_read_multiple_req_t *p_read_req,
+                                                                 uint16_t len_requested,
+                                                                 uint16_t *p_error_handle)
+{
+    gatt_db_lookup_table_t *puAttribute;
+    wiced_bt_gatt_status_t gatt_status;
+    uint16_t rsp_len = app_bt_mtu_payload_len(conn_id, len_requested,
+                                              APP_BT_MTU_READ_MULTI_HDR_LEN);
+    uint16_t handle;
+    uint16_t value_len;
+    uint16_t i;
+    uint8_t *p_value;
+    uint8_t *p_rsp;
+    int used = 0;
+
+    /* Every handle must be readable, also those past the end of the MTU */
+    for (i = 0; i < p_read_req->num_handles; i++)
+    {
+        handle = wiced_bt_gatt_get_handle_from_stream(p_read_req->p_handle_stream, i);
+        *p_error_handle = handle;
+        if (NULL == (puAttribute = app_get_attribute(handle)))
+        {
+            APP_LOG(APP_LOG_GATT_MULTI_INVALID, handle);
+            return WICED_BT_GATT_INVALID_HANDLE;
+        }
+
+        if (used < rsp_len)
+        {
+            p_value = app_get_attribute_value(conn_id, puAttribute, &value_len);
+            used += wiced_bt_gatt_put_read_multi_rsp_in_stream(opcode, ctss_rsp_scratch + used,
+                                                               rsp_len - used, handle,
+                                                               value_len, p_value);
+        }
+    }
+
+    if (NULL == (p_rsp = app_alloc_buffer(MAX(used, 1))))
+    {
+        APP_LOG(APP_LOG_GATT_NO_MEMORY, used);
+        return WICED_BT_GATT_INSUF_RESOURCE;
+    }
+    memcpy(p_rsp, ctss_rsp_scratch, used);
+
+    gatt_status = wiced_bt_gatt_server_send_read_multiple_rsp(conn_id, opcode, (uint16_t)used,
+                                                              p_rsp, (void *)app_free_buffer);
+    if (WICED_BT_SUCCESS != gatt_status)
+    {
+        app_free_buffer(p_rsp);
+    }
+    else
+    {
+        app_bt_mtu_sent(conn_id, (uint16_t)(APP_BT_MTU_READ_MULTI_HDR_LEN + used));
+    }
+
+    return gatt_status;
+}
+
+/*******************************************************************************
+* Function Name: ble_app_connection_event
+*********************************************************************************
+* Summary:
+*   Runs in the GATT task when a connection came up or went down, with the
+*   copy of the event the GATT callback made.
+*
+* Parameters:
+*   void *p_data: ctss_conn_event_t of the connection
+*
+* Return:
+*   None
+*
+*********************************************************************************/
+static void ble_app_connection_event(void *p_data)
+{
+    ctss_conn_event_t *p_event = (ctss_conn_event_t *)p_data;
+    wiced_bt_gatt_connection_status_t conn_status;
+
+    memset(&conn_status, 0, sizeof(conn_status));
+    conn_status.bd_addr   = p_event->bd_addr;
+    conn_status.addr_type = (wiced_bt_ble_address_type_t)p_event->addr_type;
+    conn_status.conn_id   = p_event->conn_id;
+    conn_status.connected = p_event->connected ? WICED_TRUE : WICED_FALSE;
+    conn_status.reason    = (wiced_bt_gatt_disconn_reason_t)p_event->reason;
+    conn_status.transport = BT_TRANSPORT_LE;
+    (void)ble_app_connect_handler(&conn_status);
+}
+
+/*******************************************************************************
+* Function Name: ble_app_mtu_event
+*********************************************************************************
+* Summary:
+*   Runs in the GATT task when the MTU exchange of a connection completed.
+*
+* Parameters:
+*   void *p_data: wiced_bt_gatt_operation_complete_t of the exchange
+*
+* Return:
+*   None
+*
+*********************************************************************************/
+static void ble_app_mtu_event(void *p_data)
+{
+    wiced_bt_gatt_operation_complete_t *p_cplt = (wiced_bt_gatt_operation_complete_t *)p_data;
+
+    APP_LOG(APP_LOG_MTU_EXCHANGED, p_cplt->conn_id,
+            app_bt_mtu_exchanged(p_cplt->conn_id, p_cplt->response_data.mtu));
+}
+
+/*******************************************************************************
+* Function Name: ble_app_confirm_event
+*********************************************************************************
+* Summary:
+*   Runs in the GATT task when a client confirmed an indication, and lets the
+*   next one go out on its link.
+*
+* Parameters:
+*   void *p_data: ctss_confirm_event_t of the link
+*
+* Return:
+*   None
+*
+*********************************************************************************/
+static void ble_app_confirm_event(void *p_data)
+{
+    ctss_confirm_event_t *p_confirm = (ctss_confirm_event_t *)p_data;
+    uint32_t start = app_cpu_counter();
+
+    app_bt_notify_confirmed(p_confirm->conn_id, p_confirm->handle);
+    app_latency_gatt(GATT_HANDLE_VALUE_CONF, start);
+}
+
+/*******************************************************************************
+* Function Name: ble_app_congestion_event
+*********************************************************************************
+* Summary:
+*   Runs in the GATT task when a link became congested or took data again.
+*
+* Parameters:
+*   void *p_data: wiced_bt_gatt_congestion_event_t of the link
+*
+* Return:
+*   None
+*
+*********************************************************************************/
+static void ble_app_congestion_event(void *p_data)
+{
+    wiced_bt_gatt_congestion_event_t *p_congestion = (wiced_bt_gatt_congestion_event_t *)p_data;
+
+    app_bt_notify_congestion(p_congestion->conn_id, p_congestion->congested);
+}
+
 /*******************************************************************************
 * Function Name: ble_app_connect_handler
 *********************************************************************************
 * Summary:
-*   This callback function handles connection status changes.
+*   This function handles connection status changes. Runs in the GATT task.
 *
 * Parameters:
 *   wiced_bt_gatt_connection_status_t *p_conn_status  : Pointer to data that has
@@ -594,44 +1360,92 @@ static wiced_bt_gatt_status_t ble_app_connect_handler (wiced_bt_gatt_connection_
 {
     wiced_bt_gatt_status_t status = WICED_BT_GATT_SUCCESS;
     wiced_result_t result;
+    app_bt_conn_t *p_conn;
+    const app_bt_notify_link_t *p_notify;
+    wiced_bool_t was_client;
+    wiced_bt_ble_address_type_t addr_type = BLE_ADDR_PUBLIC;
+    wiced_bt_ble_sec_action_type_t sec_act;
 
     if ( NULL != p_conn_status )
     {
         if ( p_conn_status->connected )
         {
             /* Device has connected */
-            printf("Connected : BD Addr: " );
-            print_bd_address(p_conn_status->bd_addr);
-            printf("Connection ID '%d'\n", p_conn_status->conn_id);
-
-            /* Store the connection ID */
-            bt_connection_id = p_conn_status->conn_id;
+            APP_LOG(APP_LOG_CONN_UP, APP_LOG_BDA(p_conn_status->bd_addr));
+            APP_LOG(APP_LOG_CONN_UP_ID, p_conn_status->conn_id);
+            app_bt_reconnect_connected(p_conn_status->bd_addr);
+
+            /* Store the connection in the connection table */
+            p_conn = app_bt_conn_add(p_conn_status->conn_id, p_conn_status->bd_addr,
+                                     p_conn_status->addr_type);
+            if (NULL == p_conn)
+            {
+                APP_LOG(APP_LOG_CONN_TABLE_FULL, p_conn_status->conn_id);
+                wiced_bt_gatt_disconnect(p_conn_status->conn_id);
+            }
+            else
+            {
+                app_bt_conn_param_connected(p_conn_status->conn_id, p_conn_status->bd_addr);
+                app_bt_mtu_connected(p_conn);
+                app_bt_phy_connected(p_conn_status->conn_id, p_conn_status->bd_addr);
+
+                /* Encrypt with the stored keys of a bonded client, which
+                 * restores its CCCD; pair with any other client */
+                sec_act = app_bt_bond_is_bonded(p_conn_status->bd_addr) ?
+                          BTM_BLE_SEC_ENCRYPT : BTM_BLE_SEC_ENCRYPT_NO_MITM;
+                result = wiced_bt_dev_set_encryption(p_conn_status->bd_addr, BT_TRANSPORT_LE,
+                                                     &sec_act);
+                if ((WICED_BT_PENDING != result) && (WICED_BT_SUCCESS != result))
+                {
+                    APP_LOG(APP_LOG_BOND_ENCRYPT_FAILED, result);
+                }
 
+                if (app_bt_conn_count() < APP_BT_CONN_MAX_CONNECTIONS)
+                {
+                    /* Look for more clients while there is room */
+                    result = wiced_bt_ble_scan(BTM_BLE_SCAN_TYPE_HIGH_DUTY,
+                                               WICED_TRUE,
+                                               ctss_scan_result_cback);
+                    if(WICED_BT_PENDING == result)
+                    {
+                        APP_LOG0(APP_LOG_SCAN_STARTED);
+                    }
+                }
+            }
         }
         else
         {
             /* Device has disconnected */
-            printf("\nDisconnected : BD Addr: " );
-            print_bd_address(p_conn_status->bd_addr);
-            printf("Connection ID '%d', Reason '%s'\n", p_conn_status->conn_id,
-                    get_bt_gatt_disconn_reason_name(p_conn_status->reason));
-
-            /* Set the connection id to zero to indicate disconnected state */
-            bt_connection_id = 0;
-
-            /*restart the scan*/
-            result = wiced_bt_ble_scan(BTM_BLE_SCAN_TYPE_HIGH_DUTY,
-                                       WICED_TRUE,
-                                       ctss_scan_result_cback);
-            if(WICED_BT_PENDING != result)
+            APP_LOG(APP_LOG_CONN_DOWN, APP_LOG_BDA(p_conn_status->bd_addr));
+            APP_LOG(APP_LOG_CONN_DOWN_REASON, p_conn_status->conn_id, p_conn_status->reason);
+
+            /* Release the entry of this connection */
+            p_conn = app_bt_conn_find(p_conn_status->conn_id);
+            was_client = (NULL != p_conn) ? WICED_TRUE : WICED_FALSE;
+            if (was_client)
             {
-                printf("Cannot restart scanning. Error: %d \n", result);
+                addr_type = p_conn->addr_type;
             }
-            else
+            app_bt_conn_remove(p_conn_status->conn_id);
+            app_bt_conn_param_disconnected(p_conn_status->conn_id);
+            app_bt_phy_disconnected(p_conn_status->conn_id);
+            app_bt_prep_write_cancel(p_conn_status->conn_id);
+            p_notify = app_bt_notify_find(p_conn_status->conn_id);
+            if ((NULL != p_notify) && (0 != p_notify->rtt_count))
             {
-                printf("\r\nScanning.....\n");
+                APP_LOG(APP_LOG_INDICATE_RTT, p_conn_status->conn_id, p_notify->rtt_count,
+                        p_notify->rtt_sum_ms / p_notify->rtt_count, p_notify->rtt_max_ms);
             }
+            app_bt_notify_disconnected(p_conn_status->conn_id);
+            ctss_update_notify_schedule();
 
+            /* Connect straight back to the client that left; scan for it
+             * only if that cannot be started */
+            if (!was_client ||
+                (WICED_TRUE != app_bt_reconnect_start(p_conn_status->bd_addr, addr_type)))
+            {
+                ctss_start_scan();
+            }
         }
 
         status = WICED_BT_GATT_ERROR ;
@@ -644,7 +1458,8 @@ static wiced_bt_gatt_status_t ble_app_connect_handler (wiced_bt_gatt_connection_
 * Function Name: ble_app_server_handler
 *********************************************************************************
 * Summary:
-*   This function handles GATT server events from the BT stack.
+*   This function handles GATT server events from the BT stack. The time
+*   spent on each request is recorded per opcode.
 *
 * Parameters:
 *  wiced_bt_gatt_attribute_request_t *p_data: GATT request data structure
@@ -658,9 +1473,26 @@ static wiced_bt_gatt_status_t ble_app_server_handler (wiced_bt_gatt_attribute_re
 {
     wiced_bt_gatt_status_t status = WICED_BT_GATT_SUCCESS;
     wiced_bt_gatt_write_req_t *p_write_request = &p_data->data.write_req;
+    uint32_t start = app_cpu_counter();
+
+    /* Client requests keep the link on the fast connection parameters. The
+     * MTU exchange belongs to setting up the link, and confirmations, which
+     * an indication client sends every period, do not come here. */
+    if (GATT_REQ_MTU != p_data->opcode)
+    {
+        app_bt_conn_param_activity(p_data->conn_id);
+    }
 
     switch ( p_data->opcode )
     {
+        case GATT_REQ_MTU:
+            /* Remember the MTU agreed with this client */
+            APP_LOG(APP_LOG_MTU_EXCHANGED, p_data->conn_id,
+                    app_bt_mtu_exchanged(p_data->conn_id, p_data->data.remote_mtu));
+            status = wiced_bt_gatt_server_send_mtu_rsp(p_data->conn_id,
+                                                       p_data->data.remote_mtu,
+                                                       CY_BT_MTU_SIZE);
+            break;
         case GATT_REQ_READ:
         case GATT_REQ_READ_BLOB:
             /* Attribute read request */
@@ -674,6 +1506,14 @@ static wiced_bt_gatt_status_t ble_app_server_handler (wiced_bt_gatt_attribute_re
                                                           &p_data->data.read_by_type,
                                                           p_data->len_requested, p_error_handle);
             break;
+        case GATT_REQ_READ_MULTI:
+        case GATT_REQ_READ_MULTI_VAR_LENGTH:
+            /* Several values in one response, one round trip */
+            status = app_bt_gatt_req_read_multi_handler(p_data->conn_id,
+                                                        p_data->opcode,
+                                                        &p_data->data.read_multiple_req,
+                                                        p_data->len_requested, p_error_handle);
+            break;
             /* Attribute write request */
         case GATT_REQ_WRITE:
         case GATT_CMD_WRITE:
@@ -685,24 +1525,43 @@ static wiced_bt_gatt_status_t ble_app_server_handler (wiced_bt_gatt_attribute_re
                 wiced_bt_gatt_server_send_write_rsp(p_data->conn_id,
                                                     p_data->opcode,
                                                     p_write_request->handle);
-                if(app_cts_current_time_client_char_config[0])
-                {
-                    ctss_send_notification();
-                }
             }
             break;
 
+        case GATT_REQ_PREPARE_WRITE:
+            /* Long writes are queued until the client executes them */
+            status = ble_app_prep_write_handler(p_data->conn_id,
+                                                p_data->opcode,
+                                                &(p_data->data.write_req), p_error_handle);
+            break;
+        case GATT_REQ_EXECUTE_WRITE:
+            if (GATT_PREPARE_WRITE_EXEC == p_data->data.exec_write)
+            {
+                status = app_bt_prep_write_execute(p_data->conn_id, p_error_handle);
+            }
+            else
+            {
+                app_bt_prep_write_cancel(p_data->conn_id);
+            }
+            if (WICED_BT_GATT_SUCCESS == status)
+            {
+                wiced_bt_gatt_server_send_execute_write_rsp(p_data->conn_id, p_data->opcode);
+            }
+            break;
         default:
             status = WICED_BT_GATT_ERROR;
     }
+    app_latency_gatt(p_data->opcode, start);
     return status;
 }
 
 /*********************************************************************
-* Function Name: static void ctss_send_notification
+* Function Name: static void ctss_notification_due
 **********************************************************************
 * Summary:
-*   Send GATT notification every millisecond.
+*   Called by the scheduler in the timer task on the RTC second
+*   rollover, once per notification period. The notifications are sent
+*   by the GATT task, which owns the connection table.
 *
 * Parameters:
 *   None
@@ -711,42 +1570,289 @@ static wiced_bt_gatt_status_t ble_app_server_handler (wiced_bt_gatt_attribute_re
 *   None
 *
 **********************************************************************/
+static void ctss_notification_due(void)
+{
+    app_bt_gatt_task_defer(ctss_send_notification, NULL, 0);
+}
+
+/*********************************************************************
+* Function Name: static void ctss_send_notification
+**********************************************************************
+* Summary:
+*   Updates the encoded current time once and sends it to every client that
+*   has enabled notifications. Runs in the GATT task.
+*
+* Parameters:
+*   void *p_data: Not used
+*
+* Return:
+*   None
+*
+**********************************************************************/
 
-static void ctss_send_notification(void)
+static void ctss_send_notification(void *p_data)
 {
-    cy_rslt_t  cy_result;
-    struct tm date_time;
-    char buffer[STRING_BUFFER_SIZE];
-    wiced_bt_gatt_status_t status = WICED_BT_GATT_SUCCESS;
+    app_bt_conn_t *p_conn = NULL;
+    uint32_t start = app_cpu_counter();
+
+    (void)p_data;
+
+    /* Nothing to encode if nobody listens */
+    if (0 == app_bt_conn_subscribed_count())
+    {
+        return;
+    }
+
+    /* Bring the encoded value up to the current second */
+    app_cts_time_update();
 
-    cy_result = cyhal_rtc_read(&my_rtc, &date_time);
-    if (CY_RSLT_SUCCESS ==  cy_result)
+    /* Fan the same payload out to every subscribed client */
+    while (NULL != (p_conn = app_bt_conn_next(p_conn)))
     {
-        strftime(buffer, sizeof(buffer), "%c", &date_time);
-        printf("\r%s\r\n\n", buffer);
+        if (p_conn->cccd[0] & (GATT_CLIENT_CONFIG_NOTIFICATION | GATT_CLIENT_CONFIG_INDICATION))
+        {
+            ctss_notify(p_conn);
+        }
     }
 
-    date_time.tm_year += TM_YEAR_BASE;
-    app_cts_current_time[0]= (uint8_t) (date_time.tm_year & 0xFF);
-    app_cts_current_time[1]= (uint8_t) ((date_time.tm_year) >> 8);
-    app_cts_current_time[2] = date_time.tm_mon + 1;
-    app_cts_current_time[3] = date_time.tm_mday;
-    app_cts_current_time[4] = date_time.tm_hour;
-    app_cts_current_time[5] = date_time.tm_min;
-    app_cts_current_time[6] = date_time.tm_sec;
-    app_cts_current_time[7] = get_day_of_week(date_time.tm_mday, date_time.tm_mon,
-                                              date_time.tm_year);
-    app_cts_current_time[8] = 0;
-    app_cts_current_time[9] = 0;
+    /* Every queue holds its copy; the Adjust Reason has gone out */
+    app_cts_time_clear_reason();
+    app_latency_since(APP_LATENCY_NOTIFY, start);
+}
 
-    status = wiced_bt_gatt_server_send_notification(bt_connection_id,
-                                                    HDLC_CTS_CURRENT_TIME_VALUE,
-                                                    app_cts_current_time_len,
-                                                    app_cts_current_time,NULL);
+/*********************************************************************
+* Function Name: static void ctss_notify
+**********************************************************************
+* Summary:
+*   Queues the encoded current time for one client, as an indication if the
+*   client asked for them and as a notification otherwise. The queue copies
+*   the value, sends it when the link has room and keeps only the newest
+*   time while the link is congested or an indication is not confirmed.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Connection of the client
+*
+* Return:
+*   None
+*
+**********************************************************************/
+static void ctss_notify(app_bt_conn_t *p_conn)
+{
+    uint8_t payload[APP_CTS_TIME_PAYLOAD_LEN];
+    wiced_bt_gatt_status_t status;
+
+    /* A whole second, never one being encoded */
+    app_cts_time_get_payload(payload);
+    status = app_bt_notify_send(p_conn->conn_id, HDLC_CTS_CURRENT_TIME_VALUE,
+                                payload, sizeof(payload),
+                                (p_conn->cccd[0] & GATT_CLIENT_CONFIG_INDICATION) ?
+                                WICED_TRUE : WICED_FALSE);
 
     if (WICED_BT_GATT_SUCCESS != status)
     {
-        printf("Send notification failed\n");
+        APP_LOG(APP_LOG_NOTIFY_FAILED, p_conn->conn_id);
+    }
+}
+
+/*********************************************************************
+* Function Name: static void ctss_link_encrypted
+**********************************************************************
+* Summary:
+*   Runs in the GATT task once the link to a client is encrypted.
+*   Restores the CCCD of a bonded client and notifies it right away
+*   instead of waiting for it to subscribe again.
+*
+* Parameters:
+*   void *p_data: ctss_peer_event_t with the address of the client and
+*                 the encryption status from the stack
+*
+* Return:
+*   None
+*
+**********************************************************************/
+static void ctss_link_encrypted(void *p_data)
+{
+    ctss_peer_event_t *p_peer = (ctss_peer_event_t *)p_data;
+    uint8_t cccd[APP_BT_CONN_CCCD_LEN];
+    app_bt_conn_t *p_conn;
+    wiced_bool_t restored;
+
+    if (WICED_BT_SUCCESS != p_peer->result)
+    {
+        APP_LOG(APP_LOG_BOND_ENCRYPT_FAILED, p_peer->result);
+        return;
+    }
+    if (NULL == (p_conn = app_bt_conn_find_by_addr(p_peer->bd_addr)))
+    {
+        return;
+    }
+
+    restored = app_bt_bond_get_cccd(p_peer->bd_addr, cccd);
+    APP_LOG(APP_LOG_BOND_ENCRYPTED, p_conn->conn_id, restored);
+    if (!restored)
+    {
+        return;
+    }
+
+    app_bt_conn_set_cccd(p_conn, cccd);
+    ctss_update_notify_schedule();
+    if (p_conn->cccd[0] & (GATT_CLIENT_CONFIG_NOTIFICATION | GATT_CLIENT_CONFIG_INDICATION))
+    {
+        app_cts_time_update();
+        ctss_notify(p_conn);
+    }
+}
+
+/*********************************************************************
+* Function Name: static void ctss_keys_saved
+**********************************************************************
+* Summary:
+*   Runs in the GATT task once the keys of a client are stored, and
+*   keeps what the client has subscribed to so far with them.
+*
+* Parameters:
+*   void *p_data: ctss_peer_event_t with the address of the client
+*
+* Return:
+*   None
+*
+**********************************************************************/
+static void ctss_keys_saved(void *p_data)
+{
+    ctss_peer_event_t *p_peer = (ctss_peer_event_t *)p_data;
+    app_bt_conn_t *p_conn = app_bt_conn_find_by_addr(p_peer->bd_addr);
+
+    if (NULL != p_conn)
+    {
+        app_bt_bond_set_peer(p_conn);
+    }
+}
+
+/*********************************************************************
+* Function Name: static void ctss_conn_param_updated
+**********************************************************************
+* Summary:
+*   Runs in the GATT task when the stack updated the connection
+*   parameters of a link.
+*
+* Parameters:
+*   void *p_data: wiced_bt_ble_connection_param_update_t of the link
+*
+* Return:
+*   None
+*
+**********************************************************************/
+static void ctss_conn_param_updated(void *p_data)
+{
+    app_bt_conn_param_updated((wiced_bt_ble_connection_param_update_t *)p_data);
+}
+
+/*********************************************************************
+* Function Name: static void ctss_data_length_updated
+**********************************************************************
+* Summary:
+*   Runs in the GATT task when the stack updated the data length of a
+*   link.
+*
+* Parameters:
+*   void *p_data: wiced_bt_ble_data_length_update_t of the link
+*
+* Return:
+*   None
+*
+**********************************************************************/
+static void ctss_data_length_updated(void *p_data)
+{
+    app_bt_mtu_data_length((wiced_bt_ble_data_length_update_t *)p_data);
+}
+
+/*********************************************************************
+* Function Name: static void ctss_phy_updated
+**********************************************************************
+* Summary:
+*   Runs in the GATT task when the stack updated the PHY of a link.
+*
+* Parameters:
+*   void *p_data: wiced_bt_ble_phy_update_t of the link
+*
+* Return:
+*   None
+*
+**********************************************************************/
+static void ctss_phy_updated(void *p_data)
+{
+    app_bt_phy_updated((wiced_bt_ble_phy_update_t *)p_data);
+}
+
+/*********************************************************************
+* Function Name: static void ctss_update_notify_schedule
+**********************************************************************
+* Summary:
+*   Runs the notification scheduler while at least one client has
+*   notifications enabled and stops it otherwise. While it runs, the time
+*   engine holds an Adjust Reason until a notification has carried it.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+**********************************************************************/
+static void ctss_update_notify_schedule(void)
+{
+    uint8_t payload[APP_CTS_TIME_PAYLOAD_LEN];
+
+    /* An adjustment waits for its notification only while one will be sent */
+    app_cts_time_hold_reason((0 != app_bt_conn_subscribed_count()) ? WICED_TRUE : WICED_FALSE);
+
+    if (0 == app_bt_conn_subscribed_count())
+    {
+        app_cts_sched_stop();
+    }
+    else if (WICED_BT_SUCCESS != app_cts_sched_start())
+    {
+        APP_LOG0(APP_LOG_NOTIFY_TIMER_FAILED);
+    }
+    else
+    {
+        app_cts_time_get_payload(payload);
+        APP_LOG(APP_LOG_NOTIFY_STARTED,
+                payload[APP_CTS_TIME_YEAR_LSB] | (payload[APP_CTS_TIME_YEAR_MSB] << 8),
+                payload[APP_CTS_TIME_MONTH], payload[APP_CTS_TIME_DAY],
+                payload[APP_CTS_TIME_HOURS], payload[APP_CTS_TIME_MINUTES],
+                payload[APP_CTS_TIME_SECONDS]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ctss_start_scan
+********************************************************************************
+* Summary:
+*   Restarts the high duty scan after a client left, to find it (or another
+*   client) by its advertising data.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void ctss_start_scan(void)
+{
+    wiced_result_t result;
+
+    result = wiced_bt_ble_scan(BTM_BLE_SCAN_TYPE_HIGH_DUTY,
+                               WICED_TRUE,
+                               ctss_scan_result_cback);
+    if(WICED_BT_PENDING != result)
+    {
+        APP_LOG(APP_LOG_SCAN_START_FAILED, result);
+    }
+    else
+    {
+        APP_LOG0(APP_LOG_SCAN_STARTED);
     }
 }
 
@@ -770,6 +1876,7 @@ void button_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
 {
     BaseType_t xHigherPriorityTaskWoken;
     xHigherPriorityTaskWoken = pdFALSE;
+    button_pressed_cycles = app_cpu_counter();
     vTaskNotifyGiveFromISR(button_task_handle, &xHigherPriorityTaskWoken);
     portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
 }
@@ -794,11 +1901,16 @@ void button_task(void *pvParameters)
     for(;;)
     {
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        app_latency_since(APP_LATENCY_BUTTON, button_pressed_cycles);
         result = wiced_bt_ble_scan(BTM_BLE_SCAN_TYPE_HIGH_DUTY, WICED_TRUE,
                                    ctss_scan_result_cback);
         if ((WICED_BT_PENDING == result) || (WICED_BT_BUSY == result))
         {
             printf("\r\nScanning.....\n");
+#if APP_LATENCY_DUMP_ON_BUTTON
+            /* A press also dumps the latency histograms */
+            app_latency_print();
+#endif
         }
         else
         {
@@ -808,87 +1920,71 @@ void button_task(void *pvParameters)
     }
 }
 /*******************************************************************************
-* Function Name: get_day_of_week
+* Function Name: app_get_attribute
 ********************************************************************************
 * Summary:
-*  Returns a day of the week for a year, month, and day of month that are passed
-*  through parameters. Zeller's congruence is used to calculate the day of
-*  the week. See https://en.wikipedia.org/wiki/Zeller%27s_congruence for more
-*  details.
+* This function looks up the attribute corresponding to the given handle in
+* the GATT DB through the handle index generated at build time, so the cost
+* does not depend on the number of attributes
 *
-*  Note: In this algorithm January and February are counted as months 13 and 14
-*  of the previous year.
-*
-* Parameter:
-*  int day          : The day of the month, Valid range 1..31.
-*  int month        : The month of the year
-*  int year         : The year value. Valid range non-zero value.
+* Parameters:
+*  uint16_t handle: Handle to search for in the GATT DB
 *
 * Return:
-*  Returns a day of the week (1 = Monday, 2 = Tuesday, ., 7 = Sunnday)
+*  gatt_db_lookup_table_t *: Pointer to the correct attribute in the GATT DB
 *
 *******************************************************************************/
-static int get_day_of_week(int day, int month, int year)
+gatt_db_lookup_table_t *app_get_attribute(uint16_t handle)
 {
-    int ret;
-
-    /*Adding 1 to start the index of month from 1. (1-Jan, 2-Feb, ..., 12-Dec)*/
-    month+=1;
-
-    if (month == 1)
-    {
-        month = 13;
-        year--;
-    }
-    if (month == 2)
-    {
-        month = 14;
-        year--;
-    }
-
-    int i = 13*(month+1)/5;
-    int k = year % 100;
-    int j = year / 100;
-
-    ret = (((day + i + k + k/4 + j/4 + 5*j) + 5) % DAYS_PER_WEEK) + 1;
-
-    return ret;
+    return app_gatt_db_index_find(app_gatt_db_handle_index,
+                                  app_gatt_db_handle_index_size,
+                                  app_gatt_db_ext_attr_tbl, handle);
 }
+
 /*******************************************************************************
-* Function Name: app_get_attribute
+* Function Name: app_get_attribute_value
 ********************************************************************************
 * Summary:
-* This function searches through the GATT DB to point to the attribute
-* corresponding to the given handle
+* This function returns the value of an attribute as seen by one client. The
+* Current Time CCCD comes from the connection table, everything else from the
+* GATT DB
 *
 * Parameters:
-*  uint16_t handle: Handle to search for in the GATT DB
+*  uint16_t conn_id: Connection ID
+*  gatt_db_lookup_table_t *puAttribute: Attribute in the GATT DB
+*  uint16_t *p_len: Receives the length of the value
 *
 * Return:
-*  gatt_db_lookup_table_t *: Pointer to the correct attribute in the GATT DB
+*  uint8_t *: Pointer to the value
 *
 *******************************************************************************/
-gatt_db_lookup_table_t *app_get_attribute(uint16_t handle)
+static uint8_t *app_get_attribute_value(uint16_t conn_id, gatt_db_lookup_table_t *puAttribute,
+                                        uint16_t *p_len)
 {
-    /* Search for the given handle in the GATT DB and return the pointer to the
-    correct attribute */
-    uint8_t array_index = 0;
+    app_bt_conn_t *p_conn;
 
-    for (array_index = 0; array_index < app_gatt_db_ext_attr_tbl_size; array_index++)
+    /* Serve the current second, not the one of the last notification */
+    if (HDLC_CTS_CURRENT_TIME_VALUE == puAttribute->handle)
     {
-        if (app_gatt_db_ext_attr_tbl[array_index].handle == handle)
-        {
-            return (&app_gatt_db_ext_attr_tbl[array_index]);
-        }
+        app_cts_time_update();
     }
-    return NULL;
+
+    if ((HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG == puAttribute->handle) &&
+        (NULL != (p_conn = app_bt_conn_find(conn_id))))
+    {
+        *p_len = APP_BT_CONN_CCCD_LEN;
+        return p_conn->cccd;
+    }
+
+    *p_len = puAttribute->cur_len;
+    return puAttribute->p_data;
 }
 
 /*******************************************************************************
  * Function Name: app_free_buffer
  *******************************************************************************
  * Summary:
- *  This function frees up the memory buffer
+ *  This function returns a response buffer to the fixed-block pool
  *
  *
  * Parameters:
@@ -897,15 +1993,15 @@ gatt_db_lookup_table_t *app_get_attribute(uint16_t handle)
  ******************************************************************************/
 static void app_free_buffer(uint8_t *p_buf)
 {
-    vPortFree(p_buf);
+    app_bt_pool_free(p_buf);
 }
 
 /*******************************************************************************
  * Function Name: app_alloc_buffer
  *******************************************************************************
  * Summary:
- *  This function allocates a memory buffer.
- *
+ *  This function allocates a response buffer from the fixed-block pool. The
+ *  pool is sized by the MTU, so this does not touch the FreeRTOS heap.
  *
  * Parameters:
  *  int len: Length to allocate
@@ -913,6 +2009,6 @@ static void app_free_buffer(uint8_t *p_buf)
  ******************************************************************************/
 static void* app_alloc_buffer(int len)
 {
-    return pvPortMalloc(len);
+    return app_bt_pool_alloc((uint32_t)len);
 }
 /* [] END OF FILE */
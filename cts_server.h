@@ -50,12 +50,6 @@
 /*******************************************************************************
 *        Macro Definitions
 *******************************************************************************/
-#define STRING_BUFFER_SIZE              (80u)
-#define DAYS_PER_WEEK                   (7u)
-
-/* Structure tm stores years since 1900 */
-#define TM_YEAR_BASE                    (1900u)
-
 /* Macros for button interrupt and button task */
 /* Interrupt priority for the GPIO connected to the user button */
 #define BUTTON_INTERRUPT_PRIORITY       (7u)
@@ -0,0 +1,184 @@
+/******************************************************************************
+* File Name: bench_lookup.c
+*
+* Description: Attribute lookup benchmark for the host build. Shows the cost
+*              of the handle-indexed lookup staying flat as the attribute
+*              table grows, against the former linear scan.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Usage: bench_lookup [-n lookups]
+ *   -n  Lookups per table size and method (default 2000000)
+ *
+ * Compares the linear scan app_get_attribute() used to do against the
+ * generated handle index, over synthetic attribute tables of growing size.
+ */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "host_stub.h"
+#include "app_gatt_db_index.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define BENCH_DEFAULT_LOOKUPS           (2000000u)
+#define BENCH_QUERY_COUNT               (4096u)
+
+/* Each characteristic uses a declaration, a value and a CCCD handle */
+#define BENCH_HANDLES_PER_ENTRY         (3u)
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+static const uint16_t bench_sizes[] = { 4, 16, 64, 256, 1024, 4096, 16384 };
+
+static volatile uintptr_t bench_sink;
+
+/*******************************************************************************
+*        Function Definitions
+*******************************************************************************/
+/* The lookup as it was before the handle index, with a 16-bit counter */
+static gatt_db_lookup_table_t *bench_linear_find(gatt_db_lookup_table_t *p_table,
+                                                 uint16_t table_size, uint16_t handle)
+{
+    uint16_t array_index;
+
+    for (array_index = 0; array_index < table_size; array_index++)
+    {
+        if (p_table[array_index].handle == handle)
+        {
+            return &p_table[array_index];
+        }
+    }
+    return NULL;
+}
+
+static double bench_linear(gatt_db_lookup_table_t *p_table, uint16_t table_size,
+                           const uint16_t *p_queries, uint32_t lookups)
+{
+    uint64_t start = host_time_ns();
+    uint32_t i;
+
+    for (i = 0; i < lookups; i++)
+    {
+        bench_sink += (uintptr_t)bench_linear_find(p_table, table_size,
+                                                   p_queries[i % BENCH_QUERY_COUNT]);
+    }
+    return (double)(host_time_ns() - start) / lookups;
+}
+
+static double bench_indexed(gatt_db_lookup_table_t *p_table, const uint16_t *p_index,
+                            uint16_t index_size, const uint16_t *p_queries, uint32_t lookups)
+{
+    uint64_t start = host_time_ns();
+    uint32_t i;
+
+    for (i = 0; i < lookups; i++)
+    {
+        bench_sink += (uintptr_t)app_gatt_db_index_find(p_index, index_size, p_table,
+                                                        p_queries[i % BENCH_QUERY_COUNT]);
+    }
+    return (double)(host_time_ns() - start) / lookups;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t lookups = BENCH_DEFAULT_LOOKUPS;
+    uint16_t queries[BENCH_QUERY_COUNT];
+    uint32_t s;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "n:")))
+    {
+        if ('n' == opt)
+        {
+            lookups = (uint32_t)strtoul(optarg, NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n lookups]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (lookups < BENCH_QUERY_COUNT)
+    {
+        lookups = BENCH_QUERY_COUNT;
+    }
+
+    printf("%8s %8s %16s %16s\n", "entries", "handles", "linear(ns/op)", "indexed(ns/op)");
+    for (s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); s++)
+    {
+        uint16_t size = bench_sizes[s];
+        uint16_t index_size = (uint16_t)(size * BENCH_HANDLES_PER_ENTRY + 1u);
+        gatt_db_lookup_table_t *p_table = calloc(size, sizeof(gatt_db_lookup_table_t));
+        uint16_t *p_index = calloc(index_size, sizeof(uint16_t));
+        uint32_t i;
+
+        if ((NULL == p_table) || (NULL == p_index))
+        {
+            fprintf(stderr, "out of memory\n");
+            return EXIT_FAILURE;
+        }
+
+        /* Same layout the generator emits: index[handle] = entry + 1 */
+        for (i = 0; i < size; i++)
+        {
+            p_table[i].handle = (uint16_t)((i + 1u) * BENCH_HANDLES_PER_ENTRY);
+            p_index[p_table[i].handle] = (uint16_t)(i + 1u);
+        }
+
+        /* Uniformly spread hits, plus one miss in eight */
+        srand(size);
+        for (i = 0; i < BENCH_QUERY_COUNT; i++)
+        {
+            queries[i] = (0u == (i % 8u)) ? (uint16_t)(index_size + 7u) :
+                         p_table[(uint32_t)rand() % size].handle;
+        }
+
+        printf("%8u %8u %16.2f %16.2f\n", size, index_size - 1u,
+               bench_linear(p_table, size, queries, lookups / (1u + size / 64u)),
+               bench_indexed(p_table, p_index, index_size, queries, lookups));
+
+        free(p_table);
+        free(p_index);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,233 @@
+/******************************************************************************
+* File Name: bench_scan.c
+*
+* Description: Scan callback benchmark for the host build. Measures the cost
+*              of advertising reports from crowds of other devices with the
+*              scan-result cache.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Usage: bench_scan [-n rounds]
+ *   -n  Advertising rounds per crowd size (default 1000)
+ *
+ * Feeds advertising reports from crowds of other devices through the scan
+ * callback, each device advertising once per 100 ms round, and reports the
+ * cost per report for the first sighting (parsed) and for the repeats
+ * (answered from the scan cache), together with the cache counters.
+ */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "host_stub.h"
+#include "cts_server.h"
+#include "app_log.h"
+#include "app_scan_cache.h"
+#include "app_bt_gatt_task.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define BENCH_DEFAULT_ROUNDS            (1000u)
+#define BENCH_ROUND_MS                  (100u)
+#define BENCH_MAX_DEVICES               (1024u)
+#define BENCH_ADV_LEN                   (16u)
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+static const uint16_t bench_crowds[] = { 16, 64, 128, 256, 1024 };
+
+static wiced_bt_ble_scan_results_t bench_reports[BENCH_MAX_DEVICES];
+static uint8_t                     bench_adv[BENCH_MAX_DEVICES][BENCH_ADV_LEN];
+
+/* Defined by main.c on the target */
+TaskHandle_t button_task_handle;
+
+/*******************************************************************************
+*        Function Definitions
+*******************************************************************************/
+/* Device i: random static address, Flags and Complete Local Name "Dev-<i>" */
+static void bench_make_crowd(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_MAX_DEVICES; i++)
+    {
+        wiced_bt_ble_scan_results_t *p_report = &bench_reports[i];
+        uint8_t *p_adv = bench_adv[i];
+        int name_len;
+
+        memset(p_report, 0, sizeof(*p_report));
+        p_report->remote_bd_addr[0] = 0xC0;
+        p_report->remote_bd_addr[1] = (uint8_t)(i * 37u);
+        p_report->remote_bd_addr[2] = 0x5A;
+        p_report->remote_bd_addr[3] = (uint8_t)(i >> 8);
+        p_report->remote_bd_addr[4] = 0x3C;
+        p_report->remote_bd_addr[5] = (uint8_t)i;
+        p_report->ble_addr_type = BLE_ADDR_RANDOM;
+        p_report->rssi = -70;
+
+        p_adv[0] = 0x02;
+        p_adv[1] = BTM_BLE_ADVERT_TYPE_FLAG;
+        p_adv[2] = 0x06;
+        name_len = snprintf((char *)&p_adv[5], BENCH_ADV_LEN - 6u, "Dev-%u", i);
+        p_adv[3] = (uint8_t)(name_len + 1);
+        p_adv[4] = BTM_BLE_ADVERT_TYPE_NAME_COMPLETE;
+        p_adv[5 + name_len] = 0x00;
+    }
+}
+
+/* Connects one client so that the server scans for more. The GATT task
+ * takes the connection up. */
+static void bench_start_scan(void)
+{
+    static const wiced_bt_device_address_t peer = { 0x00, 0xA0, 0x50, 0x11, 0x22, 0x33 };
+    wiced_bt_management_evt_data_t mgmt;
+    wiced_bt_gatt_event_data_t evt;
+    TaskHandle_t prev;
+
+    memset(&mgmt, 0, sizeof(mgmt));
+    mgmt.enabled.status = WICED_BT_SUCCESS;
+    app_log_init();
+    app_bt_management_callback(BTM_ENABLED_EVT, &mgmt);
+
+    memset(&evt, 0, sizeof(evt));
+    evt.connection_status.bd_addr   = (uint8_t *)peer;
+    evt.connection_status.addr_type = BLE_ADDR_PUBLIC;
+    evt.connection_status.conn_id   = 0x8001u;
+    evt.connection_status.connected = WICED_TRUE;
+    evt.connection_status.transport = BT_TRANSPORT_LE;
+    host_bt_gatt_event(GATT_CONNECTION_STATUS_EVT, &evt);
+
+    prev = host_task_switch(host_task_find("gatt_task"));
+    app_bt_gatt_task_process(0);
+    host_task_switch(prev);
+}
+
+static double bench_round(uint32_t devices)
+{
+    uint64_t start = host_time_ns();
+    uint32_t i;
+
+    for (i = 0; i < devices; i++)
+    {
+        host_bt_scan_report(&bench_reports[i], bench_adv[i]);
+    }
+    return (double)(host_time_ns() - start);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t rounds = BENCH_DEFAULT_ROUNDS;
+    app_scan_cache_stats_t stats;
+    int saved_stdout;
+    int dev_null;
+    uint32_t c;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "n:")))
+    {
+        if ('n' == opt)
+        {
+            rounds = (uint32_t)strtoul(optarg, NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n rounds]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (0 == rounds)
+    {
+        rounds = 1;
+    }
+
+    /* The application logs to stdout; park it on /dev/null during the runs */
+    fflush(stdout);
+    saved_stdout = dup(STDOUT_FILENO);
+    dev_null = open("/dev/null", O_WRONLY);
+    dup2(dev_null, STDOUT_FILENO);
+    bench_make_crowd();
+    bench_start_scan();
+    app_log_drain();
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+
+    printf("Scan cache: %u entries, %u ms TTL\n", APP_SCAN_CACHE_SIZE, APP_SCAN_CACHE_TTL_MS);
+    printf("%8s %15s %15s %9s %9s %9s %9s\n", "devices", "first(ns/rpt)", "repeat(ns/rpt)",
+           "hits", "misses", "evicted", "expired");
+    for (c = 0; c < sizeof(bench_crowds) / sizeof(bench_crowds[0]); c++)
+    {
+        uint32_t devices = bench_crowds[c];
+        double first;
+        double repeat = 0;
+        uint32_t r;
+
+        if (!host_bt_is_scanning())
+        {
+            fprintf(stderr, "scanning stopped\n");
+            return EXIT_FAILURE;
+        }
+
+        fflush(stdout);
+        dup2(dev_null, STDOUT_FILENO);
+        app_scan_cache_init();
+        first = bench_round(devices);
+        for (r = 1; r < rounds; r++)
+        {
+            host_tick_advance(pdMS_TO_TICKS(BENCH_ROUND_MS));
+            app_log_drain();
+            repeat += bench_round(devices);
+        }
+        app_log_drain();
+        fflush(stdout);
+        dup2(saved_stdout, STDOUT_FILENO);
+
+        app_scan_cache_get_stats(&stats);
+        printf("%8u %15.1f %15.1f %9u %9u %9u %9u\n", devices, first / devices,
+               (rounds > 1) ? (repeat / ((double)devices * (rounds - 1u))) : 0.0,
+               stats.hits, stats.misses, stats.evictions, stats.expired);
+    }
+    close(dev_null);
+    close(saved_stdout);
+    return EXIT_SUCCESS;
+}
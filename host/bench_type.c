@@ -0,0 +1,337 @@
+/******************************************************************************
+* File Name: bench_type.c
+*
+* Description: Read By Type benchmark for the host build. Compares the per-
+*              match database walk against the generated type index over
+*              databases of 10 to 500 attributes.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Usage: bench_type [-n requests]
+ *   -n  Read By Type requests per database size and method (default 200000)
+ *
+ * Compares the way app_bt_gatt_req_read_by_type_handler() used to find the
+ * attributes of a type, one database walk per match, against the type index,
+ * over synthetic databases of 10 to 500 attributes. Each size is measured
+ * for a type with one attribute and for the CCCDs, which fill a response.
+ */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "host_stub.h"
+#include "app_gatt_db_index.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define BENCH_DEFAULT_REQUESTS          (200000u)
+#define BENCH_QUERY_COUNT               (1024u)
+
+/* Handle-value pairs of 2-byte values that fit a response with a 247-byte MTU */
+#define BENCH_PAIRS_PER_RSP             ((247u - 2u) / 4u)
+
+/* Every characteristic has a declaration and a value; every other one also a
+ * CCCD. A service declaration opens each group of this many characteristics. */
+#define BENCH_CHARS_PER_SERVICE         (8u)
+
+#define BENCH_UUID_VALUE_BASE           (0x2A00u)
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+/* One attribute of the database as the stack walks it */
+typedef struct
+{
+    uint16_t handle;
+    uint16_t uuid;
+} bench_attr_t;
+
+/* Synthetic database with both lookup structures */
+typedef struct
+{
+    bench_attr_t              *p_attrs;
+    uint16_t                  attr_count;
+    gatt_db_lookup_table_t    *p_table;
+    uint16_t                  table_size;
+    uint16_t                  *p_index;
+    uint16_t                  index_size;
+    app_gatt_db_type_t        *p_types;
+    uint16_t                  types_size;
+    app_gatt_db_type_handle_t *p_handles;
+    uint16_t                  value_types;
+} bench_db_t;
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+static const uint16_t bench_sizes[] = { 10, 25, 50, 100, 250, 500 };
+
+static volatile uintptr_t bench_sink;
+
+/*******************************************************************************
+*        Function Definitions
+*******************************************************************************/
+static void bench_add(bench_db_t *p_db, uint16_t uuid, wiced_bool_t has_entry)
+{
+    uint16_t handle = (uint16_t)(p_db->attr_count + 1u);
+
+    p_db->p_attrs[p_db->attr_count].handle = handle;
+    p_db->p_attrs[p_db->attr_count].uuid = uuid;
+    p_db->attr_count++;
+    if (has_entry)
+    {
+        p_db->p_table[p_db->table_size].handle = handle;
+        p_db->table_size++;
+    }
+}
+
+static int bench_cmp_type_handle(const void *a, const void *b)
+{
+    const bench_attr_t *p_a = (const bench_attr_t *)a;
+    const bench_attr_t *p_b = (const bench_attr_t *)b;
+
+    if (p_a->uuid != p_b->uuid)
+    {
+        return (p_a->uuid < p_b->uuid) ? -1 : 1;
+    }
+    return (int)p_a->handle - (int)p_b->handle;
+}
+
+/* Lays out services, characteristics and CCCDs up to size attributes and
+ * builds the indexes the generator would emit for them */
+static wiced_bool_t bench_build(bench_db_t *p_db, uint16_t size)
+{
+    bench_attr_t *p_sorted;
+    uint16_t chars = 0;
+    uint16_t i;
+
+    memset(p_db, 0, sizeof(*p_db));
+    p_db->p_attrs = calloc(size, sizeof(bench_attr_t));
+    p_db->p_table = calloc(size, sizeof(gatt_db_lookup_table_t));
+    p_db->p_index = calloc(size + 1u, sizeof(uint16_t));
+    p_db->p_types = calloc(size, sizeof(app_gatt_db_type_t));
+    p_db->p_handles = calloc(size, sizeof(app_gatt_db_type_handle_t));
+    p_sorted = calloc(size, sizeof(bench_attr_t));
+    if ((NULL == p_db->p_attrs) || (NULL == p_db->p_table) || (NULL == p_db->p_index) ||
+        (NULL == p_db->p_types) || (NULL == p_db->p_handles) || (NULL == p_sorted))
+    {
+        free(p_sorted);
+        return WICED_FALSE;
+    }
+
+    while (p_db->attr_count < size)
+    {
+        if ((0u == (chars % BENCH_CHARS_PER_SERVICE)) && (p_db->attr_count + 3u <= size))
+        {
+            bench_add(p_db, GATT_UUID_PRI_SERVICE, WICED_FALSE);
+        }
+        bench_add(p_db, GATT_UUID_CHAR_DECLARE, WICED_FALSE);
+        if (p_db->attr_count < size)
+        {
+            bench_add(p_db, (uint16_t)(BENCH_UUID_VALUE_BASE + chars), WICED_TRUE);
+            p_db->value_types++;
+        }
+        if ((0u != (chars % 2u)) && (p_db->attr_count < size))
+        {
+            bench_add(p_db, GATT_UUID_CHAR_CLIENT_CONFIG, WICED_TRUE);
+        }
+        chars++;
+    }
+
+    /* Handle index: index[handle] = entry + 1 */
+    p_db->index_size = (uint16_t)(p_db->attr_count + 1u);
+    for (i = 0; i < p_db->table_size; i++)
+    {
+        p_db->p_index[p_db->p_table[i].handle] = (uint16_t)(i + 1u);
+    }
+
+    /* Type index: the table's attributes sorted by type, then handle */
+    for (i = 0; i < p_db->table_size; i++)
+    {
+        p_sorted[i].handle = p_db->p_table[i].handle;
+        p_sorted[i].uuid = p_db->p_attrs[p_db->p_table[i].handle - 1u].uuid;
+    }
+    qsort(p_sorted, p_db->table_size, sizeof(bench_attr_t), bench_cmp_type_handle);
+    for (i = 0; i < p_db->table_size; i++)
+    {
+        if ((0u == i) || (p_sorted[i].uuid != p_sorted[i - 1u].uuid))
+        {
+            p_db->p_types[p_db->types_size].uuid = p_sorted[i].uuid;
+            p_db->p_types[p_db->types_size].first = i;
+            p_db->types_size++;
+        }
+        p_db->p_types[p_db->types_size - 1u].count++;
+        p_db->p_handles[i].handle = p_sorted[i].handle;
+        p_db->p_handles[i].entry = (uint16_t)(p_db->p_index[p_sorted[i].handle] - 1u);
+    }
+    free(p_sorted);
+    return WICED_TRUE;
+}
+
+static void bench_free(bench_db_t *p_db)
+{
+    free(p_db->p_attrs);
+    free(p_db->p_table);
+    free(p_db->p_index);
+    free(p_db->p_types);
+    free(p_db->p_handles);
+}
+
+/* The stack's search: a walk of the database from its first attribute */
+static uint16_t bench_find_handle_by_type(const bench_db_t *p_db, uint16_t s_handle,
+                                          uint16_t e_handle, uint16_t uuid)
+{
+    uint16_t i;
+
+    for (i = 0; i < p_db->attr_count; i++)
+    {
+        if ((p_db->p_attrs[i].handle >= s_handle) && (p_db->p_attrs[i].handle <= e_handle) &&
+            (p_db->p_attrs[i].uuid == uuid))
+        {
+            return p_db->p_attrs[i].handle;
+        }
+    }
+    return 0;
+}
+
+/* The handler as it was: one search per match, restarting one past it */
+static double bench_walk(const bench_db_t *p_db, const uint16_t *p_queries, uint32_t requests)
+{
+    uint64_t start = host_time_ns();
+    uint32_t i;
+
+    for (i = 0; i < requests; i++)
+    {
+        uint16_t handle = 0x0001;
+        uint32_t pairs = 0;
+
+        while ((pairs < BENCH_PAIRS_PER_RSP) &&
+               (0u != (handle = bench_find_handle_by_type(p_db, handle, 0xFFFF,
+                                                          p_queries[i % BENCH_QUERY_COUNT]))))
+        {
+            bench_sink += (uintptr_t)app_gatt_db_index_find(p_db->p_index, p_db->index_size,
+                                                            p_db->p_table, handle);
+            pairs++;
+            handle++;
+        }
+    }
+    return (double)(host_time_ns() - start) / requests;
+}
+
+/* The handler with the type index */
+static double bench_indexed(const bench_db_t *p_db, const uint16_t *p_queries,
+                            uint32_t requests)
+{
+    uint64_t start = host_time_ns();
+    uint32_t i;
+
+    for (i = 0; i < requests; i++)
+    {
+        const app_gatt_db_type_handle_t *p_match;
+        uint16_t count;
+        uint16_t j;
+
+        p_match = app_gatt_db_type_find(p_db->p_types, p_db->types_size, p_db->p_handles,
+                                        p_queries[i % BENCH_QUERY_COUNT], 0x0001, 0xFFFF,
+                                        &count);
+        for (j = 0; (j < count) && (j < BENCH_PAIRS_PER_RSP); j++)
+        {
+            bench_sink += (uintptr_t)&p_db->p_table[p_match[j].entry];
+        }
+    }
+    return (double)(host_time_ns() - start) / requests;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t requests = BENCH_DEFAULT_REQUESTS;
+    uint16_t one[BENCH_QUERY_COUNT];
+    uint16_t cccd[BENCH_QUERY_COUNT];
+    uint32_t s;
+    uint32_t i;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "n:")))
+    {
+        if ('n' == opt)
+        {
+            requests = (uint32_t)strtoul(optarg, NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n requests]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (requests < BENCH_QUERY_COUNT)
+    {
+        requests = BENCH_QUERY_COUNT;
+    }
+
+    printf("Read By Type, up to %u pairs per response\n", BENCH_PAIRS_PER_RSP);
+    printf("%8s %8s %16s %16s %16s %16s\n", "attrs", "cccds", "one:walk(ns)",
+           "one:index(ns)", "cccd:walk(ns)", "cccd:index(ns)");
+    for (s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); s++)
+    {
+        bench_db_t db;
+        uint16_t cccds;
+
+        if (!bench_build(&db, bench_sizes[s]))
+        {
+            fprintf(stderr, "out of memory\n");
+            return EXIT_FAILURE;
+        }
+        cccds = (uint16_t)(db.table_size - db.value_types);
+
+        /* Value types spread uniformly over the database */
+        srand(bench_sizes[s]);
+        for (i = 0; i < BENCH_QUERY_COUNT; i++)
+        {
+            one[i] = (uint16_t)(BENCH_UUID_VALUE_BASE + (uint32_t)rand() % db.value_types);
+            cccd[i] = GATT_UUID_CHAR_CLIENT_CONFIG;
+        }
+
+        printf("%8u %8u %16.1f %16.1f %16.1f %16.1f\n", db.attr_count, cccds,
+               bench_walk(&db, one, requests), bench_indexed(&db, one, requests),
+               bench_walk(&db, cccd, requests / 8u), bench_indexed(&db, cccd, requests));
+        bench_free(&db);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,727 @@
+/******************************************************************************
+* File Name: gatt_cases.c
+*
+* Description: Request-level cases for the host build. Sends attribute
+*              requests from one client and checks the responses and the
+*              values they leave in the GATT database.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Usage: gatt_cases [-v]
+ *   -v  Keep the application's console output instead of discarding it
+ *
+ * Connects one client and runs each case against a fresh connection. Every
+ * case prints one line, "ok" or "FAILED" with what differed; the exit status
+ * is non-zero if any case failed.
+ */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "host_stub.h"
+#include "cycfg_gatt_db.h"
+#include "cts_server.h"
+#include "app_bt_bond.h"
+#include "app_bt_gatt_task.h"
+#include "app_cts_time.h"
+#include "app_cts_sched.h"
+#include "app_bt_conn_param.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define CASES_CONN_ID                   (0x8001u)
+
+/* Checks a condition of the running case; a failed one ends the case */
+#define CASES_EXPECT(cond)                                                      \
+    do                                                                          \
+    {                                                                           \
+        if (!(cond))                                                            \
+        {                                                                       \
+            cases_fail(__LINE__, #cond);                                        \
+            return;                                                             \
+        }                                                                       \
+    } while (0)
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+static const wiced_bt_device_address_t cases_peer_addr = { 0x00, 0xA0, 0x50, 0x11, 0x22, 0x44 };
+
+/* Value of the Device Name characteristic in the database */
+static const uint8_t cases_device_name[] = { 'C', 'T', 'S', ' ', 'S', 'e', 'r', 'v', 'e', 'r' };
+
+/* Where the results go while the application's output is discarded */
+static FILE        *cases_out;
+static const char  *cases_name;
+static wiced_bool_t cases_failed;
+static uint32_t     cases_run;
+static uint32_t     cases_failures;
+
+/* Defined by main.c on the target */
+TaskHandle_t button_task_handle;
+
+/*******************************************************************************
+*        Function Definitions
+*******************************************************************************/
+static void cases_fail(int line, const char *p_cond)
+{
+    cases_failed = WICED_TRUE;
+    fprintf(cases_out, "%-40s FAILED line %d: %s\n", cases_name, line, p_cond);
+}
+
+/* Lets the GATT task take up what was queued for it */
+static void cases_gatt_task(void)
+{
+    TaskHandle_t prev = host_task_switch(host_task_find("gatt_task"));
+
+    app_bt_gatt_task_process(0);
+    host_task_switch(prev);
+}
+
+/* The stack delivers management events in its own task; those it hands over
+ * are taken up by the GATT task right after */
+static wiced_result_t cases_management(wiced_bt_management_evt_t event,
+                                       wiced_bt_management_evt_data_t *p_event_data)
+{
+    TaskHandle_t prev = host_task_switch(host_bt_task());
+    wiced_result_t result = app_bt_management_callback(event, p_event_data);
+
+    host_task_switch(prev);
+    cases_gatt_task();
+    return result;
+}
+
+static void cases_connection(wiced_bool_t connected)
+{
+    wiced_bt_gatt_event_data_t evt;
+
+    memset(&evt, 0, sizeof(evt));
+    evt.connection_status.bd_addr   = (uint8_t *)cases_peer_addr;
+    evt.connection_status.addr_type = BLE_ADDR_PUBLIC;
+    evt.connection_status.conn_id   = CASES_CONN_ID;
+    evt.connection_status.connected = connected;
+    evt.connection_status.reason    = connected ? GATT_CONN_UNKNOWN : GATT_CONN_TERMINATE_PEER_USER;
+    evt.connection_status.transport = BT_TRANSPORT_LE;
+    host_bt_gatt_event(GATT_CONNECTION_STATUS_EVT, &evt);
+    cases_gatt_task();
+}
+
+/* Sends one attribute request, lets the GATT task answer it and returns
+ * the status of the response */
+static wiced_bt_gatt_status_t cases_request(wiced_bt_gatt_attribute_request_t *p_req)
+{
+    wiced_bt_gatt_event_data_t evt;
+
+    memset(&evt, 0, sizeof(evt));
+    evt.attribute_request = *p_req;
+    evt.attribute_request.conn_id = CASES_CONN_ID;
+    evt.attribute_request.len_requested = GATT_DEF_BLE_MTU_SIZE - 1u;
+
+    memset(&host_bt_last_rsp, 0, sizeof(host_bt_last_rsp));
+    host_bt_last_rsp.status = WICED_BT_GATT_ERROR;
+    host_bt_gatt_event(GATT_ATTRIBUTE_REQUEST_EVT, &evt);
+    cases_gatt_task();
+
+    host_bt_complete_tx();
+    cases_gatt_task();
+    return host_bt_last_rsp.status;
+}
+
+static wiced_bt_gatt_status_t cases_prepare(uint16_t handle, uint16_t offset,
+                                            const char *p_value)
+{
+    wiced_bt_gatt_attribute_request_t req;
+
+    memset(&req, 0, sizeof(req));
+    req.opcode = GATT_REQ_PREPARE_WRITE;
+    req.data.write_req.handle = handle;
+    req.data.write_req.offset = offset;
+    req.data.write_req.val_len = (uint16_t)strlen(p_value);
+    req.data.write_req.p_val = (uint8_t *)p_value;
+    return cases_request(&req);
+}
+
+static wiced_bt_gatt_status_t cases_execute(wiced_bt_gatt_exec_flag_t flag)
+{
+    wiced_bt_gatt_attribute_request_t req;
+
+    memset(&req, 0, sizeof(req));
+    req.opcode = GATT_REQ_EXECUTE_WRITE;
+    req.data.exec_write = flag;
+    return cases_request(&req);
+}
+
+/* Reads a value whole; the response lands in host_bt_last_rsp */
+static wiced_bt_gatt_status_t cases_read(uint16_t handle)
+{
+    wiced_bt_gatt_attribute_request_t req;
+
+    memset(&req, 0, sizeof(req));
+    req.opcode = GATT_REQ_READ;
+    req.data.read_req.handle = handle;
+    return cases_request(&req);
+}
+
+static wiced_bt_gatt_status_t cases_write(uint16_t handle, const uint8_t *p_value, uint16_t len)
+{
+    wiced_bt_gatt_attribute_request_t req;
+
+    memset(&req, 0, sizeof(req));
+    req.opcode = GATT_REQ_WRITE;
+    req.data.write_req.handle = handle;
+    req.data.write_req.val_len = len;
+    req.data.write_req.p_val = (uint8_t *)p_value;
+    return cases_request(&req);
+}
+
+/* Lets time pass, and the GATT task take up what the timers queued */
+static void cases_wait(uint32_t ms)
+{
+    host_tick_advance(pdMS_TO_TICKS(ms));
+    cases_gatt_task();
+}
+
+/* Confirms the indication the stand-in stack holds, as the stack hands the
+ * confirmation over, and leaves it to the caller to run the GATT task */
+static wiced_bool_t cases_confirm(void)
+{
+    wiced_bt_gatt_event_data_t evt;
+
+    memset(&evt, 0, sizeof(evt));
+    if (!host_bt_take_indication(CASES_CONN_ID, &evt.attribute_request.data.confirm_handle))
+    {
+        return WICED_FALSE;
+    }
+    evt.attribute_request.conn_id = CASES_CONN_ID;
+    evt.attribute_request.opcode = GATT_HANDLE_VALUE_CONF;
+    host_bt_gatt_event(GATT_ATTRIBUTE_REQUEST_EVT, &evt);
+    return WICED_TRUE;
+}
+
+/* Tells whether the last read returned exactly this value */
+static wiced_bool_t cases_read_is(const void *p_value, uint16_t len)
+{
+    return ((GATT_REQ_READ == host_bt_last_rsp.opcode) && (len == host_bt_last_rsp.len) &&
+            (0 == memcmp(host_bt_last_rsp.value, p_value, len))) ? WICED_TRUE : WICED_FALSE;
+}
+
+/* Puts the Device Name back as the database has it */
+static void cases_reset_device_name(void)
+{
+    gatt_db_lookup_table_t *p_attr = &app_gatt_db_ext_attr_tbl[0];
+
+    memcpy(p_attr->p_data, cases_device_name, sizeof(cases_device_name));
+    p_attr->cur_len = sizeof(cases_device_name);
+}
+
+/*******************************************************************************
+*        Queued Writes
+*******************************************************************************/
+/* Two fragments that follow each other are written as one value */
+static void case_prep_write_combined(void)
+{
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_prepare(HDLC_GAP_DEVICE_NAME_VALUE, 0, "Clock"));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_prepare(HDLC_GAP_DEVICE_NAME_VALUE, 5, " Node"));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_execute(GATT_PREPARE_WRITE_EXEC));
+    CASES_EXPECT(GATT_REQ_EXECUTE_WRITE == host_bt_last_rsp.opcode);
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_GAP_DEVICE_NAME_VALUE));
+    CASES_EXPECT(cases_read_is("Clock Node", 10));
+}
+
+/* A fragment past the end of the value queued so far leaves a gap: the
+ * whole queue is refused at execute and the value stays as it was */
+static void case_prep_write_gap(void)
+{
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_prepare(HDLC_GAP_DEVICE_NAME_VALUE, 0, "ABCD"));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_prepare(HDLC_GAP_DEVICE_NAME_VALUE, 6, "WXYZ"));
+    CASES_EXPECT(WICED_BT_GATT_INVALID_OFFSET == cases_execute(GATT_PREPARE_WRITE_EXEC));
+    CASES_EXPECT(GATT_REQ_EXECUTE_WRITE == host_bt_last_rsp.opcode);
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_GAP_DEVICE_NAME_VALUE));
+    CASES_EXPECT(cases_read_is(cases_device_name, sizeof(cases_device_name)));
+
+    /* The queue was dropped with the error */
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_execute(GATT_PREPARE_WRITE_EXEC));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_GAP_DEVICE_NAME_VALUE));
+    CASES_EXPECT(cases_read_is(cases_device_name, sizeof(cases_device_name)));
+}
+
+/* An offset one past the longest value is refused when it is prepared */
+static void case_prep_write_past_max_len(void)
+{
+    uint16_t max_len = app_gatt_db_ext_attr_tbl[0].max_len;
+
+    CASES_EXPECT(WICED_BT_GATT_INVALID_OFFSET ==
+                 cases_prepare(HDLC_GAP_DEVICE_NAME_VALUE, (uint16_t)(max_len + 1u), "A"));
+    CASES_EXPECT(GATT_REQ_PREPARE_WRITE == host_bt_last_rsp.opcode);
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_execute(GATT_PREPARE_WRITE_EXEC));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_GAP_DEVICE_NAME_VALUE));
+    CASES_EXPECT(cases_read_is(cases_device_name, sizeof(cases_device_name)));
+}
+
+/* A later fragment at offset 0 starts the value again */
+static void case_prep_write_restart(void)
+{
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_prepare(HDLC_GAP_DEVICE_NAME_VALUE, 0, "XXXXXXXXXX"));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_prepare(HDLC_GAP_DEVICE_NAME_VALUE, 0, "Hub"));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_execute(GATT_PREPARE_WRITE_EXEC));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_GAP_DEVICE_NAME_VALUE));
+    CASES_EXPECT(cases_read_is("Hub", 3));
+}
+
+/* A cancelled queue writes nothing */
+static void case_prep_write_cancel(void)
+{
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_prepare(HDLC_GAP_DEVICE_NAME_VALUE, 0, "Gone"));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_execute(GATT_PREPARE_WRITE_CANCEL));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_GAP_DEVICE_NAME_VALUE));
+    CASES_EXPECT(cases_read_is(cases_device_name, sizeof(cases_device_name)));
+}
+
+/*******************************************************************************
+*        Current Time
+*******************************************************************************/
+/* The last second of a leap day: 2024-02-29 23:59:59, a Thursday, with the
+ * Day of Week left unknown and half a second gone */
+static const uint8_t cases_leap_day[APP_CTS_TIME_PAYLOAD_LEN] =
+{
+    0xE8, 0x07, 2, 29, 23, 59, 59, 0, 128, 0
+};
+
+/* A written time reads back with Manual Update set; a second later the date
+ * has moved to March 1st, a Friday, and the Adjust Reason is cleared */
+static void case_current_time_leap_day(void)
+{
+    static const uint8_t set[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 2, 29, 23, 59, 59, 4, 128, APP_CTS_TIME_ADJUST_MANUAL };
+    static const uint8_t next[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 3, 1, 0, 0, 0, 5, 0, 0 };
+
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, cases_leap_day, sizeof(cases_leap_day)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_CURRENT_TIME_VALUE));
+    CASES_EXPECT(cases_read_is(set, sizeof(set)));
+
+    cases_wait(1000);
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_CURRENT_TIME_VALUE));
+    CASES_EXPECT(cases_read_is(next, sizeof(next)));
+}
+
+/* A client may only set the Manual and External Update bits */
+static void case_current_time_adjust_reason(void)
+{
+    static const uint8_t write[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 2, 29, 12, 0, 0, 4, 0,
+          APP_CTS_TIME_ADJUST_EXTERNAL | APP_CTS_TIME_ADJUST_TIME_ZONE };
+    static const uint8_t set[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 2, 29, 12, 0, 0, 4, 0, APP_CTS_TIME_ADJUST_EXTERNAL };
+
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, write, sizeof(write)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_CURRENT_TIME_VALUE));
+    CASES_EXPECT(cases_read_is(set, sizeof(set)));
+}
+
+/* Dates that do not exist, fields out of range and partial values are
+ * refused and leave the time alone */
+static void case_current_time_invalid(void)
+{
+    static const uint8_t not_leap[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE7, 0x07, 2, 29, 12, 0, 0, 0, 0, 0 };
+    static const uint8_t hours[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 2, 29, 24, 0, 0, 0, 0, 0 };
+    static const uint8_t day_of_week[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 2, 29, 12, 0, 0, 8, 0, 0 };
+    uint8_t before[APP_CTS_TIME_PAYLOAD_LEN];
+
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, cases_leap_day, sizeof(cases_leap_day)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_CURRENT_TIME_VALUE));
+    memcpy(before, host_bt_last_rsp.value, sizeof(before));
+
+    CASES_EXPECT(WICED_BT_GATT_VALUE_NOT_ALLOWED ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, not_leap, sizeof(not_leap)));
+    CASES_EXPECT(WICED_BT_GATT_VALUE_NOT_ALLOWED ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, hours, sizeof(hours)));
+    CASES_EXPECT(WICED_BT_GATT_VALUE_NOT_ALLOWED ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, day_of_week, sizeof(day_of_week)));
+    CASES_EXPECT(WICED_BT_GATT_INVALID_ATTR_LEN ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, cases_leap_day,
+                             sizeof(cases_leap_day) - 1u));
+    CASES_EXPECT(WICED_BT_GATT_NOT_LONG == cases_prepare(HDLC_CTS_CURRENT_TIME_VALUE, 0, "x"));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_CURRENT_TIME_VALUE));
+    CASES_EXPECT(cases_read_is(before, sizeof(before)));
+}
+
+/* Local Time Information moves the encoded local time and sets the Time Zone
+ * and DST bits; a Current Time written afterwards is taken as local time */
+static void case_local_time_info(void)
+{
+    static const uint8_t utc[APP_CTS_TIME_LTI_LEN] = { 0, 0 };
+    static const uint8_t cet_dst[APP_CTS_TIME_LTI_LEN] = { 4, 4 };
+    static const uint8_t unknown[APP_CTS_TIME_LTI_LEN] = { 0x80, 0 };
+    static const uint8_t local[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 3, 1, 1, 59, 59, 5, 128,
+          APP_CTS_TIME_ADJUST_TIME_ZONE | APP_CTS_TIME_ADJUST_DST };
+    static const uint8_t noon[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 3, 1, 12, 0, 0, 5, 0, APP_CTS_TIME_ADJUST_MANUAL };
+
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, cases_leap_day, sizeof(cases_leap_day)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE, cet_dst, sizeof(cet_dst)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE));
+    CASES_EXPECT(cases_read_is(cet_dst, sizeof(cet_dst)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_CURRENT_TIME_VALUE));
+    CASES_EXPECT(cases_read_is(local, sizeof(local)));
+
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, noon, sizeof(noon)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_CURRENT_TIME_VALUE));
+    CASES_EXPECT(cases_read_is(noon, sizeof(noon)));
+
+    CASES_EXPECT(WICED_BT_GATT_VALUE_NOT_ALLOWED ==
+                 cases_write(HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE, unknown, sizeof(unknown)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE, utc, sizeof(utc)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE));
+    CASES_EXPECT(cases_read_is(utc, sizeof(utc)));
+}
+
+/* With notifications every 5 s, setting the clock sends the adjusted time at
+ * once with its Adjust Reason, and the next notification follows a period
+ * later without it. Tells whether the last notification was this value. */
+static wiced_bool_t cases_notified_is(const uint8_t *p_value, uint16_t len)
+{
+    return ((GATT_HANDLE_VALUE_NOTIF == host_bt_last_value.opcode) &&
+            (len == host_bt_last_value.len) &&
+            (0 == memcmp(host_bt_last_value.value, p_value, len))) ? WICED_TRUE : WICED_FALSE;
+}
+
+static void case_current_time_adjust_notify(void)
+{
+    static const uint8_t notify[APP_BT_CONN_CCCD_LEN] = { GATT_CLIENT_CONFIG_NOTIFICATION, 0 };
+    static const uint8_t off[APP_BT_CONN_CCCD_LEN] = { 0, 0 };
+    static const uint8_t back[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 2, 29, 22, 59, 59, 4, 0, APP_CTS_TIME_ADJUST_MANUAL };
+    static const uint8_t later[APP_CTS_TIME_PAYLOAD_LEN] =
+        { 0xE8, 0x07, 2, 29, 23, 0, 4, 4, 0, 0 };
+    static const uint8_t utc[APP_CTS_TIME_LTI_LEN] = { 0, 0 };
+    static const uint8_t zone[APP_CTS_TIME_LTI_LEN] = { 4, 0 };
+    uint32_t sent;
+
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, cases_leap_day, sizeof(cases_leap_day)));
+    CASES_EXPECT(WICED_BT_SUCCESS == app_cts_sched_set_period(5));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, notify, sizeof(notify)));
+    cases_wait(1000);
+    host_bt_complete_tx();
+    sent = host_bt_stats.notifications;
+
+    /* An hour back: sent right away, not when the old due second comes */
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_CURRENT_TIME_VALUE, back, sizeof(back)));
+    cases_wait(1);
+    host_bt_complete_tx();
+    CASES_EXPECT((sent + 1u) == host_bt_stats.notifications);
+    CASES_EXPECT(cases_notified_is(back, sizeof(back)));
+
+    /* The notification carried the reason; reads no longer show it */
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS == cases_read(HDLC_CTS_CURRENT_TIME_VALUE));
+    CASES_EXPECT((GATT_REQ_READ == host_bt_last_rsp.opcode) &&
+                 (0 == host_bt_last_rsp.value[APP_CTS_TIME_ADJUST_REASON]));
+
+    cases_wait(5000);
+    host_bt_complete_tx();
+    CASES_EXPECT((sent + 2u) == host_bt_stats.notifications);
+    CASES_EXPECT(cases_notified_is(later, sizeof(later)));
+
+    /* A time zone change is sent right away as well */
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE, zone, sizeof(zone)));
+    cases_wait(1);
+    host_bt_complete_tx();
+    CASES_EXPECT((sent + 3u) == host_bt_stats.notifications);
+    CASES_EXPECT((GATT_HANDLE_VALUE_NOTIF == host_bt_last_value.opcode) &&
+                 (APP_CTS_TIME_ADJUST_TIME_ZONE ==
+                  host_bt_last_value.value[APP_CTS_TIME_ADJUST_REASON]));
+
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE, utc, sizeof(utc)));
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, off, sizeof(off)));
+    app_cts_sched_set_period(APP_CTS_SCHED_PERIOD_S);
+    host_bt_complete_tx();
+}
+
+/*******************************************************************************
+*        Indications
+*******************************************************************************/
+/* A confirmation that arrives while requests fill the GATT task queue is
+ * neither refused nor lost: the next indication still goes out */
+static void case_indication_confirm_queue_full(void)
+{
+    static const uint8_t indicate[APP_BT_CONN_CCCD_LEN] = { GATT_CLIENT_CONFIG_INDICATION, 0 };
+    static const uint8_t off[APP_BT_CONN_CCCD_LEN] = { 0, 0 };
+    wiced_bt_gatt_event_data_t evt;
+    uint32_t errors;
+    uint32_t indications;
+    uint32_t i;
+
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, indicate, sizeof(indicate)));
+    cases_wait(1000);
+    host_bt_complete_tx();
+    indications = host_bt_stats.indications;
+    CASES_EXPECT(0 != indications);
+
+    /* Reads the GATT task does not get to until the queue refuses one */
+    memset(&evt, 0, sizeof(evt));
+    evt.attribute_request.conn_id = CASES_CONN_ID;
+    evt.attribute_request.opcode = GATT_REQ_READ;
+    evt.attribute_request.len_requested = GATT_DEF_BLE_MTU_SIZE - 1u;
+    evt.attribute_request.data.read_req.handle = HDLC_GAP_APPEARANCE_VALUE;
+    errors = host_bt_stats.error_rsp;
+    for (i = 0; (i < APP_BT_GATT_TASK_QUEUE_LENGTH) && (errors == host_bt_stats.error_rsp); i++)
+    {
+        host_bt_gatt_event(GATT_ATTRIBUTE_REQUEST_EVT, &evt);
+    }
+    CASES_EXPECT(errors != host_bt_stats.error_rsp);
+
+    errors = host_bt_stats.error_rsp;
+    CASES_EXPECT(cases_confirm());
+    CASES_EXPECT(errors == host_bt_stats.error_rsp);
+    cases_gatt_task();
+    host_bt_complete_tx();
+    cases_gatt_task();
+
+    cases_wait(1000);
+    host_bt_complete_tx();
+    CASES_EXPECT((indications + 1u) == host_bt_stats.indications);
+
+    CASES_EXPECT(cases_confirm());
+    cases_gatt_task();
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, off, sizeof(off)));
+}
+
+/* Confirming an indication every second is not activity: the link still
+ * relaxes to the idle connection parameters */
+static void case_indication_link_relaxes(void)
+{
+    static const uint8_t indicate[APP_BT_CONN_CCCD_LEN] = { GATT_CLIENT_CONFIG_INDICATION, 0 };
+    static const uint8_t off[APP_BT_CONN_CCCD_LEN] = { 0, 0 };
+    app_bt_conn_param_stats_t before;
+    app_bt_conn_param_stats_t after;
+    uint32_t i;
+
+    app_bt_conn_param_get_stats(&before);
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, indicate, sizeof(indicate)));
+    for (i = 0; i < 2u * (APP_BT_CONN_PARAM_IDLE_AFTER_MS / 1000u) + 1u; i++)
+    {
+        cases_wait(1000);
+        host_bt_complete_tx();
+        CASES_EXPECT(cases_confirm());
+        cases_gatt_task();
+    }
+    app_bt_conn_param_get_stats(&after);
+    CASES_EXPECT(after.to_idle > before.to_idle);
+
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, off, sizeof(off)));
+}
+
+/*******************************************************************************
+*        GATT Task Calls
+*******************************************************************************/
+static void cases_nothing(void *p_data)
+{
+    (void)p_data;
+}
+
+/* Ordinary calls that fill their share of the queue do not keep a sent
+ * notification from being released, and a peer the scan reports again and
+ * again is handed over once until the GATT task took it up */
+static void case_reserved_calls(void)
+{
+    static const uint8_t notify[APP_BT_CONN_CCCD_LEN] = { GATT_CLIENT_CONFIG_NOTIFICATION, 0 };
+    static const uint8_t off[APP_BT_CONN_CCCD_LEN] = { 0, 0 };
+    static uint8_t adv[] = { 11, BTM_BLE_ADVERT_TYPE_NAME_COMPLETE,
+                             'C', 'T', 'S', ' ', 'C', 'l', 'i', 'e', 'n', 't', 0 };
+    wiced_bt_ble_scan_results_t report;
+    app_bt_gatt_task_stats_t before;
+    app_bt_gatt_task_stats_t after;
+    app_bt_notify_stats_t notify_stats;
+    uint32_t i;
+
+    /* The connected client, still advertising */
+    CASES_EXPECT(host_bt_is_scanning());
+    memset(&report, 0, sizeof(report));
+    memcpy(report.remote_bd_addr, cases_peer_addr, BD_ADDR_LEN);
+    report.ble_addr_type = BLE_ADDR_PUBLIC;
+    report.rssi = -60;
+    app_bt_gatt_task_get_stats(&before);
+    for (i = 0; i < 10u; i++)
+    {
+        host_bt_scan_report(&report, adv);
+    }
+    app_bt_gatt_task_get_stats(&after);
+    CASES_EXPECT((before.calls + 1u) == after.calls);
+    cases_gatt_task();
+    host_bt_scan_report(&report, adv);
+    app_bt_gatt_task_get_stats(&after);
+    CASES_EXPECT((before.calls + 2u) == after.calls);
+    cases_gatt_task();
+
+    /* A notification at the stack, then calls until they are refused */
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, notify, sizeof(notify)));
+    cases_wait(1000);
+    app_bt_notify_get_stats(&notify_stats);
+    CASES_EXPECT(0 != notify_stats.depth);
+    for (i = 0; (i < APP_BT_GATT_TASK_QUEUE_LENGTH) &&
+                (WICED_BT_SUCCESS == app_bt_gatt_task_defer(cases_nothing, NULL, 0)); i++)
+    {
+    }
+    CASES_EXPECT(i < APP_BT_GATT_TASK_QUEUE_LENGTH);
+
+    app_bt_gatt_task_get_stats(&before);
+    CASES_EXPECT(0 != host_bt_complete_tx());
+    app_bt_gatt_task_get_stats(&after);
+    CASES_EXPECT(before.calls_lost == after.calls_lost);
+    cases_gatt_task();
+
+    /* The entry came back */
+    app_bt_notify_get_stats(&notify_stats);
+    CASES_EXPECT(0 == notify_stats.depth);
+    CASES_EXPECT(WICED_BT_GATT_SUCCESS ==
+                 cases_write(HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, off, sizeof(off)));
+}
+
+/*******************************************************************************
+*        Driver
+*******************************************************************************/
+/* Runs one case on a fresh connection and prints its result */
+static void cases_run_one(const char *p_name, void (*p_case)(void))
+{
+    cases_name = p_name;
+    cases_failed = WICED_FALSE;
+    cases_reset_device_name();
+    cases_connection(WICED_TRUE);
+
+    p_case();
+
+    cases_connection(WICED_FALSE);
+    host_bt_complete_tx();
+    cases_run++;
+    if (cases_failed)
+    {
+        cases_failures++;
+    }
+    else
+    {
+        fprintf(cases_out, "%-40s ok\n", p_name);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    wiced_bt_management_evt_data_t mgmt;
+    int saved_stdout;
+    int verbose = 0;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "v")))
+    {
+        switch (opt)
+        {
+            case 'v':
+                verbose = 1;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    /* The application logs to stdout; park it on /dev/null, the results
+     * go to the real one */
+    fflush(stdout);
+    saved_stdout = dup(STDOUT_FILENO);
+    cases_out = fdopen(saved_stdout, "w");
+    setvbuf(cases_out, NULL, _IOLBF, 0);
+    if (!verbose)
+    {
+        dup2(open("/dev/null", O_WRONLY), STDOUT_FILENO);
+    }
+
+    app_bt_bond_init(&app_bt_bond_default_store);
+    memset(&mgmt, 0, sizeof(mgmt));
+    if (WICED_BT_SUCCESS != cases_management(BTM_LOCAL_IDENTITY_KEYS_REQUEST_EVT, &mgmt))
+    {
+        memset(&mgmt, 0xA5, sizeof(mgmt));
+        cases_management(BTM_LOCAL_IDENTITY_KEYS_UPDATE_EVT, &mgmt);
+    }
+    memset(&mgmt, 0, sizeof(mgmt));
+    mgmt.enabled.status = WICED_BT_SUCCESS;
+    cases_management(BTM_ENABLED_EVT, &mgmt);
+
+    cases_run_one("prep_write_combined", case_prep_write_combined);
+    cases_run_one("prep_write_gap", case_prep_write_gap);
+    cases_run_one("prep_write_past_max_len", case_prep_write_past_max_len);
+    cases_run_one("prep_write_restart", case_prep_write_restart);
+    cases_run_one("prep_write_cancel", case_prep_write_cancel);
+    cases_run_one("current_time_leap_day", case_current_time_leap_day);
+    cases_run_one("current_time_adjust_reason", case_current_time_adjust_reason);
+    cases_run_one("current_time_invalid", case_current_time_invalid);
+    cases_run_one("local_time_info", case_local_time_info);
+    cases_run_one("current_time_adjust_notify", case_current_time_adjust_notify);
+    cases_run_one("indication_confirm_queue_full", case_indication_confirm_queue_full);
+    cases_run_one("indication_link_relaxes", case_indication_link_relaxes);
+    cases_run_one("reserved_calls", case_reserved_calls);
+
+    fprintf(cases_out, "Cases: %u run, %u failed\n", cases_run, cases_failures);
+    fflush(cases_out);
+    return (0 == cases_failures) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,944 @@
+/******************************************************************************
+* File Name: gatt_load.c
+*
+* Description: GATT load driver for the host build. Sends synthetic GATT
+*              request and connection events through the application's GATT
+*              callback and reports throughput and per-opcode latency.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Usage: gatt_load [-n requests] [-c clients] [-r requests_per_connection]
+ *                  [-t ms_per_request] [-d reconnect_ms] [-l uart_file]
+ *                  [-b bond_file] [-i idle_ms] [-m mtu] [-e octets] [-s db]
+ *                  [-p] [-v]
+ *   -n  Number of attribute requests to send (default 100000)
+ *   -c  Number of clients connected at the same time (default 1). Requests
+ *       are spread round robin over the clients.
+ *   -r  Disconnect and reconnect after this many requests (default 1000,
+ *       0 keeps one connection for the whole run)
+ *   -t  Simulated milliseconds between two requests (default 1). Drives the
+ *       RTC and the periodic notifications.
+ *   -d  Simulated milliseconds between a client leaving and becoming
+ *       reachable again (default 20). Longer than the reconnect timeout
+ *       exercises the fallback scan.
+ *   -l  Write the raw UART output to this file. With a tokenized build this
+ *       is the binary log that log_decode reads.
+ *   -b  Keep the bonds in this file. A second run with the same file finds
+ *       every client bonded, as after a reset of the target.
+ *   -i  Simulated milliseconds of quiet after each pass of the request mix,
+ *       when clients only receive notifications (default 0). Longer than
+ *       APP_BT_CONN_PARAM_IDLE_AFTER_MS relaxes the connection parameters.
+ *   -m  ATT MTU of the clients (default 247). The server asks for a larger
+ *       MTU on every connection and the clients agree up to this value.
+ *   -e  LL payload the clients accept when the server asks for a data
+ *       length update (default 251, 27 for clients without Data Length
+ *       Extension)
+ *   -s  Each client is heard this many dB weaker than the one before; the
+ *       first at -50 dBm (default 0). Spreads the clients over the PHYs.
+ *   -p  The clients do not support LE Coded and stay on LE 1M when asked
+ *       for it
+ *   -v  Keep the application's console output instead of discarding it
+ */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "host_stub.h"
+#include "cycfg_gatt_db.h"
+#include "cts_server.h"
+#include "app_bt_pool.h"
+#include "app_cts_sched.h"
+#include "app_cts_time.h"
+#include "app_log.h"
+#include "app_scan_cache.h"
+#include "app_bt_reconnect.h"
+#include "app_bt_bond.h"
+#include "app_bt_conn_param.h"
+#include "app_bt_mtu.h"
+#include "app_bt_phy.h"
+#include "app_bt_prep_write.h"
+#include "app_bt_notify.h"
+#include "app_bt_gatt_task.h"
+#include "app_cpu.h"
+#include "app_mem.h"
+#include "app_latency.h"
+#include "cy_retarget_io.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define LOAD_DEFAULT_REQUESTS           (100000u)
+#define LOAD_DEFAULT_PER_CONNECTION     (1000u)
+#define LOAD_DEFAULT_CLIENTS            (1u)
+#define LOAD_MAX_CLIENTS                (16u)
+#define LOAD_DEFAULT_MS_PER_REQUEST     (1u)
+#define LOAD_DEFAULT_RECONNECT_MS       (20u)
+#define LOAD_IDLE_STEP_MS               (10u)
+
+/* Requests between two log drains, like the log task's period at 1 ms/request */
+#define LOAD_LOG_DRAIN_REQUESTS         (APP_LOG_DRAIN_PERIOD_MS)
+/* Requests between two CPU samples, one window at 1 ms/request */
+#define LOAD_CPU_SAMPLE_REQUESTS        (APP_CPU_WINDOW_MS)
+#define LOAD_CONN_ID                    (0x8001u)
+#define LOAD_DEFAULT_MTU                (247u)
+#define LOAD_DEFAULT_TX_OCTETS          (251u)
+#define LOAD_RSSI                       (-50)
+#define LOAD_MIN_RSSI                   (-127)
+
+/* Latency buckets beyond the 256 ATT opcodes */
+#define LOAD_SLOT_CONNECT               (256u)
+#define LOAD_SLOT_DISCONNECT            (257u)
+#define LOAD_SLOT_GATT_TASK             (258u)
+#define LOAD_SLOT_COUNT                 (259u)
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+/* One entry of the request mix, sent in table order round robin */
+typedef struct
+{
+    wiced_bt_gatt_opcode_t opcode;
+    uint16_t               handle;
+    uint16_t               offset;
+    uint16_t               uuid16;
+    uint16_t               value;
+} load_request_t;
+
+typedef struct
+{
+    uint64_t *p_samples;
+    uint32_t count;
+    uint32_t capacity;
+} load_latency_t;
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+/* Roughly what a client does during discovery followed by steady polling,
+ * staying subscribed to Current Time notifications */
+static const load_request_t load_mix[] =
+{
+    { GATT_REQ_MTU,          0,      0, 0,                         0 },
+    { GATT_REQ_READ_BY_TYPE, 0x0001, 0, GATT_UUID_CHAR_DECLARE,             0 },
+    { GATT_REQ_READ_BY_TYPE, 0x0001, 0, __UUID_CHARACTERISTIC_DEVICE_NAME,  0 },
+    { GATT_REQ_READ_BY_TYPE, 0x0001, 0, __UUID_CHARACTERISTIC_CURRENT_TIME, 0 },
+    { GATT_REQ_READ,         HDLC_GAP_DEVICE_NAME_VALUE,               0, 0, 0 },
+    { GATT_REQ_READ_BLOB,    HDLC_GAP_DEVICE_NAME_VALUE,               4, 0, 0 },
+    { GATT_REQ_READ,         HDLC_GAP_APPEARANCE_VALUE,                0, 0, 0 },
+    { GATT_REQ_READ,         HDLC_CTS_CURRENT_TIME_VALUE,              0, 0, 0 },
+    { GATT_REQ_READ_MULTI,   0,                                        0, 0, 0 },
+    { GATT_REQ_READ_MULTI_VAR_LENGTH, 0,                               0, 0, 0 },
+    { GATT_REQ_PREPARE_WRITE, HDLC_GAP_DEVICE_NAME_VALUE,              0, 0, 6 },
+    { GATT_REQ_PREPARE_WRITE, HDLC_GAP_DEVICE_NAME_VALUE,              6, 0, 4 },
+    { GATT_REQ_EXECUTE_WRITE, 0,                                       0, 0,
+                              GATT_PREPARE_WRITE_EXEC },
+    { GATT_REQ_PREPARE_WRITE, HDLC_GAP_DEVICE_NAME_VALUE,              0, 0, 4 },
+    { GATT_REQ_EXECUTE_WRITE, 0,                                       0, 0,
+                              GATT_PREPARE_WRITE_CANCEL },
+    { GATT_REQ_WRITE,        HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, 0, 0,
+                             GATT_CLIENT_CONFIG_NOTIFICATION },
+    { GATT_REQ_READ,         HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, 0, 0, 0 },
+    { GATT_CMD_WRITE,        HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG, 0, 0,
+                             GATT_CLIENT_CONFIG_NOTIFICATION },
+    { GATT_REQ_READ,         0x00F0,                                   0, 0, 0 },
+};
+
+/* Handles asked for by Read Multiple, the variable length value last as a
+ * Read Multiple Request needs */
+static uint8_t load_multi_handles[] =
+{
+    (uint8_t)(HDLC_CTS_CURRENT_TIME_VALUE & 0xFF), (uint8_t)(HDLC_CTS_CURRENT_TIME_VALUE >> 8),
+    (uint8_t)(HDLC_GAP_APPEARANCE_VALUE & 0xFF),   (uint8_t)(HDLC_GAP_APPEARANCE_VALUE >> 8),
+    (uint8_t)(HDLC_GAP_DEVICE_NAME_VALUE & 0xFF),  (uint8_t)(HDLC_GAP_DEVICE_NAME_VALUE >> 8),
+};
+
+/* Written back in pieces with Prepare Write Requests, which carry the
+ * length in 'value'. The name stays the same, so reads are not affected. */
+static uint8_t load_device_name[] = { 'C', 'T', 'S', ' ', 'S', 'e', 'r', 'v', 'e', 'r' };
+
+static load_latency_t load_latency[LOAD_SLOT_COUNT];
+static uint32_t       load_reconnect_ms = LOAD_DEFAULT_RECONNECT_MS;
+static uint32_t       load_idle_ms;
+static uint16_t       load_client_mtu = LOAD_DEFAULT_MTU;
+static uint16_t       load_client_octets = LOAD_DEFAULT_TX_OCTETS;
+static uint32_t       load_rssi_step;
+static wiced_bool_t   load_no_coded;
+static wiced_bool_t   load_indicate;
+
+/* ATT MTU in use with each client, for the length offered with requests */
+static uint16_t       load_mtu[LOAD_MAX_CLIENTS];
+
+/* Defined by main.c on the target */
+TaskHandle_t button_task_handle;
+
+static const wiced_bt_device_address_t load_peer_addr = { 0x00, 0xA0, 0x50, 0x11, 0x22, 0x33 };
+
+/* Advertising data of the even clients: Flags, Complete Local Name "CTS Client" */
+static uint8_t load_peer_adv[] =
+{
+    0x02, BTM_BLE_ADVERT_TYPE_FLAG, 0x06,
+    0x0B, BTM_BLE_ADVERT_TYPE_NAME_COMPLETE, 'C', 'T', 'S', ' ', 'C', 'l', 'i', 'e', 'n', 't',
+    0x00
+};
+
+/* Advertising data of the odd clients: Flags, TX Power, Appearance, a
+ * shortened name and the Current Time Service as a solicited service */
+static uint8_t load_peer_adv_solicit[] =
+{
+    0x02, BTM_BLE_ADVERT_TYPE_FLAG, 0x06,
+    0x02, BTM_BLE_ADVERT_TYPE_TX_POWER, 0x04,
+    0x03, BTM_BLE_ADVERT_TYPE_APPEARANCE, 0x00, 0x03,
+    0x04, BTM_BLE_ADVERT_TYPE_NAME_SHORT, 'C', 'T', 'S',
+    0x03, 0x14, 0x05, 0x18,
+    0x00
+};
+
+/*******************************************************************************
+*        Function Definitions
+*******************************************************************************/
+static const char *load_slot_name(uint32_t slot)
+{
+    switch (slot)
+    {
+        case GATT_REQ_MTU:            return "GATT_REQ_MTU";
+        case GATT_REQ_READ:           return "GATT_REQ_READ";
+        case GATT_REQ_READ_BLOB:      return "GATT_REQ_READ_BLOB";
+        case GATT_REQ_READ_BY_TYPE:   return "GATT_REQ_READ_BY_TYPE";
+        case GATT_REQ_READ_MULTI:     return "GATT_REQ_READ_MULTI";
+        case GATT_REQ_READ_MULTI_VAR_LENGTH: return "GATT_REQ_READ_MULTI_VAR_LENGTH";
+        case GATT_REQ_PREPARE_WRITE:  return "GATT_REQ_PREPARE_WRITE";
+        case GATT_REQ_EXECUTE_WRITE:  return "GATT_REQ_EXECUTE_WRITE";
+        case GATT_REQ_WRITE:          return "GATT_REQ_WRITE";
+        case GATT_CMD_WRITE:          return "GATT_CMD_WRITE";
+        case LOAD_SLOT_CONNECT:       return "CONNECTION_STATUS(up)";
+        case LOAD_SLOT_DISCONNECT:    return "CONNECTION_STATUS(down)";
+        case LOAD_SLOT_GATT_TASK:     return "GATT task";
+        default:                      return "other";
+    }
+}
+
+static void load_record(uint32_t slot, uint64_t ns)
+{
+    load_latency_t *p_lat = &load_latency[slot];
+
+    if (p_lat->count == p_lat->capacity)
+    {
+        p_lat->capacity = (0 == p_lat->capacity) ? 1024u : (p_lat->capacity * 2u);
+        p_lat->p_samples = realloc(p_lat->p_samples, p_lat->capacity * sizeof(uint64_t));
+        if (NULL == p_lat->p_samples)
+        {
+            fprintf(stderr, "out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    p_lat->p_samples[p_lat->count++] = ns;
+}
+
+static int load_cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* Every client gets its own address and connection ID */
+static void load_client_addr(uint32_t client, wiced_bt_device_address_t bd_addr)
+{
+    memcpy(bd_addr, load_peer_addr, BD_ADDR_LEN);
+    bd_addr[BD_ADDR_LEN - 1] = (uint8_t)(bd_addr[BD_ADDR_LEN - 1] + client);
+}
+
+static int8_t load_client_rssi(uint32_t client)
+{
+    return (int8_t)MAX(LOAD_RSSI - (int32_t)(client * load_rssi_step), LOAD_MIN_RSSI);
+}
+
+/* Stands in for the GATT task, timed apart from the callback that queued
+ * the requests and the events. Nothing is queued when the callback handles
+ * them itself. */
+static void load_gatt_task(void)
+{
+    TaskHandle_t prev = host_task_switch(host_task_find("gatt_task"));
+    uint64_t start = host_time_ns();
+
+    if (0 != app_bt_gatt_task_process(0))
+    {
+        load_record(LOAD_SLOT_GATT_TASK, host_time_ns() - start);
+    }
+    host_task_switch(prev);
+}
+
+/* The stack delivers management events in its own task; those it hands over
+ * are taken up by the GATT task right after */
+static wiced_result_t load_management(wiced_bt_management_evt_t event,
+                                      wiced_bt_management_evt_data_t *p_event_data)
+{
+    TaskHandle_t prev = host_task_switch(host_bt_task());
+    wiced_result_t result = app_bt_management_callback(event, p_event_data);
+
+    host_task_switch(prev);
+    load_gatt_task();
+    return result;
+}
+
+/* Stands in for the log task */
+static void load_log_task(void)
+{
+    TaskHandle_t prev = host_task_switch(host_task_find("log_task"));
+
+    app_log_drain();
+    host_task_switch(prev);
+}
+
+/* Stands in for the CPU stats task */
+static void load_cpu_task(void)
+{
+    TaskHandle_t prev = host_task_switch(host_task_find("cpu_stats"));
+
+    app_cpu_sample();
+    host_task_switch(prev);
+}
+
+/* Stands in for the memory report of the CPU stats task, without its print */
+static void load_mem_report(void)
+{
+    TaskHandle_t prev = host_task_switch(host_task_find("cpu_stats"));
+
+    app_mem_sample();
+    host_task_switch(prev);
+}
+
+static void load_connection_event(uint32_t client, wiced_bool_t connected)
+{
+    wiced_bt_gatt_event_data_t evt;
+    wiced_bt_device_address_t bd_addr;
+    uint64_t start;
+
+    load_client_addr(client, bd_addr);
+    memset(&evt, 0, sizeof(evt));
+    evt.connection_status.bd_addr   = bd_addr;
+    evt.connection_status.addr_type = BLE_ADDR_PUBLIC;
+    evt.connection_status.conn_id   = (uint16_t)(LOAD_CONN_ID + client);
+    evt.connection_status.connected = connected;
+    evt.connection_status.reason    = connected ? GATT_CONN_UNKNOWN : GATT_CONN_TERMINATE_PEER_USER;
+    evt.connection_status.transport = BT_TRANSPORT_LE;
+    load_mtu[client] = GATT_DEF_BLE_MTU_SIZE;
+
+    start = host_time_ns();
+    host_bt_gatt_event(GATT_CONNECTION_STATUS_EVT, &evt);
+    load_record(connected ? LOAD_SLOT_CONNECT : LOAD_SLOT_DISCONNECT, host_time_ns() - start);
+    load_gatt_task();
+    host_bt_set_rssi(bd_addr, load_client_rssi(client));
+}
+
+/* Plays the stack and the client through the security procedure the
+ * application asked for: encryption with stored keys, or pairing first */
+static void load_encrypt(uint32_t client)
+{
+    wiced_bt_management_evt_data_t mgmt;
+    wiced_bt_device_address_t bd_addr;
+
+    load_client_addr(client, bd_addr);
+    if (!host_bt_take_encryption_request(bd_addr))
+    {
+        return;
+    }
+
+    memset(&mgmt, 0, sizeof(mgmt));
+    memcpy(mgmt.paired_device_link_keys_request.bd_addr, bd_addr, BD_ADDR_LEN);
+    if (WICED_BT_SUCCESS != load_management(BTM_PAIRED_DEVICE_LINK_KEYS_REQUEST_EVT, &mgmt))
+    {
+        memset(&mgmt, 0, sizeof(mgmt));
+        memcpy(mgmt.pairing_io_capabilities_ble_request.bd_addr, bd_addr, BD_ADDR_LEN);
+        load_management(BTM_PAIRING_IO_CAPABILITIES_BLE_REQUEST_EVT, &mgmt);
+
+        memset(&mgmt, 0, sizeof(mgmt));
+        mgmt.pairing_complete.bd_addr = bd_addr;
+        mgmt.pairing_complete.transport = BT_TRANSPORT_LE;
+        mgmt.pairing_complete.pairing_complete_info.ble.status = WICED_BT_SUCCESS;
+        load_management(BTM_PAIRING_COMPLETE_EVT, &mgmt);
+
+        memset(&mgmt, 0, sizeof(mgmt));
+        memcpy(mgmt.paired_device_link_keys_update.bd_addr, bd_addr, BD_ADDR_LEN);
+        memset(&mgmt.paired_device_link_keys_update.key_data, (int)(client + 1u),
+               sizeof(mgmt.paired_device_link_keys_update.key_data));
+        load_management(BTM_PAIRED_DEVICE_LINK_KEYS_UPDATE_EVT, &mgmt);
+    }
+
+    memset(&mgmt, 0, sizeof(mgmt));
+    mgmt.encryption_status.bd_addr = bd_addr;
+    mgmt.encryption_status.transport = BT_TRANSPORT_LE;
+    mgmt.encryption_status.result = WICED_BT_SUCCESS;
+    load_management(BTM_ENCRYPTION_STATUS_EVT, &mgmt);
+}
+
+/* Plays the controller and the clients: grants the connection parameter
+ * updates the application asked for, including one it asks for on the
+ * report, completes its MTU exchanges, data length updates and RSSI reads,
+ * moves the links to the PHY it asked for, unless they lack it, and
+ * confirms indications */
+static void load_link_updates(uint32_t clients)
+{
+    wiced_bt_management_evt_data_t mgmt;
+    wiced_bt_gatt_event_data_t evt;
+    wiced_bt_device_address_t bd_addr;
+    uint32_t client;
+    uint16_t mtu;
+
+    /* What the timers handed over to the GATT task, then the RSSI reads
+     * it starts, one at a time */
+    load_gatt_task();
+    while (host_bt_complete_rssi_read())
+    {
+        load_gatt_task();
+    }
+
+    for (client = 0; client < clients; client++)
+    {
+        load_client_addr(client, bd_addr);
+        memset(&mgmt, 0, sizeof(mgmt));
+        while (host_bt_take_conn_param_request(bd_addr, &mgmt.ble_connection_param_update))
+        {
+            load_management(BTM_BLE_CONNECTION_PARAM_UPDATE, &mgmt);
+            memset(&mgmt, 0, sizeof(mgmt));
+        }
+
+        if (host_bt_take_data_length_request(bd_addr, &mgmt.ble_data_length_update_event))
+        {
+            mgmt.ble_data_length_update_event.max_tx_octets =
+                MIN(mgmt.ble_data_length_update_event.max_tx_octets, load_client_octets);
+            load_management(BTM_BLE_DATA_LENGTH_UPDATE_EVENT, &mgmt);
+        }
+
+        if (host_bt_take_mtu_request((uint16_t)(LOAD_CONN_ID + client), &mtu))
+        {
+            load_mtu[client] = MIN(mtu, load_client_mtu);
+            memset(&evt, 0, sizeof(evt));
+            evt.operation_complete.conn_id = (uint16_t)(LOAD_CONN_ID + client);
+            evt.operation_complete.op = GATTC_OPTYPE_CONFIG_MTU;
+            evt.operation_complete.status = WICED_BT_GATT_SUCCESS;
+            evt.operation_complete.response_data.mtu = load_mtu[client];
+            host_bt_gatt_event(GATT_OPERATION_CPLT_EVT, &evt);
+            load_gatt_task();
+        }
+
+        memset(&mgmt, 0, sizeof(mgmt));
+        if (host_bt_take_phy_request(bd_addr, &mgmt.ble_phy_update_event))
+        {
+            if (load_no_coded &&
+                (WICED_BT_BLE_PHY_LE_CODED == mgmt.ble_phy_update_event.tx_phy))
+            {
+                mgmt.ble_phy_update_event.tx_phy = WICED_BT_BLE_PHY_1M;
+                mgmt.ble_phy_update_event.rx_phy = WICED_BT_BLE_PHY_1M;
+            }
+            load_management(BTM_BLE_PHY_UPDATE_EVT, &mgmt);
+        }
+
+        memset(&evt, 0, sizeof(evt));
+        if (host_bt_take_indication((uint16_t)(LOAD_CONN_ID + client),
+                                    &evt.attribute_request.data.confirm_handle))
+        {
+            evt.attribute_request.conn_id = (uint16_t)(LOAD_CONN_ID + client);
+            evt.attribute_request.opcode = GATT_HANDLE_VALUE_CONF;
+            host_bt_gatt_event(GATT_ATTRIBUTE_REQUEST_EVT, &evt);
+            load_gatt_task();
+        }
+    }
+}
+
+static void load_reconnect(uint32_t client)
+{
+    wiced_bt_ble_scan_results_t scan_result;
+
+    load_connection_event(client, WICED_FALSE);
+
+    /* The server connects back directly and scans if that takes too long.
+     * Advertise once the client is reachable, as the scan would see it. */
+    host_tick_advance(pdMS_TO_TICKS(load_reconnect_ms));
+    load_gatt_task();
+    memset(&scan_result, 0, sizeof(scan_result));
+    load_client_addr(client, scan_result.remote_bd_addr);
+    scan_result.ble_addr_type = BLE_ADDR_PUBLIC;
+    scan_result.rssi = load_client_rssi(client);
+    host_bt_scan_report(&scan_result,
+                        (0 == (client % 2u)) ? load_peer_adv : load_peer_adv_solicit);
+    load_gatt_task();
+
+    load_connection_event(client, WICED_TRUE);
+    load_encrypt(client);
+}
+
+static void load_send(uint32_t client, const load_request_t *p_req)
+{
+    wiced_bt_gatt_event_data_t evt;
+    uint8_t value[2];
+    uint64_t start;
+
+    memset(&evt, 0, sizeof(evt));
+    evt.attribute_request.conn_id = (uint16_t)(LOAD_CONN_ID + client);
+    evt.attribute_request.opcode = p_req->opcode;
+    evt.attribute_request.len_requested = (uint16_t)(load_mtu[client] - 1u);
+
+    switch (p_req->opcode)
+    {
+        case GATT_REQ_MTU:
+            evt.attribute_request.data.remote_mtu = load_client_mtu;
+            load_mtu[client] = MIN(load_client_mtu, CY_BT_MTU_SIZE);
+            break;
+
+        case GATT_REQ_READ:
+        case GATT_REQ_READ_BLOB:
+            evt.attribute_request.data.read_req.handle = p_req->handle;
+            evt.attribute_request.data.read_req.offset = p_req->offset;
+            break;
+
+        case GATT_REQ_READ_BY_TYPE:
+            evt.attribute_request.data.read_by_type.s_handle = p_req->handle;
+            evt.attribute_request.data.read_by_type.e_handle = 0xFFFF;
+            evt.attribute_request.data.read_by_type.uuid.len = LEN_UUID_16;
+            evt.attribute_request.data.read_by_type.uuid.uu.uuid16 = p_req->uuid16;
+            break;
+
+        case GATT_REQ_READ_MULTI:
+        case GATT_REQ_READ_MULTI_VAR_LENGTH:
+            evt.attribute_request.data.read_multiple_req.num_handles =
+                sizeof(load_multi_handles) / sizeof(uint16_t);
+            evt.attribute_request.data.read_multiple_req.p_handle_stream = load_multi_handles;
+            break;
+
+        case GATT_REQ_WRITE:
+        case GATT_CMD_WRITE:
+            value[0] = (uint8_t)(p_req->value & 0xFF);
+            value[1] = (uint8_t)(p_req->value >> 8);
+
+            /* With -j, every other client subscribes for indications */
+            if (load_indicate && (0 != (client & 1u)) &&
+                (HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG == p_req->handle) &&
+                (GATT_CLIENT_CONFIG_NOTIFICATION == p_req->value))
+            {
+                value[0] = (uint8_t)GATT_CLIENT_CONFIG_INDICATION;
+            }
+            evt.attribute_request.data.write_req.handle = p_req->handle;
+            evt.attribute_request.data.write_req.val_len = sizeof(value);
+            evt.attribute_request.data.write_req.p_val = value;
+            break;
+
+        case GATT_REQ_PREPARE_WRITE:
+            evt.attribute_request.data.write_req.handle = p_req->handle;
+            evt.attribute_request.data.write_req.offset = p_req->offset;
+            evt.attribute_request.data.write_req.val_len = p_req->value;
+            evt.attribute_request.data.write_req.p_val = &load_device_name[p_req->offset];
+            break;
+
+        case GATT_REQ_EXECUTE_WRITE:
+            evt.attribute_request.data.exec_write = (wiced_bt_gatt_exec_flag_t)p_req->value;
+            break;
+
+        default:
+            break;
+    }
+
+    start = host_time_ns();
+    host_bt_gatt_event(GATT_ATTRIBUTE_REQUEST_EVT, &evt);
+    load_record(p_req->opcode, host_time_ns() - start);
+    load_gatt_task();
+
+    /* Everything handed to the stack goes out before the next request */
+    host_bt_complete_tx();
+    load_gatt_task();
+}
+
+static void load_report(uint32_t requests, uint64_t elapsed_ns)
+{
+    host_heap_stats_t heap;
+    app_cts_sched_stats_t sched;
+    app_cts_time_stats_t time_stats;
+    app_log_stats_t log_stats;
+    app_scan_cache_stats_t scan_stats;
+    app_bt_reconnect_stats_t reconnect;
+    app_bt_bond_stats_t bond;
+    app_bt_conn_param_stats_t conn_param;
+    app_bt_mtu_stats_t mtu;
+    app_bt_phy_stats_t phy;
+    app_bt_prep_write_stats_t prep;
+    app_bt_notify_stats_t notify;
+    app_bt_gatt_task_stats_t gatt_task;
+    uint32_t slot;
+
+    printf("GATT load: %u requests in %.3f s -> %.0f requests/s\n\n", requests,
+           elapsed_ns / 1e9, requests / (elapsed_ns / 1e9));
+
+    printf("%-30s %9s %9s %9s %9s %9s %9s\n", "event", "count", "min(ns)", "p50(ns)",
+           "p99(ns)", "max(ns)", "mean(ns)");
+    for (slot = 0; slot < LOAD_SLOT_COUNT; slot++)
+    {
+        load_latency_t *p_lat = &load_latency[slot];
+        uint64_t sum = 0;
+        uint32_t i;
+
+        if (0 == p_lat->count)
+        {
+            continue;
+        }
+        qsort(p_lat->p_samples, p_lat->count, sizeof(uint64_t), load_cmp_u64);
+        for (i = 0; i < p_lat->count; i++)
+        {
+            sum += p_lat->p_samples[i];
+        }
+        printf("%-30s %9u %9llu %9llu %9llu %9llu %9llu\n", load_slot_name(slot), p_lat->count,
+               (unsigned long long)p_lat->p_samples[0],
+               (unsigned long long)p_lat->p_samples[p_lat->count / 2u],
+               (unsigned long long)p_lat->p_samples[(p_lat->count * 99u) / 100u],
+               (unsigned long long)p_lat->p_samples[p_lat->count - 1u],
+               (unsigned long long)(sum / p_lat->count));
+    }
+
+    printf("\nStack: read_rsp=%u read_by_type_rsp=%u read_multi_rsp=%u write_rsp=%u "
+           "prepare_write_rsp=%u execute_write_rsp=%u error_rsp=%u "
+           "mtu_rsp=%u notifications=%u tx_completed=%u tx_unhandled=%u le_connects=%u "
+           "cancel_connects=%u\n",
+           host_bt_stats.read_rsp, host_bt_stats.read_by_type_rsp, host_bt_stats.read_multi_rsp,
+           host_bt_stats.write_rsp, host_bt_stats.prepare_write_rsp,
+           host_bt_stats.execute_write_rsp, host_bt_stats.error_rsp, host_bt_stats.mtu_rsp, host_bt_stats.notifications,
+           host_bt_stats.tx_completed, host_bt_stats.tx_unhandled, host_bt_stats.le_connects,
+           host_bt_stats.cancel_connects);
+
+    host_heap_get_stats(&heap);
+    printf("Heap:  allocs=%u frees=%u failures=%u outstanding=%zu bytes peak=%zu bytes\n",
+           heap.allocs, heap.frees, heap.failures, heap.cur_bytes, heap.peak_bytes);
+    app_bt_pool_print_stats();
+
+    app_cts_sched_get_stats(&sched);
+    printf("Notify scheduler: ticks=%u late=%u polls=%u resyncs=%u\n", sched.ticks, sched.late,
+           sched.polls, sched.resyncs);
+
+    app_cts_time_get_stats(&time_stats);
+    printf("Time engine: updates=%u incremental=%u full=%u adjustments=%u synced=%u\n",
+           time_stats.updates, time_stats.incremental, time_stats.full,
+           time_stats.adjustments, time_stats.synced);
+
+    app_scan_cache_get_stats(&scan_stats);
+    printf("Scan cache: hits=%u misses=%u evictions=%u expired=%u entries=%u\n",
+           scan_stats.hits, scan_stats.misses, scan_stats.evictions, scan_stats.expired,
+           scan_stats.entries);
+
+    app_bt_reconnect_get_stats(&reconnect);
+    printf("Reconnect: attempts=%u direct=%u timeouts=%u failed=%u scanned=%u",
+           reconnect.attempts, reconnect.direct, reconnect.timeouts, reconnect.failed,
+           reconnect.scanned);
+    if (0 != (reconnect.direct + reconnect.scanned))
+    {
+        printf(" latency(ms) min=%u mean=%u max=%u", reconnect.latency_min_ms,
+               reconnect.latency_total_ms / (reconnect.direct + reconnect.scanned),
+               reconnect.latency_max_ms);
+    }
+    printf("\n");
+
+    app_bt_bond_get_stats(&bond);
+    printf("Bonding: bonds=%u saved=%u key_requests=%u key_misses=%u restored=%u replaced=%u "
+           "store_writes=%u store_errors=%u encryptions=%u\n", bond.bonds, bond.saved,
+           bond.key_requests, bond.key_misses, bond.restored, bond.replaced, bond.store_writes,
+           bond.store_errors, host_bt_stats.encryptions);
+
+    app_bt_conn_param_get_stats(&conn_param);
+    printf("Conn params: requests=%u to_fast=%u to_idle=%u deferred=%u granted=%u rejected=%u "
+           "fast_ms=%u idle_ms=%u peer_events=%u\n", conn_param.requests, conn_param.to_fast,
+           conn_param.to_idle, conn_param.deferred, conn_param.granted, conn_param.rejected,
+           conn_param.fast_ms, conn_param.idle_ms, conn_param.peer_events);
+
+    app_bt_mtu_get_stats(&mtu);
+    printf("MTU: mtu_requests=%u exchanges=%u dle_requests=%u dle_updates=%u payloads=%u "
+           "bytes=%u pdus=%u oversize=%u\n", mtu.mtu_requests, mtu.exchanges,
+           mtu.dle_requests, mtu.dle_updates, mtu.payloads, mtu.bytes, mtu.pdus,
+           host_bt_stats.oversize);
+    printf("LL PDUs per payload: 1=%u 2=%u 3=%u 4=%u 5+=%u\n", mtu.pdu_hist[0],
+           mtu.pdu_hist[1], mtu.pdu_hist[2], mtu.pdu_hist[3], mtu.pdu_hist[4]);
+
+    app_bt_phy_get_stats(&phy);
+    printf("PHY: rssi_reads=%u requests=%u updates=%u failed=%u declined=%u held=%u "
+           "ms 1M=%u 2M=%u coded=%u ended 1M=%u 2M=%u coded=%u\n", phy.rssi_reads,
+           phy.requests, phy.updates, phy.failed, phy.declined, phy.held, phy.ms[0], phy.ms[1],
+           phy.ms[2], phy.ended[0], phy.ended[1], phy.ended[2]);
+
+    app_bt_notify_get_stats(&notify);
+    printf("Notify: queued=%u coalesced=%u dropped=%u sent=%u transmitted=%u congested=%u "
+           "failed=%u depth=%u peak_depth=%u\n", notify.queued, notify.coalesced,
+           notify.dropped, notify.sent, notify.transmitted, notify.congested, notify.failed,
+           notify.depth, notify.peak_depth);
+    printf("Indicate: sent=%u confirmed=%u busy=%u rtt avg=%u max=%u ms\n", notify.indications,
+           notify.confirmed, host_bt_stats.indications_busy,
+           (0 != notify.confirmed) ? (notify.rtt_sum_ms / notify.confirmed) : 0u,
+           notify.rtt_max_ms);
+
+    app_bt_prep_write_get_stats(&prep);
+    printf("Queued writes: prepares=%u queue_full=%u invalid=%u executes=%u failed=%u "
+           "cancels=%u bytes=%u peak_used=%u\n", prep.prepares, prep.queue_full, prep.invalid,
+           prep.executes, prep.failed, prep.cancels, prep.bytes, prep.peak_used);
+
+    app_bt_gatt_task_get_stats(&gatt_task);
+    printf("GATT task: posted=%u processed=%u stale=%u queue_full=%u no_memory=%u "
+           "calls=%u calls_made=%u calls_lost=%u "
+           "peak_waiting=%u wait_max=%u callback avg=%llu max=%u cycles\n", gatt_task.posted,
+           gatt_task.processed, gatt_task.stale, gatt_task.queue_full, gatt_task.no_memory,
+           gatt_task.calls, gatt_task.calls_made, gatt_task.calls_lost, gatt_task.peak_waiting, gatt_task.wait_max_cycles,
+           (0 != gatt_task.callbacks) ?
+           (unsigned long long)(gatt_task.callback_cycles / gatt_task.callbacks) : 0ull,
+           gatt_task.callback_max_cycles);
+
+    app_log_get_stats(&log_stats);
+    printf("Log: written=%u dropped=%u drained=%u high_water=%u\n", log_stats.written,
+           log_stats.dropped, log_stats.drained, log_stats.high_water);
+    if (0 != cy_retarget_io_uart_obj.tx_bytes)
+    {
+        printf("Log UART: %u bytes, %.1f bytes/record\n", cy_retarget_io_uart_obj.tx_bytes,
+               (double)cy_retarget_io_uart_obj.tx_bytes / log_stats.drained);
+    }
+
+    printf("\n");
+    app_cpu_print();
+
+    printf("\n");
+    app_mem_print();
+
+    printf("\n");
+    app_latency_print();
+}
+
+int main(int argc, char *argv[])
+{
+    wiced_bt_management_evt_data_t mgmt;
+    uint32_t requests = LOAD_DEFAULT_REQUESTS;
+    uint32_t per_connection = LOAD_DEFAULT_PER_CONNECTION;
+    uint32_t clients = LOAD_DEFAULT_CLIENTS;
+    uint32_t ms_per_request = LOAD_DEFAULT_MS_PER_REQUEST;
+    uint32_t mix_len = sizeof(load_mix) / sizeof(load_mix[0]);
+    uint32_t client;
+    const char *p_uart_file = NULL;
+    FILE *p_uart = NULL;
+    int verbose = 0;
+    int saved_stdout = -1;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t idle;
+    uint32_t step;
+    uint32_t i;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "n:c:r:t:d:l:b:i:m:e:s:w:pjv")))
+    {
+        switch (opt)
+        {
+            case 'n':
+                requests = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'c':
+                clients = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                per_connection = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 't':
+                ms_per_request = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'd':
+                load_reconnect_ms = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'l':
+                p_uart_file = optarg;
+                break;
+            case 'b':
+                host_bond_store_set_path(optarg);
+                break;
+            case 'i':
+                load_idle_ms = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'm':
+                load_client_mtu = (uint16_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'e':
+                load_client_octets = (uint16_t)strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                load_rssi_step = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                load_no_coded = WICED_TRUE;
+                break;
+            case 'w':
+                host_bt_set_tx_credits((uint32_t)strtoul(optarg, NULL, 0));
+                break;
+            case 'j':
+                load_indicate = WICED_TRUE;
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n requests] [-c clients] "
+                        "[-r requests_per_connection] [-t ms_per_request] "
+                        "[-d reconnect_ms] [-l uart_file] [-b bond_file] [-i idle_ms] [-m mtu] "
+                        "[-e octets] [-s db] [-p] [-w credits] [-j] [-v]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if ((0 == clients) || (clients > LOAD_MAX_CLIENTS))
+    {
+        fprintf(stderr, "clients must be 1..%u\n", LOAD_MAX_CLIENTS);
+        return EXIT_FAILURE;
+    }
+    if ((load_client_mtu < GATT_DEF_BLE_MTU_SIZE) || (load_client_mtu > GATT_BLE_MAX_MTU_SIZE))
+    {
+        fprintf(stderr, "mtu must be %u..%u\n", GATT_DEF_BLE_MTU_SIZE, GATT_BLE_MAX_MTU_SIZE);
+        return EXIT_FAILURE;
+    }
+    if ((load_client_octets < APP_BT_CONN_DEF_TX_OCTETS) ||
+        (load_client_octets > APP_BT_MTU_LL_MAX_OCTETS))
+    {
+        fprintf(stderr, "octets must be %u..%u\n", APP_BT_CONN_DEF_TX_OCTETS,
+                APP_BT_MTU_LL_MAX_OCTETS);
+        return EXIT_FAILURE;
+    }
+
+    if (NULL != p_uart_file)
+    {
+        if (NULL == (p_uart = fopen(p_uart_file, "wb")))
+        {
+            perror(p_uart_file);
+            return EXIT_FAILURE;
+        }
+        host_uart_set_output(p_uart);
+    }
+
+    /* The application logs to stdout; park it on /dev/null during the run */
+    if (!verbose)
+    {
+        fflush(stdout);
+        saved_stdout = dup(STDOUT_FILENO);
+        dup2(open("/dev/null", O_WRONLY), STDOUT_FILENO);
+    }
+
+    memset(&mgmt, 0, sizeof(mgmt));
+    app_log_init();
+    app_cpu_init();
+    app_mem_init();
+    app_bt_bond_init(&app_bt_bond_default_store);
+
+    /* The stack asks for its identity keys and generates them if none are kept */
+    if (WICED_BT_SUCCESS != load_management(BTM_LOCAL_IDENTITY_KEYS_REQUEST_EVT, &mgmt))
+    {
+        memset(&mgmt, 0xA5, sizeof(mgmt));
+        load_management(BTM_LOCAL_IDENTITY_KEYS_UPDATE_EVT, &mgmt);
+    }
+
+    memset(&mgmt, 0, sizeof(mgmt));
+    mgmt.enabled.status = WICED_BT_SUCCESS;
+    load_management(BTM_ENABLED_EVT, &mgmt);
+    for (client = 0; client < clients; client++)
+    {
+        load_connection_event(client, WICED_TRUE);
+        load_encrypt(client);
+    }
+    load_link_updates(clients);
+
+    /* Each client walks through the mix; the clients take turns */
+    start = host_time_ns();
+    for (i = 0; i < requests; i++)
+    {
+        client = i % clients;
+        if ((0 != per_connection) && (i >= clients) &&
+            (0 == ((i / clients) % per_connection)))
+        {
+            load_reconnect(client);
+        }
+        load_send(client, &load_mix[(i / clients) % mix_len]);
+        host_tick_advance(pdMS_TO_TICKS(ms_per_request));
+
+        load_link_updates(clients);
+
+        /* All clients done with the mix: only notifications for a while.
+         * Updates are granted as time goes, as the controller would. */
+        if ((0 != load_idle_ms) && (client == (clients - 1u)) &&
+            (((i / clients) % mix_len) == (mix_len - 1u)))
+        {
+            for (idle = 0; idle < load_idle_ms; idle += step)
+            {
+                step = MIN(LOAD_IDLE_STEP_MS, load_idle_ms - idle);
+                host_tick_advance(pdMS_TO_TICKS(step));
+                load_link_updates(clients);
+            }
+        }
+
+        /* Outside the timed callback, as the tasks run on the target */
+        if (0 == (i % LOAD_LOG_DRAIN_REQUESTS))
+        {
+            load_log_task();
+        }
+        if (0 == (i % LOAD_CPU_SAMPLE_REQUESTS))
+        {
+            load_cpu_task();
+        }
+    }
+    elapsed = host_time_ns() - start;
+
+    for (client = 0; client < clients; client++)
+    {
+        load_connection_event(client, WICED_FALSE);
+    }
+    load_log_task();
+    load_cpu_task();
+    load_mem_report();
+
+    if (!verbose)
+    {
+        fflush(stdout);
+        dup2(saved_stdout, STDOUT_FILENO);
+        close(saved_stdout);
+    }
+
+    if (NULL != p_uart)
+    {
+        host_uart_set_output(NULL);
+        fclose(p_uart);
+    }
+
+    load_report(requests, elapsed);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,303 @@
+/******************************************************************************
+* File Name: log_decode.c
+*
+* Description: Decoder for the tokenized log. Turns the binary frames of an
+*              APP_LOG_TOKENIZED build back into text using the generated
+*              token database.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Usage: log_decode <app_log_tokens.db> [uart_file]
+ *   Decodes the UART output of a tokenized build (APP_LOG_TOKENIZED) read
+ *   from uart_file, or from stdin, and prints it as the text the application
+ *   logs in text mode. Bytes outside of log frames are console output and are
+ *   copied through unchanged. The database is generated from
+ *   app_log_events.h by scripts/gen_log_token_db.py.
+ *
+ * Exits with a failure status when a frame cannot be decoded.
+ */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "app_log.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define DECODE_MAX_TOKENS               (1024u)
+#define DECODE_LINE_LEN                 (512u)
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+typedef struct
+{
+    char           *p_fmt;              /* NULL for unused tokens */
+    uint8_t         nargs;
+    app_log_name_t  names;
+} decode_token_t;
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+static decode_token_t decode_tokens[DECODE_MAX_TOKENS];
+
+static const struct
+{
+    const char     *p_name;
+    app_log_name_t  names;
+} decode_name_tables[] =
+{
+    { "APP_LOG_NAME_NONE",           APP_LOG_NAME_NONE },
+    { "APP_LOG_NAME_BTM_EVENT",      APP_LOG_NAME_BTM_EVENT },
+    { "APP_LOG_NAME_GATT_STATUS",    APP_LOG_NAME_GATT_STATUS },
+    { "APP_LOG_NAME_DISCONN_REASON", APP_LOG_NAME_DISCONN_REASON },
+    { "APP_LOG_NAME_SMP_STATUS",     APP_LOG_NAME_SMP_STATUS },
+    { "APP_LOG_NAME_ADVERT_MODE",    APP_LOG_NAME_ADVERT_MODE },
+};
+
+/*******************************************************************************
+*        Function Definitions
+*******************************************************************************/
+/* Turns the C escapes of a format literal back into characters, in place */
+static void decode_unescape(char *p_str)
+{
+    char *p_out = p_str;
+
+    while ('\0' != *p_str)
+    {
+        char c = *p_str++;
+
+        if (('\\' == c) && ('\0' != *p_str))
+        {
+            c = *p_str++;
+            switch (c)
+            {
+                case 'n':  c = '\n'; break;
+                case 'r':  c = '\r'; break;
+                case 't':  c = '\t'; break;
+                default:   break;       /* \\ \" \' */
+            }
+        }
+        *p_out++ = c;
+    }
+    *p_out = '\0';
+}
+
+static int decode_load_db(const char *p_path)
+{
+    char line[DECODE_LINE_LEN];
+    unsigned int line_no = 0;
+    FILE *p_db = fopen(p_path, "r");
+
+    if (NULL == p_db)
+    {
+        perror(p_path);
+        return -1;
+    }
+    while (NULL != fgets(line, sizeof(line), p_db))
+    {
+        char *p_token = strtok(line, "\t");
+        char *p_nargs = strtok(NULL, "\t");
+        char *p_names = strtok(NULL, "\t");
+        char *p_fmt = strtok(NULL, "\n");
+        unsigned long token;
+        uint32_t i;
+
+        line_no++;
+        if ('#' == line[0])
+        {
+            continue;
+        }
+        if ((NULL == p_fmt) || ((token = strtoul(p_token, NULL, 0)) >= DECODE_MAX_TOKENS) ||
+            (strtoul(p_nargs, NULL, 0) > APP_LOG_MAX_ARGS))
+        {
+            fprintf(stderr, "%s:%u: malformed entry\n", p_path, line_no);
+            fclose(p_db);
+            return -1;
+        }
+
+        decode_unescape(p_fmt);
+        decode_tokens[token].p_fmt = strdup(p_fmt);
+        decode_tokens[token].nargs = (uint8_t)strtoul(p_nargs, NULL, 0);
+        decode_tokens[token].names = APP_LOG_NAME_NONE;
+        for (i = 0; i < sizeof(decode_name_tables) / sizeof(decode_name_tables[0]); i++)
+        {
+            if (0 == strcmp(p_names, decode_name_tables[i].p_name))
+            {
+                decode_tokens[token].names = decode_name_tables[i].names;
+            }
+        }
+    }
+    fclose(p_db);
+    return 0;
+}
+
+/* Reads an unsigned LEB128 varint; returns its length, or 0 if it is cut off
+ * or longer than a uint32_t allows */
+static size_t decode_varint(const uint8_t *p_buf, size_t avail, uint32_t *p_value)
+{
+    uint32_t value = 0;
+    size_t i;
+
+    for (i = 0; (i < avail) && (i < APP_LOG_VARINT_MAX_LEN); i++)
+    {
+        value |= (uint32_t)(p_buf[i] & 0x7Fu) << (7u * i);
+        if (0 == (p_buf[i] & 0x80u))
+        {
+            *p_value = value;
+            return i + 1u;
+        }
+    }
+    return 0;
+}
+
+/* Decodes the frame at p_buf[0]; returns its length, or 0 if it is invalid */
+static size_t decode_frame(const uint8_t *p_buf, size_t avail)
+{
+    const decode_token_t *p_token;
+    uint32_t args[APP_LOG_MAX_ARGS] = { 0 };
+    uint32_t timestamp;
+    uint32_t token;
+    size_t pos = 3u;
+    size_t len;
+    uint8_t i;
+
+    if (avail < pos)
+    {
+        return 0;
+    }
+    token = (uint32_t)p_buf[1] | ((uint32_t)p_buf[2] << 8);
+    if ((token >= DECODE_MAX_TOKENS) || (NULL == decode_tokens[token].p_fmt))
+    {
+        return 0;
+    }
+    p_token = &decode_tokens[token];
+
+    if (0 == (len = decode_varint(&p_buf[pos], avail - pos, &timestamp)))
+    {
+        return 0;
+    }
+    pos += len;
+    for (i = 0; i < p_token->nargs; i++)
+    {
+        if (0 == (len = decode_varint(&p_buf[pos], avail - pos, &args[i])))
+        {
+            return 0;
+        }
+        pos += len;
+    }
+
+    printf("[%6lu] ", (unsigned long)timestamp);
+    app_log_format(p_token->p_fmt, p_token->names, args, p_token->nargs);
+    return pos;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *p_in = stdin;
+    uint8_t *p_buf = NULL;
+    size_t size = 0;
+    size_t cap = 0;
+    size_t pos = 0;
+    size_t got;
+    uint32_t records = 0;
+    uint32_t errors = 0;
+
+    if ((argc < 2) || (argc > 3))
+    {
+        fprintf(stderr, "usage: %s <app_log_tokens.db> [uart_file]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (0 != decode_load_db(argv[1]))
+    {
+        return EXIT_FAILURE;
+    }
+    if ((3 == argc) && (NULL == (p_in = fopen(argv[2], "rb"))))
+    {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    /* Logs are small; decode from memory so a frame never straddles a read */
+    for (;;)
+    {
+        if (size == cap)
+        {
+            cap = (0 == cap) ? 65536u : (cap * 2u);
+            if (NULL == (p_buf = realloc(p_buf, cap)))
+            {
+                fprintf(stderr, "out of memory\n");
+                return EXIT_FAILURE;
+            }
+        }
+        got = fread(&p_buf[size], 1, cap - size, p_in);
+        if (0 == got)
+        {
+            break;
+        }
+        size += got;
+    }
+
+    while (pos < size)
+    {
+        size_t len;
+
+        if (APP_LOG_FRAME_SYNC != p_buf[pos])
+        {
+            putchar(p_buf[pos++]);
+        }
+        else if (0 != (len = decode_frame(&p_buf[pos], size - pos)))
+        {
+            records++;
+            pos += len;
+        }
+        else
+        {
+            /* Skip the sync byte and look for the next frame */
+            errors++;
+            pos++;
+        }
+    }
+
+    fprintf(stderr, "log_decode: %u records, %u errors\n", records, errors);
+    free(p_buf);
+    return (0 == errors) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
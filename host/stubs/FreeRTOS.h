@@ -0,0 +1,122 @@
+/******************************************************************************
+* File Name: FreeRTOS.h
+*
+* Description: Host stand-in for FreeRTOS.h used by the host build. Declares
+*              only what the application uses.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <assert.h>
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+/* Values mirror configs/COMPONENT_CM4/FreeRTOSConfig.h */
+#define configMAX_PRIORITIES            7
+#define configMINIMAL_STACK_SIZE        128
+#define configTICK_RATE_HZ              ((TickType_t)1000)
+#define configTOTAL_HEAP_SIZE           10240
+#define configASSERT(x)                 assert(x)
+#define configTIMER_TASK_PRIORITY       3
+#define configMAX_TASK_NAME_LEN         16
+#define configRUN_TIME_COUNTER_TYPE     uint32_t
+#define configTIMER_TASK_STACK_DEPTH    (configMINIMAL_STACK_SIZE * 4)
+
+/* The stand-in heap is a fixed-size heap with statistics, as heap_4 */
+#define HEAP_ALLOCATION_TYPE3           (3)
+#define HEAP_ALLOCATION_TYPE4           (4)
+#define HEAP_ALLOCATION_TYPE5           (5)
+#define configHEAP_ALLOCATION_SCHEME    (HEAP_ALLOCATION_TYPE4)
+
+#define pdFALSE                         ((BaseType_t)0)
+#define pdTRUE                          ((BaseType_t)1)
+#define pdPASS                          (pdTRUE)
+#define pdFAIL                          (pdFALSE)
+#define portMAX_DELAY                   ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(((TickType_t)(ms) * configTICK_RATE_HZ) / 1000U))
+
+/* The host build is single threaded; critical sections are no-ops */
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+#define taskENTER_CRITICAL_FROM_ISR()   (0u)
+#define taskEXIT_CRITICAL_FROM_ISR(x)   ((void)(x))
+#define portYIELD_FROM_ISR(x)           ((void)(x))
+#define xPortIsInsideInterrupt()        (pdFALSE)
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+typedef long          BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t      TickType_t;
+typedef uint16_t      configSTACK_DEPTH_TYPE;
+typedef uint32_t      StackType_t;
+
+typedef struct
+{
+    size_t xAvailableHeapSpaceInBytes;
+    size_t xSizeOfLargestFreeBlockInBytes;
+    size_t xSizeOfSmallestFreeBlockInBytes;
+    size_t xNumberOfFreeBlocks;
+    size_t xMinimumEverFreeBytesRemaining;
+    size_t xNumberOfSuccessfulAllocations;
+    size_t xNumberOfSuccessfulFrees;
+} HeapStats_t;
+
+/*******************************************************************************
+*        Function Prototypes
+*******************************************************************************/
+void *pvPortMalloc(size_t xSize);
+void vPortFree(void *pv);
+size_t xPortGetFreeHeapSize(void);
+size_t xPortGetMinimumEverFreeHeapSize(void);
+void vPortGetHeapStats(HeapStats_t *pxHeapStats);
+
+/* traceTASK_SWITCHED_IN() of the target's FreeRTOSConfig.h */
+void app_cpu_switched_in(uint32_t task_number);
+/* traceMALLOC() and traceFREE() of the target's FreeRTOSConfig.h */
+void app_mem_malloc(void *p_block, size_t size);
+void app_mem_free(void *p_block);
+
+#endif /* INC_FREERTOS_H */
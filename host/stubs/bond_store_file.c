@@ -0,0 +1,157 @@
+/******************************************************************************
+* File Name: bond_store_file.c
+*
+* Description: Host stand-in for the flash key store of the bonding module,
+*              backed by a file.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Host key store of the bonding module. Slots live in memory and, when a path
+ * is set, in a file of APP_BT_BOND_SLOT_COUNT fixed-size slots that is read
+ * at init and rewritten slot by slot, so bonds survive from one run to the
+ * next like they survive a reset on the target. */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "host_stub.h"
+#include "app_bt_bond.h"
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+typedef struct
+{
+    uint32_t len;       /* 0 when the slot is empty */
+    uint8_t  data[APP_BT_BOND_SLOT_SIZE];
+} host_bond_slot_t;
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+static host_bond_slot_t host_bond_slots[APP_BT_BOND_SLOT_COUNT];
+static const char      *host_bond_path;
+
+/*******************************************************************************
+*        Function Definitions
+*******************************************************************************/
+void host_bond_store_set_path(const char *p_path)
+{
+    host_bond_path = p_path;
+}
+
+static wiced_result_t host_bond_store_flush(uint8_t slot)
+{
+    FILE *p_file;
+    size_t written;
+
+    if (NULL == host_bond_path)
+    {
+        return WICED_BT_SUCCESS;
+    }
+    if ((NULL == (p_file = fopen(host_bond_path, "r+b"))) &&
+        (NULL == (p_file = fopen(host_bond_path, "w+b"))))
+    {
+        return WICED_BT_ERROR;
+    }
+    fseek(p_file, (long)(slot * sizeof(host_bond_slot_t)), SEEK_SET);
+    written = fwrite(&host_bond_slots[slot], sizeof(host_bond_slot_t), 1, p_file);
+    fclose(p_file);
+    return (1 == written) ? WICED_BT_SUCCESS : WICED_BT_ERROR;
+}
+
+static wiced_result_t host_bond_store_init(void)
+{
+    FILE *p_file;
+    size_t slots;
+
+    memset(host_bond_slots, 0, sizeof(host_bond_slots));
+    if ((NULL == host_bond_path) || (NULL == (p_file = fopen(host_bond_path, "rb"))))
+    {
+        /* Nothing kept yet */
+        return WICED_BT_SUCCESS;
+    }
+    slots = fread(host_bond_slots, sizeof(host_bond_slot_t), APP_BT_BOND_SLOT_COUNT, p_file);
+    fclose(p_file);
+
+    /* A short file is a store written with fewer slots; the rest are empty */
+    while (slots < APP_BT_BOND_SLOT_COUNT)
+    {
+        memset(&host_bond_slots[slots++], 0, sizeof(host_bond_slot_t));
+    }
+    return WICED_BT_SUCCESS;
+}
+
+static wiced_result_t host_bond_store_read(uint8_t slot, void *p_data, uint32_t len)
+{
+    if ((slot >= APP_BT_BOND_SLOT_COUNT) || (len != host_bond_slots[slot].len))
+    {
+        return WICED_BT_ERROR;
+    }
+    memcpy(p_data, host_bond_slots[slot].data, len);
+    return WICED_BT_SUCCESS;
+}
+
+static wiced_result_t host_bond_store_write(uint8_t slot, const void *p_data, uint32_t len)
+{
+    if ((slot >= APP_BT_BOND_SLOT_COUNT) || (len > APP_BT_BOND_SLOT_SIZE))
+    {
+        return WICED_BT_BADARG;
+    }
+    host_bond_slots[slot].len = len;
+    memcpy(host_bond_slots[slot].data, p_data, len);
+    return host_bond_store_flush(slot);
+}
+
+static wiced_result_t host_bond_store_erase(uint8_t slot)
+{
+    if (slot >= APP_BT_BOND_SLOT_COUNT)
+    {
+        return WICED_BT_BADARG;
+    }
+    memset(&host_bond_slots[slot], 0, sizeof(host_bond_slot_t));
+    return host_bond_store_flush(slot);
+}
+
+const app_bt_bond_store_t app_bt_bond_default_store =
+{
+    .init  = host_bond_store_init,
+    .read  = host_bond_store_read,
+    .write = host_bond_store_write,
+    .erase = host_bond_store_erase,
+};
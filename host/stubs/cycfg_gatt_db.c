@@ -0,0 +1,124 @@
+/******************************************************************************
+* File Name: cycfg_gatt_db.c
+*
+* Description: Host stand-in for the Bluetooth Configurator output generated
+*              from design.cybt.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include "cycfg_gatt_db.h"
+#include "wiced_bt_gatt.h"
+
+/*******************************************************************************
+*        GATT Database
+*******************************************************************************/
+const uint8_t gatt_database[] =
+{
+    /* Primary Service: Generic Access */
+    PRIMARY_SERVICE_UUID16 (HDLS_GAP, __UUID_SERVICE_GENERIC_ACCESS),
+        /* Characteristic: Device Name */
+        CHARACTERISTIC_UUID16 (HDLC_GAP_DEVICE_NAME, HDLC_GAP_DEVICE_NAME_VALUE,
+            __UUID_CHARACTERISTIC_DEVICE_NAME,
+            GATTDB_CHAR_PROP_READ,
+            GATTDB_PERM_READABLE),
+        /* Characteristic: Appearance */
+        CHARACTERISTIC_UUID16 (HDLC_GAP_APPEARANCE, HDLC_GAP_APPEARANCE_VALUE,
+            __UUID_CHARACTERISTIC_APPEARANCE,
+            GATTDB_CHAR_PROP_READ,
+            GATTDB_PERM_READABLE),
+
+    /* Primary Service: Generic Attribute */
+    PRIMARY_SERVICE_UUID16 (HDLS_GATT, __UUID_SERVICE_GENERIC_ATTRIBUTE),
+
+    /* Primary Service: Current Time */
+    PRIMARY_SERVICE_UUID16 (HDLS_CTS, __UUID_SERVICE_CURRENT_TIME),
+        /* Characteristic: Current Time */
+        CHARACTERISTIC_UUID16 (HDLC_CTS_CURRENT_TIME, HDLC_CTS_CURRENT_TIME_VALUE,
+            __UUID_CHARACTERISTIC_CURRENT_TIME,
+            GATTDB_CHAR_PROP_READ | GATTDB_CHAR_PROP_WRITE | GATTDB_CHAR_PROP_NOTIFY | GATTDB_CHAR_PROP_INDICATE,
+            GATTDB_PERM_READABLE | GATTDB_PERM_WRITE_REQ),
+            /* Descriptor: Client Characteristic Configuration */
+            CHAR_DESCRIPTOR_UUID16_WRITABLE (HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG,
+                __UUID_DESCRIPTOR_CLIENT_CHARACTERISTIC_CONFIGURATION,
+                GATTDB_PERM_READABLE | GATTDB_PERM_WRITE_REQ),
+        /* Characteristic: Local Time Information */
+        CHARACTERISTIC_UUID16_WRITABLE (HDLC_CTS_LOCAL_TIME_INFORMATION, HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE,
+            __UUID_CHARACTERISTIC_LOCAL_TIME_INFORMATION,
+            GATTDB_CHAR_PROP_READ | GATTDB_CHAR_PROP_WRITE,
+            GATTDB_PERM_READABLE | GATTDB_PERM_WRITE_REQ),
+};
+
+/* Length of the GATT database */
+const uint16_t gatt_database_len = sizeof(gatt_database);
+
+/*******************************************************************************
+*        Attribute Initial Values
+*******************************************************************************/
+uint8_t app_gap_device_name[]                     = {'C', 'T', 'S', ' ', 'S', 'e', 'r', 'v', 'e', 'r', '\0', };
+uint8_t app_gap_appearance[]                      = {0x00u, 0x01u, };
+uint8_t app_cts_current_time[]                    = {0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, };
+uint8_t app_cts_current_time_client_char_config[] = {0x00u, 0x00u, };
+uint8_t app_cts_local_time_information[]          = {0x00u, 0x00u, };
+
+/*******************************************************************************
+*        Attribute Lengths
+*******************************************************************************/
+const uint16_t app_gap_device_name_len                     = 10;
+const uint16_t app_gap_appearance_len                      = (uint16_t)(sizeof(app_gap_appearance));
+const uint16_t app_cts_current_time_len                    = (uint16_t)(sizeof(app_cts_current_time));
+const uint16_t app_cts_current_time_client_char_config_len = (uint16_t)(sizeof(app_cts_current_time_client_char_config));
+const uint16_t app_cts_local_time_information_len          = (uint16_t)(sizeof(app_cts_local_time_information));
+
+/*******************************************************************************
+*        GATT Lookup Table
+*******************************************************************************/
+/* GATT attribute lookup table                                */
+/* This table is used by the application to handle attributes */
+gatt_db_lookup_table_t app_gatt_db_ext_attr_tbl[] =
+{
+    /* { attribute handle,                       maxlen, curlen, attribute data } */
+    { HDLC_GAP_DEVICE_NAME_VALUE,                10,     10,     app_gap_device_name },
+    { HDLC_GAP_APPEARANCE_VALUE,                 2,      2,      app_gap_appearance },
+    { HDLC_CTS_CURRENT_TIME_VALUE,               10,     10,     app_cts_current_time },
+    { HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG,  2,      2,      app_cts_current_time_client_char_config },
+    { HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE,     2,      2,      app_cts_local_time_information },
+};
+
+/* Number of Lookup Table entries */
+const uint16_t app_gatt_db_ext_attr_tbl_size = (sizeof(app_gatt_db_ext_attr_tbl) / sizeof(gatt_db_lookup_table_t));
@@ -0,0 +1,114 @@
+/******************************************************************************
+* File Name: cycfg_gatt_db.h
+*
+* Description: Host stand-in for the Bluetooth Configurator output generated
+*              from design.cybt.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef CYCFG_GATT_DB_H
+#define CYCFG_GATT_DB_H
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include "stdint.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define __UUID_SERVICE_GENERIC_ACCESS                               0x1800
+#define __UUID_CHARACTERISTIC_DEVICE_NAME                           0x2A00
+#define __UUID_CHARACTERISTIC_APPEARANCE                            0x2A01
+#define __UUID_SERVICE_GENERIC_ATTRIBUTE                            0x1801
+#define __UUID_SERVICE_CURRENT_TIME                                 0x1805
+#define __UUID_CHARACTERISTIC_CURRENT_TIME                          0x2A2B
+#define __UUID_CHARACTERISTIC_LOCAL_TIME_INFORMATION                0x2A0F
+#define __UUID_DESCRIPTOR_CLIENT_CHARACTERISTIC_CONFIGURATION       0x2902
+
+/* Service Generic Access */
+#define HDLS_GAP                                                    0x0001
+/* Characteristic Device Name */
+#define HDLC_GAP_DEVICE_NAME                                        0x0002
+#define HDLC_GAP_DEVICE_NAME_VALUE                                  0x0003
+/* Characteristic Appearance */
+#define HDLC_GAP_APPEARANCE                                         0x0004
+#define HDLC_GAP_APPEARANCE_VALUE                                   0x0005
+
+/* Service Generic Attribute */
+#define HDLS_GATT                                                   0x0006
+
+/* Service Current Time */
+#define HDLS_CTS                                                    0x0007
+/* Characteristic Current Time */
+#define HDLC_CTS_CURRENT_TIME                                       0x0008
+#define HDLC_CTS_CURRENT_TIME_VALUE                                 0x0009
+/* Descriptor Client Characteristic Configuration */
+#define HDLD_CTS_CURRENT_TIME_CLIENT_CHAR_CONFIG                    0x000A
+/* Characteristic Local Time Information */
+#define HDLC_CTS_LOCAL_TIME_INFORMATION                             0x000B
+#define HDLC_CTS_LOCAL_TIME_INFORMATION_VALUE                       0x000C
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+typedef struct
+{
+    uint16_t handle;
+    uint16_t max_len;
+    uint16_t cur_len;
+    uint8_t  *p_data;
+} gatt_db_lookup_table_t;
+
+/*******************************************************************************
+*        Extern Variables
+*******************************************************************************/
+extern const uint8_t  gatt_database[];
+extern const uint16_t gatt_database_len;
+extern gatt_db_lookup_table_t app_gatt_db_ext_attr_tbl[];
+extern const uint16_t app_gatt_db_ext_attr_tbl_size;
+extern uint8_t app_gap_device_name[];
+extern uint8_t app_gap_appearance[];
+extern uint8_t app_cts_current_time[];
+extern uint8_t app_cts_current_time_client_char_config[];
+extern uint8_t app_cts_local_time_information[];
+extern const uint16_t app_gap_device_name_len;
+extern const uint16_t app_gap_appearance_len;
+extern const uint16_t app_cts_current_time_len;
+extern const uint16_t app_cts_current_time_client_char_config_len;
+extern const uint16_t app_cts_local_time_information_len;
+
+#endif /* CYCFG_GATT_DB_H */
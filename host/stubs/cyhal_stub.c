@@ -0,0 +1,172 @@
+/******************************************************************************
+* File Name: cyhal_stub.c
+*
+* Description: Host stand-in for the HAL GPIO and RTC drivers.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Host stand-in for the HAL GPIO and RTC drivers. The RTC runs off the
+ * FreeRTOS stand-in tick so that time advances deterministically with
+ * host_tick_advance(). */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <time.h>
+#include "host_stub.h"
+#include "task.h"
+#include "cy_retarget_io.h"
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+static cyhal_gpio_callback_data_t *host_gpio_cb;
+static time_t                     host_rtc_base;
+static TickType_t                 host_rtc_base_tick;
+static FILE                       *host_uart_out;
+static DWT_Type                   host_dwt_regs;
+
+cyhal_uart_t cy_retarget_io_uart_obj;
+CoreDebug_Type host_core_debug;
+
+/*******************************************************************************
+*        GPIO
+*******************************************************************************/
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                          cyhal_gpio_drive_mode_t drive_mode, bool init_val)
+{
+    (void)pin;
+    (void)direction;
+    (void)drive_mode;
+    (void)init_val;
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_gpio_register_callback(cyhal_gpio_t pin, cyhal_gpio_callback_data_t *callback_data)
+{
+    (void)pin;
+    host_gpio_cb = callback_data;
+}
+
+void cyhal_gpio_enable_event(cyhal_gpio_t pin, cyhal_gpio_event_t event,
+                             uint8_t intr_priority, bool enable)
+{
+    (void)pin;
+    (void)event;
+    (void)intr_priority;
+    (void)enable;
+}
+
+void host_gpio_fire(cyhal_gpio_t pin, cyhal_gpio_event_t event)
+{
+    (void)pin;
+    if ((NULL != host_gpio_cb) && (NULL != host_gpio_cb->callback))
+    {
+        host_gpio_cb->callback(host_gpio_cb->callback_arg, event);
+    }
+}
+
+/*******************************************************************************
+*        RTC
+*******************************************************************************/
+cy_rslt_t cyhal_rtc_init(cyhal_rtc_t *obj)
+{
+    (void)obj;
+    if (0 == host_rtc_base)
+    {
+        host_rtc_set(time(NULL));
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_rtc_read(cyhal_rtc_t *obj, struct tm *time)
+{
+    time_t now = host_rtc_base +
+                 (time_t)((xTaskGetTickCount() - host_rtc_base_tick) / configTICK_RATE_HZ);
+
+    (void)obj;
+    gmtime_r(&now, time);
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_rtc_write(cyhal_rtc_t *obj, const struct tm *time)
+{
+    struct tm copy = *time;
+
+    (void)obj;
+    host_rtc_set(timegm(&copy));
+    return CY_RSLT_SUCCESS;
+}
+
+void host_rtc_set(time_t epoch)
+{
+    host_rtc_base = epoch;
+    host_rtc_base_tick = xTaskGetTickCount();
+}
+
+/*******************************************************************************
+*        UART
+*******************************************************************************/
+cy_rslt_t cyhal_uart_putc(cyhal_uart_t *obj, uint32_t value)
+{
+    obj->tx_bytes++;
+    fputc((int)(value & 0xFFu), (NULL != host_uart_out) ? host_uart_out : stdout);
+    return CY_RSLT_SUCCESS;
+}
+
+void host_uart_set_output(FILE *p_file)
+{
+    host_uart_out = p_file;
+}
+
+/*******************************************************************************
+*        Host Clock
+*******************************************************************************/
+uint64_t host_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ull) + (uint64_t)ts.tv_nsec;
+}
+
+DWT_Type *host_dwt(void)
+{
+    host_dwt_regs.CYCCNT = (uint32_t)host_time_ns();
+    return &host_dwt_regs;
+}
@@ -0,0 +1,564 @@
+/******************************************************************************
+* File Name: freertos_stub.c
+*
+* Description: Host stand-in for the FreeRTOS kernel services used by the
+*              application.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Host stand-in for the FreeRTOS kernel services used by the application.
+ * The host build is single threaded: tasks are recorded but never run, the
+ * tick only advances when the driver calls host_tick_advance(), and software
+ * timers fire from inside that call. The heap enforces configTOTAL_HEAP_SIZE
+ * so allocation failures show up as they would on the target. Run time is
+ * charged to the task the driver says it is standing in for
+ * (host_task_switch()), to the timer task while timers fire, and to the idle
+ * task otherwise. The work of a task runs on the host's own stack, so every
+ * task stack reads as never used. */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "host_stub.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define HOST_MAX_TASKS                  (16u)
+#define HOST_MAX_TIMERS                 (16u)
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+struct host_task
+{
+    TaskFunction_t code;
+    const char     *name;
+    UBaseType_t    priority;
+    uint32_t       stack_depth;
+    uint32_t       notify_count;
+    UBaseType_t    number;
+    uint32_t       run_time;
+};
+
+struct host_queue
+{
+    uint8_t     *p_storage;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;
+    UBaseType_t count;
+};
+
+struct host_timer
+{
+    const char              *name;
+    TickType_t              period;
+    TickType_t              expiry;
+    UBaseType_t             auto_reload;
+    BaseType_t              active;
+    void                    *id;
+    TimerCallbackFunction_t callback;
+};
+
+typedef struct
+{
+    size_t size;
+    size_t pad;
+} host_heap_hdr_t;
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+static struct host_task  host_tasks[HOST_MAX_TASKS];
+static uint32_t          host_task_count;
+static struct host_timer host_timers[HOST_MAX_TIMERS];
+static uint32_t          host_timer_count;
+static TickType_t        host_ticks;
+static host_heap_stats_t host_heap;
+static struct host_task  *host_task_running;
+static uint64_t          host_task_since;
+static TaskHandle_t      host_idle_task;
+static TaskHandle_t      host_timer_task;
+
+/*******************************************************************************
+*        Heap
+*******************************************************************************/
+/* Counted by app_mem.c when the application is linked in */
+__attribute__((weak)) void app_mem_malloc(void *p_block, size_t size)
+{
+    (void)p_block;
+    (void)size;
+}
+
+__attribute__((weak)) void app_mem_free(void *p_block)
+{
+    (void)p_block;
+}
+
+void *pvPortMalloc(size_t xSize)
+{
+    host_heap_hdr_t *p_hdr;
+
+    if ((host_heap.cur_bytes + xSize) > configTOTAL_HEAP_SIZE)
+    {
+        host_heap.failures++;
+        app_mem_malloc(NULL, xSize);
+        return NULL;
+    }
+    p_hdr = malloc(sizeof(host_heap_hdr_t) + xSize);
+    if (NULL == p_hdr)
+    {
+        host_heap.failures++;
+        app_mem_malloc(NULL, xSize);
+        return NULL;
+    }
+    p_hdr->size = xSize;
+    host_heap.cur_bytes += xSize;
+    host_heap.allocs++;
+    if (host_heap.cur_bytes > host_heap.peak_bytes)
+    {
+        host_heap.peak_bytes = host_heap.cur_bytes;
+    }
+    app_mem_malloc(p_hdr + 1, xSize);
+    return p_hdr + 1;
+}
+
+void vPortFree(void *pv)
+{
+    host_heap_hdr_t *p_hdr;
+
+    if (NULL == pv)
+    {
+        return;
+    }
+    p_hdr = ((host_heap_hdr_t *)pv) - 1;
+    host_heap.cur_bytes -= p_hdr->size;
+    host_heap.frees++;
+    free(p_hdr);
+    app_mem_free(pv);
+}
+
+size_t xPortGetFreeHeapSize(void)
+{
+    return configTOTAL_HEAP_SIZE - host_heap.cur_bytes;
+}
+
+size_t xPortGetMinimumEverFreeHeapSize(void)
+{
+    return configTOTAL_HEAP_SIZE - host_heap.peak_bytes;
+}
+
+/* The stand-in heap does not fragment: its free space is one block */
+void vPortGetHeapStats(HeapStats_t *pxHeapStats)
+{
+    memset(pxHeapStats, 0, sizeof(*pxHeapStats));
+    pxHeapStats->xAvailableHeapSpaceInBytes = xPortGetFreeHeapSize();
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = pxHeapStats->xAvailableHeapSpaceInBytes;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = pxHeapStats->xAvailableHeapSpaceInBytes;
+    pxHeapStats->xNumberOfFreeBlocks = (0 != pxHeapStats->xAvailableHeapSpaceInBytes) ? 1u : 0u;
+    pxHeapStats->xMinimumEverFreeBytesRemaining = xPortGetMinimumEverFreeHeapSize();
+    pxHeapStats->xNumberOfSuccessfulAllocations = host_heap.allocs;
+    pxHeapStats->xNumberOfSuccessfulFrees = host_heap.frees;
+}
+
+void host_heap_get_stats(host_heap_stats_t *p_stats)
+{
+    *p_stats = host_heap;
+}
+
+/*******************************************************************************
+*        Tasks
+*******************************************************************************/
+/* Counted by app_cpu.c when the application is linked in */
+__attribute__((weak)) void app_cpu_switched_in(uint32_t task_number)
+{
+    (void)task_number;
+}
+
+/* The kernel's own tasks exist from the start, as after vTaskStartScheduler() */
+static void host_tasks_start(void)
+{
+    if (NULL != host_idle_task)
+    {
+        return;
+    }
+    host_task_count = 0;
+    host_tasks[host_task_count].name = "IDLE";
+    host_tasks[host_task_count].stack_depth = configMINIMAL_STACK_SIZE;
+    host_tasks[host_task_count].number = host_task_count + 1u;
+    host_idle_task = &host_tasks[host_task_count++];
+    host_tasks[host_task_count].name = "Tmr Svc";
+    host_tasks[host_task_count].priority = configTIMER_TASK_PRIORITY;
+    host_tasks[host_task_count].stack_depth = configTIMER_TASK_STACK_DEPTH;
+    host_tasks[host_task_count].number = host_task_count + 1u;
+    host_timer_task = &host_tasks[host_task_count++];
+    host_task_running = host_idle_task;
+    host_task_since = host_time_ns();
+}
+
+TaskHandle_t host_task_switch(TaskHandle_t task)
+{
+    struct host_task *p_prev;
+    uint64_t now;
+
+    host_tasks_start();
+    p_prev = host_task_running;
+    if ((NULL == task) || (task == p_prev))
+    {
+        return p_prev;
+    }
+    now = host_time_ns();
+    p_prev->run_time += (uint32_t)(now - host_task_since);
+    host_task_since = now;
+    host_task_running = task;
+    app_cpu_switched_in((uint32_t)task->number);
+    return p_prev;
+}
+
+TaskHandle_t host_task_find(const char *p_name)
+{
+    uint32_t i;
+
+    for (i = 0; i < host_task_count; i++)
+    {
+        if (0 == strcmp(host_tasks[i].name, p_name))
+        {
+            return &host_tasks[i];
+        }
+    }
+    return NULL;
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *const pxTaskStatusArray,
+                                 const UBaseType_t uxArraySize,
+                                 configRUN_TIME_COUNTER_TYPE *const pulTotalRunTime)
+{
+    uint32_t i;
+
+    host_tasks_start();
+    if (uxArraySize < host_task_count)
+    {
+        return 0;
+    }
+    for (i = 0; i < host_task_count; i++)
+    {
+        struct host_task *p_task = &host_tasks[i];
+
+        memset(&pxTaskStatusArray[i], 0, sizeof(TaskStatus_t));
+        pxTaskStatusArray[i].xHandle = p_task;
+        pxTaskStatusArray[i].pcTaskName = p_task->name;
+        pxTaskStatusArray[i].xTaskNumber = p_task->number;
+        pxTaskStatusArray[i].eCurrentState = (p_task == host_task_running) ? eRunning : eBlocked;
+        pxTaskStatusArray[i].uxCurrentPriority = p_task->priority;
+        pxTaskStatusArray[i].uxBasePriority = p_task->priority;
+        pxTaskStatusArray[i].ulRunTimeCounter = p_task->run_time;
+        pxTaskStatusArray[i].usStackHighWaterMark = (configSTACK_DEPTH_TYPE)p_task->stack_depth;
+    }
+    if (NULL != pulTotalRunTime)
+    {
+        *pulTotalRunTime = (configRUN_TIME_COUNTER_TYPE)host_time_ns();
+    }
+    return host_task_count;
+}
+
+TaskHandle_t xTaskGetIdleTaskHandle(void)
+{
+    host_tasks_start();
+    return host_idle_task;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t pxTaskCode, const char *const pcName,
+                       const configSTACK_DEPTH_TYPE usStackDepth, void *const pvParameters,
+                       UBaseType_t uxPriority, TaskHandle_t *const pxCreatedTask)
+{
+    struct host_task *p_task;
+
+    (void)pvParameters;
+    host_tasks_start();
+    if (host_task_count >= HOST_MAX_TASKS)
+    {
+        return pdFAIL;
+    }
+    p_task = &host_tasks[host_task_count++];
+    p_task->code = pxTaskCode;
+    p_task->name = pcName;
+    p_task->priority = uxPriority;
+    p_task->stack_depth = usStackDepth;
+    p_task->number = host_task_count;
+    if (NULL != pxCreatedTask)
+    {
+        *pxCreatedTask = p_task;
+    }
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+    (void)xClearCountOnExit;
+    (void)xTicksToWait;
+    return 0;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    if (NULL != xTaskToNotify)
+    {
+        xTaskToNotify->notify_count++;
+    }
+    if (NULL != pxHigherPriorityTaskWoken)
+    {
+        *pxHigherPriorityTaskWoken = pdTRUE;
+    }
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify)
+{
+    vTaskNotifyGiveFromISR(xTaskToNotify, NULL);
+    return pdPASS;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return host_ticks;
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return host_ticks;
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay)
+{
+    host_tick_advance(xTicksToDelay);
+}
+
+void vTaskStartScheduler(void)
+{
+}
+
+/*******************************************************************************
+*        Queues
+*******************************************************************************/
+/* Queue and storage come from the heap in one block, as with the kernel */
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize)
+{
+    size_t storage = (size_t)uxQueueLength * uxItemSize;
+    struct host_queue *p_queue = pvPortMalloc(sizeof(struct host_queue) + storage);
+
+    if (NULL == p_queue)
+    {
+        return NULL;
+    }
+    memset(p_queue, 0, sizeof(struct host_queue) + storage);
+    p_queue->p_storage = (uint8_t *)(p_queue + 1);
+    p_queue->length = uxQueueLength;
+    p_queue->item_size = uxItemSize;
+    return p_queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait)
+{
+    UBaseType_t tail;
+
+    (void)xTicksToWait;
+    if (xQueue->count == xQueue->length)
+    {
+        return pdFAIL;
+    }
+    tail = (xQueue->head + xQueue->count) % xQueue->length;
+    memcpy(&xQueue->p_storage[tail * xQueue->item_size], pvItemToQueue, xQueue->item_size);
+    xQueue->count++;
+    return pdPASS;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t xQueue, const void *pvItemToQueue,
+                             BaseType_t *pxHigherPriorityTaskWoken)
+{
+    if (NULL != pxHigherPriorityTaskWoken)
+    {
+        *pxHigherPriorityTaskWoken = pdFALSE;
+    }
+    return xQueueSend(xQueue, pvItemToQueue, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait)
+{
+    (void)xTicksToWait;
+    if (0 == xQueue->count)
+    {
+        return pdFAIL;
+    }
+    memcpy(pvBuffer, &xQueue->p_storage[xQueue->head * xQueue->item_size], xQueue->item_size);
+    xQueue->head = (xQueue->head + 1) % xQueue->length;
+    xQueue->count--;
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t xQueue)
+{
+    return xQueue->count;
+}
+
+/*******************************************************************************
+*        Semaphores
+*******************************************************************************/
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+
+    if (NULL != mutex)
+    {
+        mutex->count = 1;
+    }
+    return mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+    (void)xBlockTime;
+
+    /* Taken twice: a task would wait for itself forever */
+    configASSERT(0 != xSemaphore->count);
+    xSemaphore->count = 0;
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+    if (0 != xSemaphore->count)
+    {
+        return pdFAIL;
+    }
+    xSemaphore->count = 1;
+    return pdPASS;
+}
+
+/*******************************************************************************
+*        Software Timers
+*******************************************************************************/
+TimerHandle_t xTimerCreate(const char *const pcTimerName, const TickType_t xTimerPeriodInTicks,
+                           const UBaseType_t uxAutoReload, void *const pvTimerID,
+                           TimerCallbackFunction_t pxCallbackFunction)
+{
+    struct host_timer *p_timer;
+
+    if ((host_timer_count >= HOST_MAX_TIMERS) || (0 == xTimerPeriodInTicks))
+    {
+        return NULL;
+    }
+    p_timer = &host_timers[host_timer_count++];
+    p_timer->name = pcTimerName;
+    p_timer->period = xTimerPeriodInTicks;
+    p_timer->auto_reload = uxAutoReload;
+    p_timer->id = pvTimerID;
+    p_timer->callback = pxCallbackFunction;
+    p_timer->active = pdFALSE;
+    return p_timer;
+}
+
+BaseType_t xTimerStart(TimerHandle_t xTimer, TickType_t xTicksToWait)
+{
+    (void)xTicksToWait;
+    xTimer->expiry = host_ticks + xTimer->period;
+    xTimer->active = pdTRUE;
+    return pdPASS;
+}
+
+BaseType_t xTimerStop(TimerHandle_t xTimer, TickType_t xTicksToWait)
+{
+    (void)xTicksToWait;
+    xTimer->active = pdFALSE;
+    return pdPASS;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t xTimer, TickType_t xNewPeriod,
+                              TickType_t xTicksToWait)
+{
+    if (0 == xNewPeriod)
+    {
+        return pdFAIL;
+    }
+    xTimer->period = xNewPeriod;
+    return xTimerStart(xTimer, xTicksToWait);
+}
+
+BaseType_t xTimerIsTimerActive(TimerHandle_t xTimer)
+{
+    return xTimer->active;
+}
+
+void *pvTimerGetTimerID(const TimerHandle_t xTimer)
+{
+    return xTimer->id;
+}
+
+void host_tick_advance(TickType_t ticks)
+{
+    TaskHandle_t prev;
+    uint32_t i;
+
+    /* Step one tick at a time so timers fire in order and on their tick */
+    while (ticks-- > 0)
+    {
+        host_ticks++;
+        for (i = 0; i < host_timer_count; i++)
+        {
+            struct host_timer *p_timer = &host_timers[i];
+
+            if ((pdTRUE == p_timer->active) && (p_timer->expiry == host_ticks))
+            {
+                if (p_timer->auto_reload)
+                {
+                    p_timer->expiry = host_ticks + p_timer->period;
+                }
+                else
+                {
+                    p_timer->active = pdFALSE;
+                }
+                prev = host_task_switch(host_timer_task);
+                p_timer->callback(p_timer);
+                host_task_switch(prev);
+            }
+        }
+    }
+}
@@ -0,0 +1,177 @@
+/******************************************************************************
+* File Name: host_stub.h
+*
+* Description: Control and inspection hooks into the host stand-ins for the
+*              Bluetooth stack, HAL and FreeRTOS.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef HOST_STUB_H
+#define HOST_STUB_H
+
+/* Only the host tools include this header */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <time.h>
+#include "wiced_bt_stack.h"
+#include "cyhal.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+/* What the application handed to the stand-in Bluetooth stack */
+typedef struct
+{
+    uint32_t read_rsp;
+    uint32_t read_by_type_rsp;
+    uint32_t read_multi_rsp;
+    uint32_t write_rsp;
+    uint32_t prepare_write_rsp;
+    uint32_t execute_write_rsp;
+    uint32_t mtu_rsp;
+    uint32_t error_rsp;
+    uint32_t notifications;
+    uint32_t congested;
+    uint32_t indications;
+    uint32_t indications_busy;
+    uint32_t scan_starts;
+    uint32_t scan_stops;
+    uint32_t le_connects;
+    uint32_t cancel_connects;
+    uint32_t encryptions;
+    uint32_t conn_param_requests;
+    uint32_t mtu_requests;
+    uint32_t dle_requests;
+    uint32_t phy_requests;
+    uint32_t rssi_reads;
+    uint32_t oversize;          /* ATT PDUs longer than the link's MTU */
+    uint32_t tx_completed;
+    uint32_t tx_unhandled;
+} host_bt_stats_t;
+
+/* Last response the application sent to an attribute request: its opcode,
+ * the status of an Error Response (success for any other) and the value of
+ * a Read Response. Also used for the last notification or indication. */
+typedef struct
+{
+    wiced_bt_gatt_opcode_t opcode;
+    wiced_bt_gatt_status_t status;
+    uint16_t               len;
+    uint8_t                value[GATT_BLE_MAX_MTU_SIZE];
+} host_bt_rsp_t;
+
+typedef struct
+{
+    size_t   cur_bytes;
+    size_t   peak_bytes;
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t failures;
+} host_heap_stats_t;
+
+/*******************************************************************************
+*        Extern Variables
+*******************************************************************************/
+extern host_bt_stats_t host_bt_stats;
+extern host_bt_rsp_t   host_bt_last_rsp;
+extern host_bt_rsp_t   host_bt_last_value;
+
+/*******************************************************************************
+*        Function Prototypes
+*******************************************************************************/
+/* Bluetooth stack */
+wiced_bt_gatt_status_t host_bt_gatt_event(wiced_bt_gatt_evt_t event,
+                                          wiced_bt_gatt_event_data_t *p_event_data);
+uint32_t host_bt_complete_tx(void);
+void host_bt_set_tx_credits(uint32_t credits);
+/* WICED_TRUE once per indication the application sent to conn_id, with
+ * its handle, for the driver to confirm */
+wiced_bool_t host_bt_take_indication(uint16_t conn_id, uint16_t *p_handle);
+void host_bt_scan_report(wiced_bt_ble_scan_results_t *p_scan_result, uint8_t *p_adv_data);
+wiced_bool_t host_bt_is_scanning(void);
+/* WICED_TRUE once if the application asked to encrypt the link to bd_addr */
+wiced_bool_t host_bt_take_encryption_request(wiced_bt_device_address_t bd_addr);
+/* WICED_TRUE once per connection parameter update the application asked
+ * for; fills in the event that reports it as granted */
+wiced_bool_t host_bt_take_conn_param_request(wiced_bt_device_address_t bd_addr,
+                                             wiced_bt_ble_connection_param_update_t *p_update);
+/* WICED_TRUE once per MTU exchange the application started; gives the MTU
+ * it asked for */
+wiced_bool_t host_bt_take_mtu_request(uint16_t conn_id, uint16_t *p_mtu);
+/* WICED_TRUE once per data length update the application asked for; fills
+ * in the event that reports it as done */
+wiced_bool_t host_bt_take_data_length_request(wiced_bt_device_address_t bd_addr,
+                                              wiced_bt_ble_data_length_update_t *p_update);
+/* RSSI the controller reports for the link to bd_addr from now on */
+void host_bt_set_rssi(wiced_bt_device_address_t bd_addr, int8_t rssi);
+/* Completes the RSSI read the application started; WICED_FALSE if none */
+wiced_bool_t host_bt_complete_rssi_read(void);
+/* WICED_TRUE once per PHY update the application asked for; fills in the
+ * event that reports the preferred PHY as in use */
+wiced_bool_t host_bt_take_phy_request(wiced_bt_device_address_t bd_addr,
+                                      wiced_bt_ble_phy_update_t *p_update);
+/* Task the stand-in stack delivers its callbacks in */
+TaskHandle_t host_bt_task(void);
+
+/* Bond store: file that keeps the bonds over runs; in memory only when NULL */
+void host_bond_store_set_path(const char *p_path);
+
+/* FreeRTOS */
+void host_heap_get_stats(host_heap_stats_t *p_stats);
+void host_tick_advance(TickType_t ticks);
+/* Charges the host time since the last switch to the task that ran and
+ * makes task the running one; returns the task that ran. The driver calls
+ * this around the work it does in place of a task. NULL keeps the running
+ * task. */
+TaskHandle_t host_task_switch(TaskHandle_t task);
+/* Task created with this name, or NULL */
+TaskHandle_t host_task_find(const char *p_name);
+
+/* HAL */
+void host_rtc_set(time_t epoch);
+void host_gpio_fire(cyhal_gpio_t pin, cyhal_gpio_event_t event);
+/* Where raw UART bytes go; stdout when NULL */
+void host_uart_set_output(FILE *p_file);
+
+/* Monotonic host clock in nanoseconds, used for latency measurement */
+uint64_t host_time_ns(void);
+
+#endif /* HOST_STUB_H */
@@ -0,0 +1,200 @@
+/******************************************************************************
+* File Name: wiced_bt_ble.h
+*
+* Description: Host stand-in for wiced_bt_ble.h used by the host build.
+*              Declares only what the application uses.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef WICED_BT_BLE_H
+#define WICED_BT_BLE_H
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include "wiced_bt_types.h"
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+typedef uint8_t wiced_bt_ble_address_type_t;
+#define BLE_ADDR_PUBLIC                 0x00
+#define BLE_ADDR_RANDOM                 0x01
+#define BLE_ADDR_PUBLIC_ID              0x02
+#define BLE_ADDR_RANDOM_ID              0x03
+
+typedef enum
+{
+    BTM_BLE_SCAN_TYPE_NONE,
+    BTM_BLE_SCAN_TYPE_HIGH_DUTY,
+    BTM_BLE_SCAN_TYPE_LOW_DUTY
+} wiced_bt_ble_scan_type_t;
+
+typedef enum
+{
+    BTM_BLE_ADVERT_OFF,
+    BTM_BLE_ADVERT_DIRECTED_HIGH,
+    BTM_BLE_ADVERT_DIRECTED_LOW,
+    BTM_BLE_ADVERT_UNDIRECTED_HIGH,
+    BTM_BLE_ADVERT_UNDIRECTED_LOW,
+    BTM_BLE_ADVERT_NONCONN_HIGH,
+    BTM_BLE_ADVERT_NONCONN_LOW,
+    BTM_BLE_ADVERT_DISCOVERABLE_HIGH,
+    BTM_BLE_ADVERT_DISCOVERABLE_LOW
+} wiced_bt_ble_advert_mode_t;
+
+typedef enum
+{
+    BTM_BLE_ADVERT_TYPE_FLAG                = 0x01,
+    BTM_BLE_ADVERT_TYPE_16SRV_PARTIAL       = 0x02,
+    BTM_BLE_ADVERT_TYPE_16SRV_COMPLETE      = 0x03,
+    BTM_BLE_ADVERT_TYPE_32SRV_PARTIAL       = 0x04,
+    BTM_BLE_ADVERT_TYPE_32SRV_COMPLETE      = 0x05,
+    BTM_BLE_ADVERT_TYPE_128SRV_PARTIAL      = 0x06,
+    BTM_BLE_ADVERT_TYPE_128SRV_COMPLETE     = 0x07,
+    BTM_BLE_ADVERT_TYPE_NAME_SHORT          = 0x08,
+    BTM_BLE_ADVERT_TYPE_NAME_COMPLETE       = 0x09,
+    BTM_BLE_ADVERT_TYPE_TX_POWER            = 0x0A,
+    BTM_BLE_ADVERT_TYPE_APPEARANCE          = 0x19,
+    BTM_BLE_ADVERT_TYPE_MANUFACTURER        = 0xFF
+} wiced_bt_ble_advert_type_t;
+
+typedef enum
+{
+    BLE_CONN_MODE_OFF,
+    BLE_CONN_MODE_LOW_DUTY,
+    BLE_CONN_MODE_HIGH_DUTY
+} wiced_bt_ble_conn_mode_t;
+
+typedef uint8_t wiced_bt_dev_ble_evt_type_t;
+
+typedef struct
+{
+    wiced_bt_device_address_t   remote_bd_addr;
+    wiced_bt_ble_address_type_t ble_addr_type;
+    wiced_bt_dev_ble_evt_type_t ble_evt_type;
+    int8_t                      rssi;
+    uint8_t                     flag;
+} wiced_bt_ble_scan_results_t;
+
+/* BTM_BLE_CONNECTION_PARAM_UPDATE */
+typedef struct
+{
+    uint8_t                   status;
+    wiced_bt_device_address_t bd_addr;
+    uint16_t                  conn_interval;
+    uint16_t                  conn_latency;
+    uint16_t                  supervision_timeout;
+} wiced_bt_ble_connection_param_update_t;
+
+#define HCI_ROLE_CENTRAL                0x00
+#define HCI_ROLE_PERIPHERAL             0x01
+
+/* BTM_BLE_DATA_LENGTH_UPDATE_EVENT */
+typedef struct
+{
+    wiced_bt_device_address_t bd_address;
+    uint16_t                  max_tx_octets;
+    uint16_t                  max_tx_time;
+    uint16_t                  max_rx_octets;
+    uint16_t                  max_rx_time;
+} wiced_bt_ble_data_length_update_t;
+
+/* PHY preferences for wiced_bt_ble_set_phy */
+typedef uint8_t wiced_bt_ble_host_phy_preferences_t;
+#define BTM_BLE_PREFER_1M_PHY           0x01
+#define BTM_BLE_PREFER_2M_PHY           0x02
+#define BTM_BLE_PREFER_LELR_PHY         0x04
+
+typedef uint16_t wiced_bt_ble_lecoded_phy_preferences_t;
+#define BTM_BLE_PREFER_NO_LELR          0x0000
+#define BTM_BLE_PREFER_LELR_S2          0x0001
+#define BTM_BLE_PREFER_LELR_S8          0x0002
+
+typedef struct
+{
+    wiced_bt_device_address_t              remote_bd_addr;
+    wiced_bt_ble_host_phy_preferences_t    tx_phys;
+    wiced_bt_ble_host_phy_preferences_t    rx_phys;
+    wiced_bt_ble_lecoded_phy_preferences_t phy_opts;
+} wiced_bt_ble_phy_preferences_t;
+
+/* PHY in use on a link */
+typedef uint8_t wiced_bt_ble_phy_t;
+#define WICED_BT_BLE_PHY_1M             0x01
+#define WICED_BT_BLE_PHY_2M             0x02
+#define WICED_BT_BLE_PHY_LE_CODED       0x03
+
+/* BTM_BLE_PHY_UPDATE_EVT */
+typedef struct
+{
+    uint8_t                   status;
+    wiced_bt_device_address_t bd_address;
+    wiced_bt_ble_phy_t        tx_phy;
+    wiced_bt_ble_phy_t        rx_phy;
+} wiced_bt_ble_phy_update_t;
+
+typedef struct
+{
+    uint8_t  role;
+    uint16_t conn_interval;
+    uint16_t conn_latency;
+    uint16_t supervision_timeout;
+} wiced_bt_ble_conn_params_t;
+
+typedef void (wiced_bt_ble_scan_result_cback_t)(wiced_bt_ble_scan_results_t *p_scan_result,
+                                                uint8_t *p_adv_data);
+
+/*******************************************************************************
+*        Function Prototypes
+*******************************************************************************/
+wiced_result_t wiced_bt_ble_scan(wiced_bt_ble_scan_type_t scan_type,
+                                 wiced_bool_t duplicate_filter_enable,
+                                 wiced_bt_ble_scan_result_cback_t *p_scan_result_cback);
+
+uint8_t *wiced_bt_ble_check_advertising_data(uint8_t *p_adv,
+                                             wiced_bt_ble_advert_type_t type,
+                                             uint8_t *p_length);
+
+wiced_result_t wiced_bt_ble_set_data_packet_length(wiced_bt_device_address_t remote_bda,
+                                                  uint16_t tx_pdu_length, uint16_t tx_time);
+
+wiced_result_t wiced_bt_ble_get_connection_parameters(wiced_bt_device_address_t remote_bda,
+                                                      wiced_bt_ble_conn_params_t *p_conn_parameters);
+
+wiced_result_t wiced_bt_ble_set_phy(wiced_bt_ble_phy_preferences_t *phy_preferences);
+
+#endif /* WICED_BT_BLE_H */
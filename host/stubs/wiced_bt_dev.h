@@ -0,0 +1,272 @@
+/******************************************************************************
+* File Name: wiced_bt_dev.h
+*
+* Description: Host stand-in for wiced_bt_dev.h used by the host build.
+*              Declares only what the application uses.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef WICED_BT_DEV_H
+#define WICED_BT_DEV_H
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include "wiced_bt_types.h"
+#include "wiced_bt_ble.h"
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+typedef enum
+{
+    BTM_ENABLED_EVT,
+    BTM_DISABLED_EVT,
+    BTM_POWER_MANAGEMENT_STATUS_EVT,
+    BTM_PIN_REQUEST_EVT,
+    BTM_USER_CONFIRMATION_REQUEST_EVT,
+    BTM_PASSKEY_NOTIFICATION_EVT,
+    BTM_PASSKEY_REQUEST_EVT,
+    BTM_KEYPRESS_NOTIFICATION_EVT,
+    BTM_PAIRING_IO_CAPABILITIES_BR_EDR_REQUEST_EVT,
+    BTM_PAIRING_IO_CAPABILITIES_BR_EDR_RESPONSE_EVT,
+    BTM_PAIRING_IO_CAPABILITIES_BLE_REQUEST_EVT,
+    BTM_PAIRING_COMPLETE_EVT,
+    BTM_ENCRYPTION_STATUS_EVT,
+    BTM_SECURITY_REQUEST_EVT,
+    BTM_SECURITY_FAILED_EVT,
+    BTM_SECURITY_ABORTED_EVT,
+    BTM_READ_LOCAL_OOB_DATA_COMPLETE_EVT,
+    BTM_REMOTE_OOB_DATA_REQUEST_EVT,
+    BTM_PAIRED_DEVICE_LINK_KEYS_UPDATE_EVT,
+    BTM_PAIRED_DEVICE_LINK_KEYS_REQUEST_EVT,
+    BTM_LOCAL_IDENTITY_KEYS_UPDATE_EVT,
+    BTM_LOCAL_IDENTITY_KEYS_REQUEST_EVT,
+    BTM_BLE_SCAN_STATE_CHANGED_EVT,
+    BTM_BLE_ADVERT_STATE_CHANGED_EVT,
+    BTM_SMP_REMOTE_OOB_DATA_REQUEST_EVT,
+    BTM_SMP_SC_REMOTE_OOB_DATA_REQUEST_EVT,
+    BTM_SMP_SC_LOCAL_OOB_DATA_NOTIFICATION_EVT,
+    BTM_SCO_CONNECTED_EVT,
+    BTM_SCO_DISCONNECTED_EVT,
+    BTM_SCO_CONNECTION_REQUEST_EVT,
+    BTM_SCO_CONNECTION_CHANGE_EVT,
+    BTM_BLE_CONNECTION_PARAM_UPDATE,
+    BTM_BLE_DATA_LENGTH_UPDATE_EVENT,
+    BTM_BLE_PHY_UPDATE_EVT,
+} wiced_bt_management_evt_t;
+
+typedef uint8_t wiced_bt_smp_status_t;
+enum
+{
+    SMP_SUCCESS                 = 0,
+    SMP_PASSKEY_ENTRY_FAIL      = 0x01,
+    SMP_OOB_FAIL                = 0x02,
+    SMP_PAIR_AUTH_FAIL          = 0x03,
+    SMP_CONFIRM_VALUE_ERR       = 0x04,
+    SMP_PAIR_NOT_SUPPORT        = 0x05,
+    SMP_ENC_KEY_SIZE            = 0x06,
+    SMP_INVALID_CMD             = 0x07,
+    SMP_PAIR_FAIL_UNKNOWN       = 0x08,
+    SMP_REPEATED_ATTEMPTS       = 0x09,
+    SMP_INVALID_PARAMETERS      = 0x0A,
+    SMP_DHKEY_CHK_FAIL          = 0x0B,
+    SMP_NUMERIC_COMPAR_FAIL     = 0x0C,
+    SMP_BR_PAIRING_IN_PROGR     = 0x0D,
+    SMP_XTRANS_DERIVE_NOT_ALLOW = 0x0E,
+    SMP_PAIR_INTERNAL_ERR       = 0x0F,
+    SMP_UNKNOWN_IO_CAP          = 0x10,
+    SMP_INIT_FAIL               = 0x11,
+    SMP_CONFIRM_FAIL            = 0x12,
+    SMP_BUSY                    = 0x13,
+    SMP_ENC_FAIL                = 0x14,
+    SMP_STARTED                 = 0x15,
+    SMP_RSP_TIMEOUT             = 0x16,
+    SMP_FAIL                    = 0x17,
+    SMP_CONN_TOUT               = 0x18,
+};
+
+typedef struct
+{
+    wiced_result_t status;
+} wiced_bt_dev_enabled_t;
+
+/* Key material is opaque to the application; only the sizes matter here */
+#define BTM_SECURITY_KEY_DATA_LEN       (132u)
+#define BTM_SECURITY_LOCAL_KEY_DATA_LEN (65u)
+
+typedef struct
+{
+    uint8_t data[BTM_SECURITY_KEY_DATA_LEN];
+} wiced_bt_device_sec_keys_t;
+
+typedef struct
+{
+    wiced_bt_device_address_t  bd_addr;
+    wiced_bt_device_sec_keys_t key_data;
+} wiced_bt_device_link_keys_t;
+
+typedef struct
+{
+    uint8_t local_key_data[BTM_SECURITY_LOCAL_KEY_DATA_LEN];
+} wiced_bt_local_identity_keys_t;
+
+typedef uint8_t wiced_bt_dev_io_cap_t;
+#define BTM_IO_CAPABILITIES_DISPLAY_ONLY        0
+#define BTM_IO_CAPABILITIES_DISPLAY_AND_YES_NO_INPUT 1
+#define BTM_IO_CAPABILITIES_KEYBOARD_ONLY       2
+#define BTM_IO_CAPABILITIES_NONE                3
+
+typedef uint8_t wiced_bt_dev_oob_data_t;
+#define BTM_OOB_NONE                    0
+
+typedef uint8_t wiced_bt_dev_le_auth_req_t;
+#define BTM_LE_AUTH_REQ_NO_BOND         0x00
+#define BTM_LE_AUTH_REQ_BOND            0x01
+#define BTM_LE_AUTH_REQ_MITM            0x04
+#define BTM_LE_AUTH_REQ_SC_ONLY         0x08
+#define BTM_LE_AUTH_REQ_SC_BOND         (BTM_LE_AUTH_REQ_SC_ONLY | BTM_LE_AUTH_REQ_BOND)
+
+typedef uint8_t wiced_bt_dev_le_key_type_t;
+#define BTM_LE_KEY_PENC                 (1 << 0)
+#define BTM_LE_KEY_PID                  (1 << 1)
+#define BTM_LE_KEY_PCSRK                (1 << 2)
+#define BTM_LE_KEY_PLK                  (1 << 3)
+#define BTM_LE_KEY_LENC                 (1 << 4)
+#define BTM_LE_KEY_LID                  (1 << 5)
+#define BTM_LE_KEY_LCSRK                (1 << 6)
+#define BTM_LE_KEY_LLK                  (1 << 7)
+
+typedef uint8_t wiced_bt_ble_sec_action_type_t;
+#define BTM_BLE_SEC_NONE                0
+#define BTM_BLE_SEC_ENCRYPT             1
+#define BTM_BLE_SEC_ENCRYPT_NO_MITM     2
+#define BTM_BLE_SEC_ENCRYPT_MITM        3
+
+typedef struct
+{
+    wiced_bt_device_address_t  bd_addr;
+    wiced_bt_dev_io_cap_t      local_io_cap;
+    wiced_bt_dev_oob_data_t    oob_data;
+    wiced_bt_dev_le_auth_req_t auth_req;
+    uint8_t                    max_key_size;
+    wiced_bt_dev_le_key_type_t init_keys;
+    wiced_bt_dev_le_key_type_t resp_keys;
+} wiced_bt_dev_ble_io_caps_req_t;
+
+typedef struct
+{
+    wiced_result_t            status;
+    uint8_t                   reason;
+    uint8_t                   sec_level;
+    wiced_bool_t              is_pair_cancel;
+    wiced_bt_device_address_t resolved_bd_addr;
+    uint8_t                   resolved_bd_addr_type;
+} wiced_bt_dev_ble_pairing_info_t;
+
+typedef union
+{
+    wiced_bt_dev_ble_pairing_info_t ble;
+} wiced_bt_dev_pairing_info_t;
+
+typedef struct
+{
+    uint8_t                     *bd_addr;
+    wiced_bt_transport_t        transport;
+    wiced_bt_dev_pairing_info_t pairing_complete_info;
+    wiced_bt_ble_address_type_t bd_addr_type;
+} wiced_bt_dev_pairing_cplt_t;
+
+typedef struct
+{
+    uint8_t              *bd_addr;
+    wiced_bt_transport_t transport;
+    void                 *p_ref_data;
+    wiced_result_t       result;
+} wiced_bt_dev_encryption_status_t;
+
+typedef struct
+{
+    wiced_bt_device_address_t bd_addr;
+} wiced_bt_dev_security_request_t;
+
+typedef union
+{
+    wiced_bt_dev_enabled_t           enabled;
+    wiced_bt_dev_ble_io_caps_req_t   pairing_io_capabilities_ble_request;
+    wiced_bt_dev_pairing_cplt_t      pairing_complete;
+    wiced_bt_dev_encryption_status_t encryption_status;
+    wiced_bt_dev_security_request_t  security_request;
+    wiced_bt_device_link_keys_t      paired_device_link_keys_update;
+    wiced_bt_device_link_keys_t      paired_device_link_keys_request;
+    wiced_bt_local_identity_keys_t   local_identity_keys_update;
+    wiced_bt_local_identity_keys_t   local_identity_keys_request;
+    wiced_bt_ble_scan_type_t         ble_scan_state_changed;
+    wiced_bt_ble_advert_mode_t       ble_advert_state_changed;
+    wiced_bt_ble_connection_param_update_t ble_connection_param_update;
+    wiced_bt_ble_data_length_update_t      ble_data_length_update_event;
+    wiced_bt_ble_phy_update_t              ble_phy_update_event;
+} wiced_bt_management_evt_data_t;
+
+/* Result of wiced_bt_dev_read_rssi */
+typedef struct
+{
+    wiced_result_t            status;
+    uint8_t                   hci_status;
+    int8_t                    rssi;
+    wiced_bt_device_address_t rem_bda;
+} wiced_bt_dev_rssi_result_t;
+
+typedef void (wiced_bt_dev_cmpl_cback_t)(void *p_data);
+
+typedef wiced_result_t (wiced_bt_management_cback_t)(wiced_bt_management_evt_t event,
+                                                     wiced_bt_management_evt_data_t *p_event_data);
+
+/*******************************************************************************
+*        Function Prototypes
+*******************************************************************************/
+void wiced_bt_dev_read_local_addr(wiced_bt_device_address_t bd_addr);
+void wiced_bt_set_pairable_mode(uint8_t allow_pairing, uint8_t connect_only_paired);
+void wiced_bt_ble_security_grant(wiced_bt_device_address_t bd_addr, uint8_t res);
+wiced_result_t wiced_bt_dev_set_encryption(wiced_bt_device_address_t bd_addr,
+                                           wiced_bt_transport_t transport, void *p_ref_data);
+wiced_result_t wiced_bt_dev_add_device_to_address_resolution_db(
+    wiced_bt_device_link_keys_t *p_link_keys);
+wiced_result_t wiced_bt_dev_read_rssi(wiced_bt_device_address_t remote_bda,
+                                      wiced_bt_transport_t transport,
+                                      wiced_bt_dev_cmpl_cback_t *p_cback);
+
+#endif /* WICED_BT_DEV_H */
@@ -0,0 +1,413 @@
+/******************************************************************************
+* File Name: wiced_bt_gatt.h
+*
+* Description: Host stand-in for wiced_bt_gatt.h used by the host build.
+*              Declares only what the application uses.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef WICED_BT_GATT_H
+#define WICED_BT_GATT_H
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include "wiced_bt_types.h"
+#include "wiced_bt_ble.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+/* Attribute type UUIDs */
+#define GATT_UUID_PRI_SERVICE               0x2800
+#define GATT_UUID_SEC_SERVICE               0x2801
+#define GATT_UUID_INCLUDE_SERVICE           0x2802
+#define GATT_UUID_CHAR_DECLARE              0x2803
+#define GATT_UUID_CHAR_CLIENT_CONFIG        0x2902
+
+#define GATT_CLIENT_CONFIG_NONE             0x0000
+#define GATT_CLIENT_CONFIG_NOTIFICATION     0x0001
+#define GATT_CLIENT_CONFIG_INDICATION       0x0002
+
+#define GATT_DEF_BLE_MTU_SIZE               23
+#define GATT_BLE_MAX_MTU_SIZE               517
+
+/* Characteristic properties */
+#define GATTDB_CHAR_PROP_BROADCAST          (0x1 << 0)
+#define GATTDB_CHAR_PROP_READ               (0x1 << 1)
+#define GATTDB_CHAR_PROP_WRITE_NO_RESPONSE  (0x1 << 2)
+#define GATTDB_CHAR_PROP_WRITE              (0x1 << 3)
+#define GATTDB_CHAR_PROP_NOTIFY             (0x1 << 4)
+#define GATTDB_CHAR_PROP_INDICATE           (0x1 << 5)
+
+/* Attribute permissions */
+#define GATTDB_PERM_NONE                    (0x00)
+#define GATTDB_PERM_VARIABLE_LENGTH         (0x1 << 0)
+#define GATTDB_PERM_READABLE                (0x1 << 1)
+#define GATTDB_PERM_WRITE_CMD               (0x1 << 2)
+#define GATTDB_PERM_WRITE_REQ               (0x1 << 3)
+#define GATTDB_PERM_AUTH_READABLE           (0x1 << 4)
+#define GATTDB_PERM_RELIABLE_WRITE          (0x1 << 5)
+#define GATTDB_PERM_AUTH_WRITABLE           (0x1 << 6)
+
+/* GATT database entry encoders. The host stand-in uses a flat layout of
+ * handle(2) perm(1) len(1) type-uuid(2) value(len - 2) per attribute; the
+ * values of characteristic value and descriptor attributes live in the
+ * application's external attribute table. */
+#define HOST_GATTDB_U16(v)                  (uint8_t)((v) & 0xFF), (uint8_t)(((v) >> 8) & 0xFF)
+
+#define PRIMARY_SERVICE_UUID16(handle, service) \
+    HOST_GATTDB_U16(handle), GATTDB_PERM_READABLE, 4, \
+    HOST_GATTDB_U16(GATT_UUID_PRI_SERVICE), HOST_GATTDB_U16(service)
+
+#define CHARACTERISTIC_UUID16(handle, handle_value, uuid, properties, permission) \
+    HOST_GATTDB_U16(handle), GATTDB_PERM_READABLE, 7, \
+    HOST_GATTDB_U16(GATT_UUID_CHAR_DECLARE), (properties), \
+    HOST_GATTDB_U16(handle_value), HOST_GATTDB_U16(uuid), \
+    HOST_GATTDB_U16(handle_value), (permission), 2, HOST_GATTDB_U16(uuid)
+
+#define CHARACTERISTIC_UUID16_WRITABLE(handle, handle_value, uuid, properties, permission) \
+    CHARACTERISTIC_UUID16(handle, handle_value, uuid, properties, permission)
+
+#define CHAR_DESCRIPTOR_UUID16(handle, uuid, permission) \
+    HOST_GATTDB_U16(handle), (permission), 2, HOST_GATTDB_U16(uuid)
+
+#define CHAR_DESCRIPTOR_UUID16_WRITABLE(handle, uuid, permission) \
+    CHAR_DESCRIPTOR_UUID16(handle, uuid, permission)
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+typedef enum
+{
+    WICED_BT_GATT_SUCCESS               = 0x00,
+    WICED_BT_GATT_INVALID_HANDLE        = 0x01,
+    WICED_BT_GATT_READ_NOT_PERMIT       = 0x02,
+    WICED_BT_GATT_WRITE_NOT_PERMIT      = 0x03,
+    WICED_BT_GATT_INVALID_PDU           = 0x04,
+    WICED_BT_GATT_INSUF_AUTHENTICATION  = 0x05,
+    WICED_BT_GATT_REQ_NOT_SUPPORTED     = 0x06,
+    WICED_BT_GATT_INVALID_OFFSET        = 0x07,
+    WICED_BT_GATT_INSUF_AUTHORIZATION   = 0x08,
+    WICED_BT_GATT_PREPARE_Q_FULL        = 0x09,
+    WICED_BT_GATT_ATTRIBUTE_NOT_FOUND   = 0x0a,
+    WICED_BT_GATT_NOT_LONG              = 0x0b,
+    WICED_BT_GATT_INSUF_KEY_SIZE        = 0x0c,
+    WICED_BT_GATT_INVALID_ATTR_LEN      = 0x0d,
+    WICED_BT_GATT_ERR_UNLIKELY          = 0x0e,
+    WICED_BT_GATT_INSUF_ENCRYPTION      = 0x0f,
+    WICED_BT_GATT_UNSUPPORT_GRP_TYPE    = 0x10,
+    WICED_BT_GATT_INSUF_RESOURCE        = 0x11,
+    WICED_BT_GATT_DATABASE_OUT_OF_SYNC  = 0x12,
+    WICED_BT_GATT_VALUE_NOT_ALLOWED     = 0x13,
+    WICED_BT_GATT_NO_RESOURCES          = 0x80,
+    WICED_BT_GATT_INTERNAL_ERROR        = 0x81,
+    WICED_BT_GATT_WRONG_STATE           = 0x82,
+    WICED_BT_GATT_DB_FULL               = 0x83,
+    WICED_BT_GATT_BUSY                  = 0x84,
+    WICED_BT_GATT_ERROR                 = 0x85,
+    WICED_BT_GATT_CMD_STARTED           = 0x86,
+    WICED_BT_GATT_ILLEGAL_PARAMETER     = 0x87,
+    WICED_BT_GATT_PENDING               = 0x88,
+    WICED_BT_GATT_AUTH_FAIL             = 0x89,
+    WICED_BT_GATT_MORE                  = 0x8a,
+    WICED_BT_GATT_INVALID_CFG           = 0x8b,
+    WICED_BT_GATT_SERVICE_STARTED       = 0x8c,
+    WICED_BT_GATT_ENCRYPTED_NO_MITM     = 0x8d,
+    WICED_BT_GATT_NOT_ENCRYPTED         = 0x8e,
+    WICED_BT_GATT_CONGESTED             = 0x8f,
+    WICED_BT_GATT_WRITE_REQ_REJECTED    = 0xFC,
+    WICED_BT_GATT_CCC_CFG_ERR           = 0xFD,
+    WICED_BT_GATT_PRC_IN_PROGRESS       = 0xFE,
+    WICED_BT_GATT_OUT_OF_RANGE          = 0xFF,
+} wiced_bt_gatt_status_t;
+
+typedef enum
+{
+    GATT_RSP_ERROR                      = 0x01,
+    GATT_REQ_MTU                        = 0x02,
+    GATT_RSP_MTU                        = 0x03,
+    GATT_REQ_FIND_INFO                  = 0x04,
+    GATT_RSP_FIND_INFO                  = 0x05,
+    GATT_REQ_FIND_TYPE_VALUE            = 0x06,
+    GATT_RSP_FIND_TYPE_VALUE            = 0x07,
+    GATT_REQ_READ_BY_TYPE               = 0x08,
+    GATT_RSP_READ_BY_TYPE               = 0x09,
+    GATT_REQ_READ                       = 0x0A,
+    GATT_RSP_READ                       = 0x0B,
+    GATT_REQ_READ_BLOB                  = 0x0C,
+    GATT_RSP_READ_BLOB                  = 0x0D,
+    GATT_REQ_READ_MULTI                 = 0x0E,
+    GATT_RSP_READ_MULTI                 = 0x0F,
+    GATT_REQ_READ_BY_GRP_TYPE           = 0x10,
+    GATT_RSP_READ_BY_GRP_TYPE           = 0x11,
+    GATT_REQ_WRITE                      = 0x12,
+    GATT_RSP_WRITE                      = 0x13,
+    GATT_REQ_PREPARE_WRITE              = 0x16,
+    GATT_RSP_PREPARE_WRITE              = 0x17,
+    GATT_REQ_EXECUTE_WRITE              = 0x18,
+    GATT_RSP_EXECUTE_WRITE              = 0x19,
+    GATT_HANDLE_VALUE_NOTIF             = 0x1B,
+    GATT_HANDLE_VALUE_IND               = 0x1D,
+    GATT_HANDLE_VALUE_CONF              = 0x1E,
+    GATT_REQ_READ_MULTI_VAR_LENGTH      = 0x20,
+    GATT_RSP_READ_MULTI_VAR_LENGTH      = 0x21,
+    GATT_HANDLE_VALUE_MULTI_NOTIF       = 0x23,
+    GATT_CMD_WRITE                      = 0x52,
+    GATT_CMD_SIGNED_WRITE               = 0xD2,
+} wiced_bt_gatt_opcode_t;
+
+typedef uint16_t wiced_bt_gatt_disconn_reason_t;
+enum
+{
+    GATT_CONN_UNKNOWN                   = 0,
+    GATT_CONN_L2C_FAILURE               = 1,
+    GATT_CONN_TIMEOUT                   = 0x08,
+    GATT_CONN_TERMINATE_PEER_USER       = 0x13,
+    GATT_CONN_TERMINATE_LOCAL_HOST      = 0x16,
+    GATT_CONN_FAIL_ESTABLISH            = 0x3e,
+    GATT_CONN_LMP_TIMEOUT               = 0x22,
+    GATT_CONN_CANCEL                    = 0x0100,
+};
+
+typedef enum
+{
+    GATT_CONNECTION_STATUS_EVT,
+    GATT_OPERATION_CPLT_EVT,
+    GATT_DISCOVERY_RESULT_EVT,
+    GATT_DISCOVERY_CPLT_EVT,
+    GATT_ATTRIBUTE_REQUEST_EVT,
+    GATT_CONGESTION_EVT,
+    GATT_GET_RESPONSE_BUFFER_EVT,
+    GATT_APP_BUFFER_TRANSMITTED_EVT,
+} wiced_bt_gatt_evt_t;
+
+typedef enum
+{
+    GATT_PREPARE_WRITE_CANCEL           = 0x00,
+    GATT_PREPARE_WRITE_EXEC             = 0x01,
+} wiced_bt_gatt_exec_flag_t;
+
+/* Client operations, reported by GATT_OPERATION_CPLT_EVT */
+typedef enum
+{
+    GATTC_OPTYPE_NONE                   = 0,
+    GATTC_OPTYPE_CONFIG_MTU             = GATT_REQ_MTU,
+    GATTC_OPTYPE_NOTIFICATION           = GATT_HANDLE_VALUE_NOTIF,
+    GATTC_OPTYPE_INDICATION             = GATT_HANDLE_VALUE_IND,
+} wiced_bt_gatt_optype_t;
+
+typedef void (*pfn_free_buffer_t)(uint8_t *);
+
+typedef struct
+{
+    uint16_t handle;
+    uint16_t offset;
+} wiced_bt_gatt_read_t;
+
+typedef struct
+{
+    uint16_t handle;
+    uint16_t offset;
+    uint16_t val_len;
+    uint8_t  *p_val;
+} wiced_bt_gatt_write_req_t;
+
+typedef struct
+{
+    uint16_t        s_handle;
+    uint16_t        e_handle;
+    wiced_bt_uuid_t uuid;
+} wiced_bt_gatt_read_by_type_t;
+
+typedef struct
+{
+    uint16_t num_handles;
+    uint8_t  *p_handle_stream;
+} wiced_bt_gatt_read_multiple_req_t;
+
+typedef union
+{
+    wiced_bt_gatt_read_t              read_req;
+    wiced_bt_gatt_write_req_t         write_req;
+    wiced_bt_gatt_exec_flag_t         exec_write;
+    uint16_t                          remote_mtu;
+    uint16_t                          confirm_handle;
+    wiced_bt_gatt_read_by_type_t      read_by_type;
+    wiced_bt_gatt_read_multiple_req_t read_multiple_req;
+} wiced_bt_gatt_request_data_t;
+
+typedef struct
+{
+    uint16_t                     conn_id;
+    wiced_bt_gatt_opcode_t       opcode;
+    wiced_bt_gatt_request_data_t data;
+    uint16_t                     len_requested;
+} wiced_bt_gatt_attribute_request_t;
+
+/* As with the stack, the peer address is only lent for the callback */
+typedef struct
+{
+    uint8_t                       *bd_addr;
+    wiced_bt_ble_address_type_t    addr_type;
+    uint16_t                       conn_id;
+    wiced_bool_t                   connected;
+    wiced_bt_gatt_disconn_reason_t reason;
+    wiced_bt_transport_t           transport;
+    uint8_t                        link_role;
+} wiced_bt_gatt_connection_status_t;
+
+typedef union
+{
+    uint16_t mtu;
+    uint16_t handle;
+} wiced_bt_gatt_operation_complete_rsp_t;
+
+typedef struct
+{
+    uint16_t                               conn_id;
+    wiced_bt_gatt_optype_t                 op;
+    wiced_bt_gatt_status_t                 status;
+    uint8_t                                pending_events;
+    wiced_bt_gatt_operation_complete_rsp_t response_data;
+} wiced_bt_gatt_operation_complete_t;
+
+typedef struct
+{
+    uint16_t     conn_id;
+    wiced_bool_t congested;
+} wiced_bt_gatt_congestion_event_t;
+
+typedef struct
+{
+    uint16_t len_requested;
+    uint8_t  *p_app_rsp_buffer;
+    void     *p_app_ctxt;
+} wiced_bt_gatt_buffer_request_t;
+
+typedef struct
+{
+    uint8_t *p_app_data;
+    void    *p_app_ctxt;
+} wiced_bt_gatt_buffer_transmitted_t;
+
+typedef union
+{
+    wiced_bt_gatt_connection_status_t  connection_status;
+    wiced_bt_gatt_operation_complete_t operation_complete;
+    wiced_bt_gatt_attribute_request_t  attribute_request;
+    wiced_bt_gatt_congestion_event_t   congestion;
+    wiced_bt_gatt_buffer_request_t     buffer_request;
+    wiced_bt_gatt_buffer_transmitted_t buffer_xmitted;
+} wiced_bt_gatt_event_data_t;
+
+typedef wiced_bt_gatt_status_t (wiced_bt_gatt_cback_t)(wiced_bt_gatt_evt_t event,
+                                                       wiced_bt_gatt_event_data_t *p_event_data);
+
+/*******************************************************************************
+*        Function Prototypes
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_register(wiced_bt_gatt_cback_t *p_gatt_cback);
+wiced_bt_gatt_status_t wiced_bt_gatt_db_init(const uint8_t *p_gatt_db, uint32_t gatt_db_size,
+                                             uint8_t *hash);
+wiced_bool_t wiced_bt_gatt_le_connect(wiced_bt_device_address_t bd_addr,
+                                      wiced_bt_ble_address_type_t bd_addr_type,
+                                      wiced_bt_ble_conn_mode_t conn_mode,
+                                      wiced_bool_t is_direct);
+wiced_bool_t wiced_bt_gatt_cancel_connect(wiced_bt_device_address_t bd_addr,
+                                          wiced_bool_t is_direct);
+wiced_bt_gatt_status_t wiced_bt_gatt_disconnect(uint16_t conn_id);
+wiced_bt_gatt_status_t wiced_bt_gatt_client_configure_mtu(uint16_t conn_id, uint16_t mtu);
+
+uint16_t wiced_bt_gatt_find_handle_by_type(uint16_t s_handle, uint16_t e_handle,
+                                           wiced_bt_uuid_t *p_uuid);
+int wiced_bt_gatt_put_read_by_type_rsp_in_stream(uint8_t *p_stream, int stream_len,
+                                                 uint8_t *p_pair_len, uint16_t attr_handle,
+                                                 int attr_len, uint8_t *p_attr);
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_read_handle_rsp(uint16_t conn_id,
+                                                                 wiced_bt_gatt_opcode_t opcode,
+                                                                 uint16_t len, uint8_t *p_attr,
+                                                                 void *p_app_ctxt);
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_read_by_type_rsp(uint16_t conn_id,
+                                                                  wiced_bt_gatt_opcode_t opcode,
+                                                                  uint8_t type_len,
+                                                                  uint16_t data_len,
+                                                                  uint8_t *p_app_rsp_buffer,
+                                                                  void *p_app_ctxt);
+
+uint16_t wiced_bt_gatt_get_handle_from_stream(uint8_t *p_stream, uint16_t handle_index);
+
+int wiced_bt_gatt_put_read_multi_rsp_in_stream(wiced_bt_gatt_opcode_t opcode, uint8_t *p_dest,
+                                               int dest_len, uint16_t handle, uint16_t value_len,
+                                               uint8_t *p_value);
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_read_multiple_rsp(uint16_t conn_id,
+                                                                   wiced_bt_gatt_opcode_t opcode,
+                                                                   uint16_t len,
+                                                                   uint8_t *p_app_rsp_buffer,
+                                                                   void *p_app_ctxt);
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_write_rsp(uint16_t conn_id,
+                                                           wiced_bt_gatt_opcode_t opcode,
+                                                           uint16_t handle);
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_prepare_write_rsp(uint16_t conn_id,
+                                                                   wiced_bt_gatt_opcode_t opcode,
+                                                                   uint16_t handle,
+                                                                   uint16_t offset,
+                                                                   uint16_t len,
+                                                                   uint8_t *p_data,
+                                                                   void *p_app_ctxt);
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_execute_write_rsp(uint16_t conn_id,
+                                                                   wiced_bt_gatt_opcode_t opcode);
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_mtu_rsp(uint16_t conn_id,
+                                                         uint16_t remote_mtu,
+                                                         uint16_t my_mtu);
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_error_rsp(uint16_t conn_id,
+                                                           wiced_bt_gatt_opcode_t opcode,
+                                                           uint16_t handle,
+                                                           wiced_bt_gatt_status_t status);
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_notification(uint16_t conn_id,
+                                                              uint16_t attr_handle,
+                                                              uint16_t val_len,
+                                                              uint8_t *p_val,
+                                                              void *p_app_ctxt);
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_indication(uint16_t conn_id,
+                                                            uint16_t attr_handle,
+                                                            uint16_t val_len,
+                                                            uint8_t *p_val,
+                                                            void *p_app_ctxt);
+
+#endif /* WICED_BT_GATT_H */
@@ -0,0 +1,985 @@
+/******************************************************************************
+* File Name: wiced_bt_stub.c
+*
+* Description: Host stand-in for the parts of the AIROC(TM) Bluetooth stack
+*              used by the application.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Host stand-in for the parts of the AIROC(TM) Bluetooth stack used by the
+ * application. Responses are counted rather than transmitted; buffers handed
+ * to the stack are returned through GATT_APP_BUFFER_TRANSMITTED_EVT when the
+ * driver calls host_bt_complete_tx(), as the controller would after sending. */
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "host_stub.h"
+#include "cycfg_bt_settings.h"
+#include "wiced_bt_l2c.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define HOST_BT_MAX_ATTRIBUTES          (1024u)
+#define HOST_BT_MAX_PENDING_TX          (64u)
+#define HOST_BT_MAX_LINKS               (8u)
+
+/* Parameters a link comes up with: 30 ms, no latency, 5 s */
+#define HOST_BT_CONN_INTERVAL           (24u)
+#define HOST_BT_CONN_LATENCY            (0u)
+#define HOST_BT_CONN_TIMEOUT            (500u)
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+typedef struct
+{
+    uint16_t handle;
+    uint16_t type;
+} host_bt_attr_t;
+
+typedef struct
+{
+    uint8_t *p_app_data;
+    void    *p_app_ctxt;
+    uint16_t conn_id;                           /* Link of a notification, else 0 */
+} host_bt_tx_t;
+
+typedef struct
+{
+    wiced_bool_t               in_use;
+    wiced_bt_device_address_t  bd_addr;
+    wiced_bt_ble_conn_params_t params;          /* In use on the link */
+    wiced_bool_t               update_pending;  /* Requested, not granted yet */
+    wiced_bt_ble_conn_params_t update;
+    uint16_t                   conn_id;
+    uint16_t                   mtu;             /* ATT MTU responses are checked against */
+    uint16_t                   mtu_request;     /* MTU the server asked for, 0 if none */
+    uint16_t                   tx_octets;       /* LL payload asked for, 0 if none */
+    int8_t                     rssi;            /* Reported by RSSI reads */
+    uint8_t                    phy_request;     /* PHYs the server asked for, 0 if none */
+    uint32_t                   tx_pending;      /* Notifications not transmitted yet */
+    wiced_bool_t               congested;       /* A notification was refused */
+    uint16_t                   indication;      /* Handle indicated, not confirmed yet */
+} host_bt_link_t;
+
+/*******************************************************************************
+*        Variable Definitions
+*******************************************************************************/
+host_bt_stats_t host_bt_stats;
+host_bt_rsp_t   host_bt_last_rsp;
+host_bt_rsp_t   host_bt_last_value;
+wiced_bt_cfg_settings_t wiced_bt_cfg_settings = { (uint8_t *)"CTS Server", CY_BT_MTU_SIZE };
+
+static wiced_bt_gatt_cback_t            *host_gatt_cback;
+static wiced_bt_ble_scan_result_cback_t *host_scan_cback;
+static wiced_bt_ble_scan_type_t         host_scan_type = BTM_BLE_SCAN_TYPE_NONE;
+
+static host_bt_attr_t host_attrs[HOST_BT_MAX_ATTRIBUTES];
+static uint32_t       host_attr_count;
+
+static host_bt_tx_t   host_pending_tx[HOST_BT_MAX_PENDING_TX];
+static uint32_t       host_pending_tx_count;
+
+/* Notifications a link holds before the stack reports congestion, 0 for no
+ * limit */
+static uint32_t       host_tx_credits;
+
+/* Link the application asked to encrypt, until the driver plays the peer */
+static wiced_bt_device_address_t host_encrypt_addr;
+static wiced_bool_t              host_encrypt_pending;
+
+/* Connection parameters, MTU and data length per peer, until the driver
+ * grants the updates */
+static host_bt_link_t host_links[HOST_BT_MAX_LINKS];
+
+/* The controller reads the RSSI of one link at a time */
+static wiced_bt_device_address_t  host_rssi_addr;
+static wiced_bt_dev_cmpl_cback_t *host_rssi_cback;
+
+/* Stands in for the stack's own task, which runs all its callbacks */
+static TaskHandle_t               host_bt_stack_task;
+
+/*******************************************************************************
+*        Stand-in Control
+*******************************************************************************/
+static void host_bt_queue_tx(uint8_t *p_data, void *p_ctxt)
+{
+    if (host_pending_tx_count < HOST_BT_MAX_PENDING_TX)
+    {
+        host_pending_tx[host_pending_tx_count].p_app_data = p_data;
+        host_pending_tx[host_pending_tx_count].p_app_ctxt = p_ctxt;
+        host_pending_tx[host_pending_tx_count].conn_id = 0;
+        host_pending_tx_count++;
+    }
+}
+
+static void host_bt_respond(wiced_bt_gatt_opcode_t opcode, wiced_bt_gatt_status_t status,
+                            const uint8_t *p_value, uint16_t len)
+{
+    host_bt_last_rsp.opcode = opcode;
+    host_bt_last_rsp.status = status;
+    host_bt_last_rsp.len = MIN(len, (uint16_t)sizeof(host_bt_last_rsp.value));
+    if (NULL != p_value)
+    {
+        memcpy(host_bt_last_rsp.value, p_value, host_bt_last_rsp.len);
+    }
+}
+
+static void host_bt_sent_value(wiced_bt_gatt_opcode_t opcode, const uint8_t *p_value,
+                               uint16_t len)
+{
+    host_bt_last_value.opcode = opcode;
+    host_bt_last_value.status = WICED_BT_GATT_SUCCESS;
+    host_bt_last_value.len = MIN(len, (uint16_t)sizeof(host_bt_last_value.value));
+    memcpy(host_bt_last_value.value, p_value, host_bt_last_value.len);
+}
+
+static host_bt_link_t *host_bt_link(const uint8_t *bd_addr, wiced_bool_t create)
+{
+    host_bt_link_t *p_free = NULL;
+    uint32_t i;
+
+    for (i = 0; i < HOST_BT_MAX_LINKS; i++)
+    {
+        if (!host_links[i].in_use)
+        {
+            p_free = (NULL == p_free) ? &host_links[i] : p_free;
+        }
+        else if (0 == memcmp(host_links[i].bd_addr, bd_addr, BD_ADDR_LEN))
+        {
+            return &host_links[i];
+        }
+    }
+    if (!create || (NULL == p_free))
+    {
+        return NULL;
+    }
+    memset(p_free, 0, sizeof(*p_free));
+    p_free->in_use = WICED_TRUE;
+    memcpy(p_free->bd_addr, bd_addr, BD_ADDR_LEN);
+    return p_free;
+}
+
+static host_bt_link_t *host_bt_link_by_conn(uint16_t conn_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < HOST_BT_MAX_LINKS; i++)
+    {
+        if (host_links[i].in_use && (host_links[i].conn_id == conn_id))
+        {
+            return &host_links[i];
+        }
+    }
+    return NULL;
+}
+
+/* Counts ATT PDUs the application built larger than the link's MTU */
+static void host_bt_check_len(uint16_t conn_id, uint32_t att_len)
+{
+    host_bt_link_t *p_link = host_bt_link_by_conn(conn_id);
+
+    if ((NULL != p_link) && (att_len > p_link->mtu))
+    {
+        host_bt_stats.oversize++;
+    }
+}
+
+TaskHandle_t host_bt_task(void)
+{
+    if (NULL == host_bt_stack_task)
+    {
+        xTaskCreate(NULL, "bt_stack", configMINIMAL_STACK_SIZE * 8, NULL,
+                    configMAX_PRIORITIES - 1, &host_bt_stack_task);
+    }
+    return host_bt_stack_task;
+}
+
+wiced_bt_gatt_status_t host_bt_gatt_event(wiced_bt_gatt_evt_t event,
+                                          wiced_bt_gatt_event_data_t *p_event_data)
+{
+    wiced_bt_gatt_status_t status;
+    host_bt_link_t *p_link;
+    TaskHandle_t prev;
+
+    if (NULL == host_gatt_cback)
+    {
+        return WICED_BT_GATT_WRONG_STATE;
+    }
+
+    /* A new link starts on the default parameters and MTU */
+    if ((GATT_CONNECTION_STATUS_EVT == event) &&
+        (NULL != (p_link = host_bt_link(p_event_data->connection_status.bd_addr, WICED_TRUE))))
+    {
+        memset(p_link, 0, sizeof(*p_link));
+        memcpy(p_link->bd_addr, p_event_data->connection_status.bd_addr, BD_ADDR_LEN);
+        p_link->in_use = p_event_data->connection_status.connected;
+        p_link->params.role = HCI_ROLE_PERIPHERAL;
+        p_link->params.conn_interval = HOST_BT_CONN_INTERVAL;
+        p_link->params.conn_latency = HOST_BT_CONN_LATENCY;
+        p_link->params.supervision_timeout = HOST_BT_CONN_TIMEOUT;
+        p_link->conn_id = p_event_data->connection_status.conn_id;
+        p_link->mtu = GATT_DEF_BLE_MTU_SIZE;
+    }
+
+    /* The MTU the server asked for is in use once the exchange completes */
+    if ((GATT_OPERATION_CPLT_EVT == event) &&
+        (GATTC_OPTYPE_CONFIG_MTU == p_event_data->operation_complete.op) &&
+        (NULL != (p_link = host_bt_link_by_conn(p_event_data->operation_complete.conn_id))))
+    {
+        p_link->mtu = p_event_data->operation_complete.response_data.mtu;
+    }
+
+    prev = host_task_switch(host_bt_task());
+    status = host_gatt_cback(event, p_event_data);
+    host_task_switch(prev);
+    return status;
+}
+
+uint32_t host_bt_complete_tx(void)
+{
+    wiced_bt_gatt_event_data_t evt;
+    host_bt_link_t *p_link;
+    uint32_t i;
+    uint32_t count = host_pending_tx_count;
+
+    /* Callbacks may queue further transmissions; only drain what was pending */
+    host_pending_tx_count = 0;
+    for (i = 0; i < count; i++)
+    {
+        if ((0 != host_pending_tx[i].conn_id) &&
+            (NULL != (p_link = host_bt_link_by_conn(host_pending_tx[i].conn_id))) &&
+            (0 != p_link->tx_pending))
+        {
+            p_link->tx_pending--;
+        }
+
+        memset(&evt, 0, sizeof(evt));
+        evt.buffer_xmitted.p_app_data = host_pending_tx[i].p_app_data;
+        evt.buffer_xmitted.p_app_ctxt = host_pending_tx[i].p_app_ctxt;
+        if (WICED_BT_GATT_SUCCESS == host_bt_gatt_event(GATT_APP_BUFFER_TRANSMITTED_EVT, &evt))
+        {
+            host_bt_stats.tx_completed++;
+        }
+        else
+        {
+            host_bt_stats.tx_unhandled++;
+        }
+    }
+
+    /* Links that refused notifications take them again */
+    for (i = 0; i < HOST_BT_MAX_LINKS; i++)
+    {
+        p_link = &host_links[i];
+        if (p_link->in_use && p_link->congested && (p_link->tx_pending < host_tx_credits))
+        {
+            p_link->congested = WICED_FALSE;
+            memset(&evt, 0, sizeof(evt));
+            evt.congestion.conn_id = p_link->conn_id;
+            evt.congestion.congested = WICED_FALSE;
+            host_bt_gatt_event(GATT_CONGESTION_EVT, &evt);
+        }
+    }
+    return count;
+}
+
+void host_bt_set_tx_credits(uint32_t credits)
+{
+    host_tx_credits = credits;
+}
+
+wiced_bool_t host_bt_take_indication(uint16_t conn_id, uint16_t *p_handle)
+{
+    host_bt_link_t *p_link = host_bt_link_by_conn(conn_id);
+
+    if ((NULL == p_link) || (0 == p_link->indication))
+    {
+        return WICED_FALSE;
+    }
+    *p_handle = p_link->indication;
+    p_link->indication = 0;
+    return WICED_TRUE;
+}
+
+void host_bt_scan_report(wiced_bt_ble_scan_results_t *p_scan_result, uint8_t *p_adv_data)
+{
+    TaskHandle_t prev;
+
+    if ((BTM_BLE_SCAN_TYPE_NONE != host_scan_type) && (NULL != host_scan_cback))
+    {
+        prev = host_task_switch(host_bt_task());
+        host_scan_cback(p_scan_result, p_adv_data);
+        host_task_switch(prev);
+    }
+}
+
+wiced_bool_t host_bt_is_scanning(void)
+{
+    return (BTM_BLE_SCAN_TYPE_NONE != host_scan_type);
+}
+
+wiced_bool_t host_bt_take_encryption_request(wiced_bt_device_address_t bd_addr)
+{
+    if (!host_encrypt_pending || (0 != memcmp(bd_addr, host_encrypt_addr, BD_ADDR_LEN)))
+    {
+        return WICED_FALSE;
+    }
+    host_encrypt_pending = WICED_FALSE;
+    return WICED_TRUE;
+}
+
+wiced_bool_t host_bt_take_conn_param_request(wiced_bt_device_address_t bd_addr,
+                                             wiced_bt_ble_connection_param_update_t *p_update)
+{
+    host_bt_link_t *p_link = host_bt_link(bd_addr, WICED_FALSE);
+
+    if ((NULL == p_link) || !p_link->update_pending)
+    {
+        return WICED_FALSE;
+    }
+    p_link->update_pending = WICED_FALSE;
+    p_link->params = p_link->update;
+
+    memset(p_update, 0, sizeof(*p_update));
+    memcpy(p_update->bd_addr, bd_addr, BD_ADDR_LEN);
+    p_update->conn_interval = p_link->params.conn_interval;
+    p_update->conn_latency = p_link->params.conn_latency;
+    p_update->supervision_timeout = p_link->params.supervision_timeout;
+    return WICED_TRUE;
+}
+
+wiced_bool_t host_bt_take_mtu_request(uint16_t conn_id, uint16_t *p_mtu)
+{
+    host_bt_link_t *p_link = host_bt_link_by_conn(conn_id);
+
+    if ((NULL == p_link) || (0 == p_link->mtu_request))
+    {
+        return WICED_FALSE;
+    }
+    *p_mtu = p_link->mtu_request;
+    p_link->mtu_request = 0;
+    return WICED_TRUE;
+}
+
+wiced_bool_t host_bt_take_data_length_request(wiced_bt_device_address_t bd_addr,
+                                              wiced_bt_ble_data_length_update_t *p_update)
+{
+    host_bt_link_t *p_link = host_bt_link(bd_addr, WICED_FALSE);
+
+    if ((NULL == p_link) || (0 == p_link->tx_octets))
+    {
+        return WICED_FALSE;
+    }
+
+    memset(p_update, 0, sizeof(*p_update));
+    memcpy(p_update->bd_address, bd_addr, BD_ADDR_LEN);
+    p_update->max_tx_octets = p_link->tx_octets;
+    p_update->max_tx_time = (uint16_t)((p_link->tx_octets + 14u) * 8u);
+    p_update->max_rx_octets = p_link->tx_octets;
+    p_update->max_rx_time = p_update->max_tx_time;
+    p_link->tx_octets = 0;
+    return WICED_TRUE;
+}
+
+void host_bt_set_rssi(wiced_bt_device_address_t bd_addr, int8_t rssi)
+{
+    host_bt_link_t *p_link = host_bt_link(bd_addr, WICED_FALSE);
+
+    if (NULL != p_link)
+    {
+        p_link->rssi = rssi;
+    }
+}
+
+wiced_bool_t host_bt_complete_rssi_read(void)
+{
+    wiced_bt_dev_cmpl_cback_t *p_cback = host_rssi_cback;
+    wiced_bt_dev_rssi_result_t result;
+    host_bt_link_t *p_link;
+    TaskHandle_t prev;
+
+    if (NULL == p_cback)
+    {
+        return WICED_FALSE;
+    }
+    host_rssi_cback = NULL;
+
+    memset(&result, 0, sizeof(result));
+    memcpy(result.rem_bda, host_rssi_addr, BD_ADDR_LEN);
+    p_link = host_bt_link(host_rssi_addr, WICED_FALSE);
+    result.status = (NULL != p_link) ? WICED_BT_SUCCESS : WICED_BT_ERROR;
+    result.rssi = (NULL != p_link) ? p_link->rssi : 0;
+    prev = host_task_switch(host_bt_task());
+    p_cback(&result);
+    host_task_switch(prev);
+    return WICED_TRUE;
+}
+
+wiced_bool_t host_bt_take_phy_request(wiced_bt_device_address_t bd_addr,
+                                      wiced_bt_ble_phy_update_t *p_update)
+{
+    host_bt_link_t *p_link = host_bt_link(bd_addr, WICED_FALSE);
+    wiced_bt_ble_phy_t phy = WICED_BT_BLE_PHY_1M;
+
+    if ((NULL == p_link) || (0 == p_link->phy_request))
+    {
+        return WICED_FALSE;
+    }
+    if (0 != (p_link->phy_request & BTM_BLE_PREFER_2M_PHY))
+    {
+        phy = WICED_BT_BLE_PHY_2M;
+    }
+    else if (0 != (p_link->phy_request & BTM_BLE_PREFER_LELR_PHY))
+    {
+        phy = WICED_BT_BLE_PHY_LE_CODED;
+    }
+    p_link->phy_request = 0;
+
+    memset(p_update, 0, sizeof(*p_update));
+    memcpy(p_update->bd_address, bd_addr, BD_ADDR_LEN);
+    p_update->tx_phy = phy;
+    p_update->rx_phy = phy;
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+*        Device Management
+*******************************************************************************/
+void wiced_bt_dev_read_local_addr(wiced_bt_device_address_t bd_addr)
+{
+    static const wiced_bt_device_address_t local = { 0x00, 0xA0, 0x50, 0x00, 0x00, 0x00 };
+    memcpy(bd_addr, local, BD_ADDR_LEN);
+}
+
+void wiced_bt_set_pairable_mode(uint8_t allow_pairing, uint8_t connect_only_paired)
+{
+    (void)allow_pairing;
+    (void)connect_only_paired;
+}
+
+void wiced_bt_ble_security_grant(wiced_bt_device_address_t bd_addr, uint8_t res)
+{
+    (void)bd_addr;
+    (void)res;
+}
+
+wiced_result_t wiced_bt_dev_set_encryption(wiced_bt_device_address_t bd_addr,
+                                           wiced_bt_transport_t transport, void *p_ref_data)
+{
+    (void)transport;
+    (void)p_ref_data;
+    if (host_encrypt_pending)
+    {
+        return WICED_BT_BUSY;
+    }
+    memcpy(host_encrypt_addr, bd_addr, BD_ADDR_LEN);
+    host_encrypt_pending = WICED_TRUE;
+    host_bt_stats.encryptions++;
+    return WICED_BT_PENDING;
+}
+
+wiced_result_t wiced_bt_dev_add_device_to_address_resolution_db(
+    wiced_bt_device_link_keys_t *p_link_keys)
+{
+    (void)p_link_keys;
+    return WICED_BT_SUCCESS;
+}
+
+wiced_result_t wiced_bt_ble_get_connection_parameters(wiced_bt_device_address_t remote_bda,
+                                                      wiced_bt_ble_conn_params_t *p_conn_parameters)
+{
+    host_bt_link_t *p_link = host_bt_link(remote_bda, WICED_FALSE);
+
+    if (NULL == p_link)
+    {
+        return WICED_BT_ERROR;
+    }
+    *p_conn_parameters = p_link->params;
+    return WICED_BT_SUCCESS;
+}
+
+wiced_result_t wiced_bt_ble_set_data_packet_length(wiced_bt_device_address_t remote_bda,
+                                                  uint16_t tx_pdu_length, uint16_t tx_time)
+{
+    host_bt_link_t *p_link = host_bt_link(remote_bda, WICED_FALSE);
+
+    (void)tx_time;
+    if (NULL == p_link)
+    {
+        return WICED_BT_ERROR;
+    }
+    p_link->tx_octets = tx_pdu_length;
+    host_bt_stats.dle_requests++;
+    return WICED_BT_SUCCESS;
+}
+
+wiced_result_t wiced_bt_ble_set_phy(wiced_bt_ble_phy_preferences_t *phy_preferences)
+{
+    host_bt_link_t *p_link = host_bt_link(phy_preferences->remote_bd_addr, WICED_FALSE);
+
+    if (NULL == p_link)
+    {
+        return WICED_BT_ERROR;
+    }
+    p_link->phy_request = phy_preferences->tx_phys;
+    host_bt_stats.phy_requests++;
+    return WICED_BT_SUCCESS;
+}
+
+wiced_result_t wiced_bt_dev_read_rssi(wiced_bt_device_address_t remote_bda,
+                                      wiced_bt_transport_t transport,
+                                      wiced_bt_dev_cmpl_cback_t *p_cback)
+{
+    (void)transport;
+    if (NULL != host_rssi_cback)
+    {
+        return WICED_BT_BUSY;
+    }
+    memcpy(host_rssi_addr, remote_bda, BD_ADDR_LEN);
+    host_rssi_cback = p_cback;
+    host_bt_stats.rssi_reads++;
+    return WICED_BT_PENDING;
+}
+
+/* The controller settles on the longest interval the request allows */
+wiced_bool_t wiced_bt_l2cap_update_ble_conn_params(wiced_bt_device_address_t rem_bdRa,
+                                                   uint16_t min_int, uint16_t max_int,
+                                                   uint16_t latency, uint16_t timeout)
+{
+    host_bt_link_t *p_link = host_bt_link(rem_bdRa, WICED_FALSE);
+
+    (void)min_int;
+    if ((NULL == p_link) || p_link->update_pending)
+    {
+        return WICED_FALSE;
+    }
+    p_link->update_pending = WICED_TRUE;
+    p_link->update.role = p_link->params.role;
+    p_link->update.conn_interval = max_int;
+    p_link->update.conn_latency = latency;
+    p_link->update.supervision_timeout = timeout;
+    host_bt_stats.conn_param_requests++;
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+*        LE Scanning
+*******************************************************************************/
+wiced_result_t wiced_bt_ble_scan(wiced_bt_ble_scan_type_t scan_type,
+                                 wiced_bool_t duplicate_filter_enable,
+                                 wiced_bt_ble_scan_result_cback_t *p_scan_result_cback)
+{
+    (void)duplicate_filter_enable;
+
+    host_scan_type = scan_type;
+    host_scan_cback = p_scan_result_cback;
+    if (BTM_BLE_SCAN_TYPE_NONE == scan_type)
+    {
+        host_bt_stats.scan_stops++;
+        return WICED_BT_SUCCESS;
+    }
+    host_bt_stats.scan_starts++;
+    return WICED_BT_PENDING;
+}
+
+uint8_t *wiced_bt_ble_check_advertising_data(uint8_t *p_adv,
+                                             wiced_bt_ble_advert_type_t type,
+                                             uint8_t *p_length)
+{
+    uint8_t *p = p_adv;
+
+    *p_length = 0;
+    if (NULL == p)
+    {
+        return NULL;
+    }
+
+    /* Walk the AD structures: length(1) type(1) data(length - 1) */
+    while (0 != p[0])
+    {
+        if (p[1] == (uint8_t)type)
+        {
+            *p_length = (uint8_t)(p[0] - 1u);
+            return &p[2];
+        }
+        p += p[0] + 1u;
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+*        GATT
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_register(wiced_bt_gatt_cback_t *p_gatt_cback)
+{
+    host_gatt_cback = p_gatt_cback;
+    return WICED_BT_GATT_SUCCESS;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_db_init(const uint8_t *p_gatt_db, uint32_t gatt_db_size,
+                                             uint8_t *hash)
+{
+    uint32_t offset = 0;
+
+    (void)hash;
+    host_attr_count = 0;
+
+    /* Entry layout: handle(2) perm(1) len(1) type(2) value(len - 2) */
+    while ((offset + 6u) <= gatt_db_size)
+    {
+        if (host_attr_count >= HOST_BT_MAX_ATTRIBUTES)
+        {
+            return WICED_BT_GATT_DB_FULL;
+        }
+        host_attrs[host_attr_count].handle = (uint16_t)(p_gatt_db[offset] |
+                                                        (p_gatt_db[offset + 1] << 8));
+        host_attrs[host_attr_count].type   = (uint16_t)(p_gatt_db[offset + 4] |
+                                                        (p_gatt_db[offset + 5] << 8));
+        host_attr_count++;
+        offset += 4u + p_gatt_db[offset + 3];
+    }
+    return (offset == gatt_db_size) ? WICED_BT_GATT_SUCCESS : WICED_BT_GATT_ILLEGAL_PARAMETER;
+}
+
+wiced_bool_t wiced_bt_gatt_le_connect(wiced_bt_device_address_t bd_addr,
+                                      wiced_bt_ble_address_type_t bd_addr_type,
+                                      wiced_bt_ble_conn_mode_t conn_mode,
+                                      wiced_bool_t is_direct)
+{
+    (void)bd_addr;
+    (void)bd_addr_type;
+    (void)conn_mode;
+    (void)is_direct;
+    host_bt_stats.le_connects++;
+    return WICED_TRUE;
+}
+
+wiced_bool_t wiced_bt_gatt_cancel_connect(wiced_bt_device_address_t bd_addr,
+                                          wiced_bool_t is_direct)
+{
+    (void)bd_addr;
+    (void)is_direct;
+    host_bt_stats.cancel_connects++;
+    return WICED_TRUE;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_disconnect(uint16_t conn_id)
+{
+    (void)conn_id;
+    return WICED_BT_GATT_SUCCESS;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_client_configure_mtu(uint16_t conn_id, uint16_t mtu)
+{
+    host_bt_link_t *p_link = host_bt_link_by_conn(conn_id);
+
+    if (NULL == p_link)
+    {
+        return WICED_BT_GATT_ILLEGAL_PARAMETER;
+    }
+    if (0 != p_link->mtu_request)
+    {
+        return WICED_BT_GATT_BUSY;
+    }
+    p_link->mtu_request = mtu;
+    host_bt_stats.mtu_requests++;
+    return WICED_BT_GATT_SUCCESS;
+}
+
+uint16_t wiced_bt_gatt_find_handle_by_type(uint16_t s_handle, uint16_t e_handle,
+                                           wiced_bt_uuid_t *p_uuid)
+{
+    uint32_t i;
+
+    if ((NULL == p_uuid) || (LEN_UUID_16 != p_uuid->len))
+    {
+        return 0;
+    }
+    for (i = 0; i < host_attr_count; i++)
+    {
+        if ((host_attrs[i].handle >= s_handle) && (host_attrs[i].handle <= e_handle) &&
+            (host_attrs[i].type == p_uuid->uu.uuid16))
+        {
+            return host_attrs[i].handle;
+        }
+    }
+    return 0;
+}
+
+int wiced_bt_gatt_put_read_by_type_rsp_in_stream(uint8_t *p_stream, int stream_len,
+                                                 uint8_t *p_pair_len, uint16_t attr_handle,
+                                                 int attr_len, uint8_t *p_attr)
+{
+    int pair_len = attr_len + 2;
+
+    /* All pairs in one response carry the same length, set by the first one */
+    if (0 == *p_pair_len)
+    {
+        if (pair_len > 255)
+        {
+            pair_len = 255;
+        }
+        *p_pair_len = (uint8_t)pair_len;
+    }
+    else if (pair_len != *p_pair_len)
+    {
+        return 0;
+    }
+    if (stream_len < pair_len)
+    {
+        return 0;
+    }
+
+    p_stream[0] = (uint8_t)(attr_handle & 0xFF);
+    p_stream[1] = (uint8_t)(attr_handle >> 8);
+    memcpy(&p_stream[2], p_attr, (size_t)(pair_len - 2));
+    return pair_len;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_read_handle_rsp(uint16_t conn_id,
+                                                                 wiced_bt_gatt_opcode_t opcode,
+                                                                 uint16_t len, uint8_t *p_attr,
+                                                                 void *p_app_ctxt)
+{
+    host_bt_check_len(conn_id, 1u + len);
+    host_bt_respond(opcode, WICED_BT_GATT_SUCCESS, p_attr, len);
+    host_bt_stats.read_rsp++;
+    host_bt_queue_tx(p_attr, p_app_ctxt);
+    return WICED_BT_GATT_SUCCESS;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_read_by_type_rsp(uint16_t conn_id,
+                                                                  wiced_bt_gatt_opcode_t opcode,
+                                                                  uint8_t type_len,
+                                                                  uint16_t data_len,
+                                                                  uint8_t *p_app_rsp_buffer,
+                                                                  void *p_app_ctxt)
+{
+    (void)type_len;
+    host_bt_check_len(conn_id, 2u + data_len);
+    host_bt_respond(opcode, WICED_BT_GATT_SUCCESS, p_app_rsp_buffer, data_len);
+    host_bt_stats.read_by_type_rsp++;
+    host_bt_queue_tx(p_app_rsp_buffer, p_app_ctxt);
+    return WICED_BT_GATT_SUCCESS;
+}
+
+uint16_t wiced_bt_gatt_get_handle_from_stream(uint8_t *p_stream, uint16_t handle_index)
+{
+    return (uint16_t)(p_stream[2u * handle_index] | (p_stream[2u * handle_index + 1u] << 8));
+}
+
+/* Read Multiple concatenates the values; the variable length variant puts
+ * the full length in front of each. Values are cut where the room ends. */
+int wiced_bt_gatt_put_read_multi_rsp_in_stream(wiced_bt_gatt_opcode_t opcode, uint8_t *p_dest,
+                                               int dest_len, uint16_t handle, uint16_t value_len,
+                                               uint8_t *p_value)
+{
+    int hdr_len = (GATT_REQ_READ_MULTI_VAR_LENGTH == opcode) ? 2 : 0;
+    int copy_len;
+
+    (void)handle;
+    if (dest_len < hdr_len)
+    {
+        return 0;
+    }
+    if (0 != hdr_len)
+    {
+        p_dest[0] = (uint8_t)(value_len & 0xFF);
+        p_dest[1] = (uint8_t)(value_len >> 8);
+    }
+    copy_len = ((int)value_len < (dest_len - hdr_len)) ? (int)value_len : (dest_len - hdr_len);
+    memcpy(&p_dest[hdr_len], p_value, (size_t)copy_len);
+    return hdr_len + copy_len;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_read_multiple_rsp(uint16_t conn_id,
+                                                                   wiced_bt_gatt_opcode_t opcode,
+                                                                   uint16_t len,
+                                                                   uint8_t *p_app_rsp_buffer,
+                                                                   void *p_app_ctxt)
+{
+    host_bt_check_len(conn_id, 1u + len);
+    host_bt_respond(opcode, WICED_BT_GATT_SUCCESS, p_app_rsp_buffer, len);
+    host_bt_stats.read_multi_rsp++;
+    host_bt_queue_tx(p_app_rsp_buffer, p_app_ctxt);
+    return WICED_BT_GATT_SUCCESS;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_write_rsp(uint16_t conn_id,
+                                                           wiced_bt_gatt_opcode_t opcode,
+                                                           uint16_t handle)
+{
+    (void)conn_id;
+    (void)handle;
+    host_bt_respond(opcode, WICED_BT_GATT_SUCCESS, NULL, 0);
+    host_bt_stats.write_rsp++;
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/* The response echoes handle, offset and value, so the client can check
+ * what was queued */
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_prepare_write_rsp(uint16_t conn_id,
+                                                                   wiced_bt_gatt_opcode_t opcode,
+                                                                   uint16_t handle,
+                                                                   uint16_t offset,
+                                                                   uint16_t len,
+                                                                   uint8_t *p_data,
+                                                                   void *p_app_ctxt)
+{
+    (void)handle;
+    (void)offset;
+    host_bt_check_len(conn_id, 5u + len);
+    host_bt_respond(opcode, WICED_BT_GATT_SUCCESS, p_data, len);
+    host_bt_stats.prepare_write_rsp++;
+    host_bt_queue_tx(p_data, p_app_ctxt);
+    return WICED_BT_GATT_SUCCESS;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_execute_write_rsp(uint16_t conn_id,
+                                                                   wiced_bt_gatt_opcode_t opcode)
+{
+    (void)conn_id;
+    host_bt_respond(opcode, WICED_BT_GATT_SUCCESS, NULL, 0);
+    host_bt_stats.execute_write_rsp++;
+    return WICED_BT_GATT_SUCCESS;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_mtu_rsp(uint16_t conn_id,
+                                                         uint16_t remote_mtu,
+                                                         uint16_t my_mtu)
+{
+    host_bt_link_t *p_link = host_bt_link_by_conn(conn_id);
+
+    if (NULL != p_link)
+    {
+        p_link->mtu = MAX(MIN(remote_mtu, my_mtu), GATT_DEF_BLE_MTU_SIZE);
+    }
+    host_bt_stats.mtu_rsp++;
+    return WICED_BT_GATT_SUCCESS;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_error_rsp(uint16_t conn_id,
+                                                           wiced_bt_gatt_opcode_t opcode,
+                                                           uint16_t handle,
+                                                           wiced_bt_gatt_status_t status)
+{
+    (void)conn_id;
+    (void)handle;
+    host_bt_respond(opcode, status, NULL, 0);
+    host_bt_stats.error_rsp++;
+    return WICED_BT_GATT_SUCCESS;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_notification(uint16_t conn_id,
+                                                              uint16_t attr_handle,
+                                                              uint16_t val_len,
+                                                              uint8_t *p_val,
+                                                              void *p_app_ctxt)
+{
+    host_bt_link_t *p_link = host_bt_link_by_conn(conn_id);
+
+    (void)attr_handle;
+    if (0 == conn_id)
+    {
+        return WICED_BT_GATT_ILLEGAL_PARAMETER;
+    }
+
+    /* The stack holds a few notifications per link and refuses the rest
+     * until it has sent some */
+    if ((NULL != p_link) && (0 != host_tx_credits) && (p_link->tx_pending >= host_tx_credits))
+    {
+        p_link->congested = WICED_TRUE;
+        host_bt_stats.congested++;
+        return WICED_BT_GATT_CONGESTED;
+    }
+
+    host_bt_check_len(conn_id, 3u + val_len);
+    host_bt_stats.notifications++;
+    host_bt_sent_value(GATT_HANDLE_VALUE_NOTIF, p_val, val_len);
+    host_bt_queue_tx(p_val, p_app_ctxt);
+    if ((NULL != p_link) && (0 != host_pending_tx_count))
+    {
+        host_pending_tx[host_pending_tx_count - 1u].conn_id = conn_id;
+        p_link->tx_pending++;
+    }
+    return WICED_BT_GATT_SUCCESS;
+}
+
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_indication(uint16_t conn_id,
+                                                            uint16_t attr_handle,
+                                                            uint16_t val_len,
+                                                            uint8_t *p_val,
+                                                            void *p_app_ctxt)
+{
+    host_bt_link_t *p_link = host_bt_link_by_conn(conn_id);
+
+    if (0 == conn_id)
+    {
+        return WICED_BT_GATT_ILLEGAL_PARAMETER;
+    }
+
+    /* ATT allows one unconfirmed indication per link */
+    if ((NULL != p_link) && (0 != p_link->indication))
+    {
+        host_bt_stats.indications_busy++;
+        return WICED_BT_GATT_BUSY;
+    }
+    if ((NULL != p_link) && (0 != host_tx_credits) && (p_link->tx_pending >= host_tx_credits))
+    {
+        p_link->congested = WICED_TRUE;
+        host_bt_stats.congested++;
+        return WICED_BT_GATT_CONGESTED;
+    }
+
+    host_bt_check_len(conn_id, 3u + val_len);
+    host_bt_stats.indications++;
+    host_bt_sent_value(GATT_HANDLE_VALUE_IND, p_val, val_len);
+    host_bt_queue_tx(p_val, p_app_ctxt);
+    if ((NULL != p_link) && (0 != host_pending_tx_count))
+    {
+        host_pending_tx[host_pending_tx_count - 1u].conn_id = conn_id;
+        p_link->tx_pending++;
+    }
+    if (NULL != p_link)
+    {
+        p_link->indication = attr_handle;
+    }
+    return WICED_BT_GATT_SUCCESS;
+}
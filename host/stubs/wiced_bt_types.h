@@ -0,0 +1,95 @@
+/******************************************************************************
+* File Name: wiced_bt_types.h
+*
+* Description: Host stand-in for wiced_bt_types.h used by the host build.
+*              Declares only what the application uses.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef WICED_BT_TYPES_H
+#define WICED_BT_TYPES_H
+
+/*******************************************************************************
+*        Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "wiced_result.h"
+
+/*******************************************************************************
+*        Macro Definitions
+*******************************************************************************/
+#define WICED_FALSE                     0
+#define WICED_TRUE                      1
+
+#define BD_ADDR_LEN                     (6)
+
+#define LEN_UUID_16                     (2)
+#define LEN_UUID_32                     (4)
+#define LEN_UUID_128                    (16)
+
+#ifndef MIN
+#define MIN(a, b)                       (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b)                       (((a) > (b)) ? (a) : (b))
+#endif
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+typedef uint32_t wiced_bool_t;
+typedef uint8_t  wiced_bt_device_address_t[BD_ADDR_LEN];
+typedef uint8_t *wiced_bt_device_address_ptr_t;
+typedef uint8_t  wiced_bt_transport_t;
+
+#define BT_TRANSPORT_BR_EDR             1
+#define BT_TRANSPORT_LE                 2
+
+typedef struct
+{
+    uint16_t len;
+    union
+    {
+        uint16_t uuid16;
+        uint32_t uuid32;
+        uint8_t  uuid128[LEN_UUID_128];
+    } uu;
+} wiced_bt_uuid_t;
+
+#endif /* WICED_BT_TYPES_H */
@@ -0,0 +1,67 @@
+/******************************************************************************
+* File Name: wiced_result.h
+*
+* Description: Host stand-in for wiced_result.h used by the host build.
+*              Declares only what the application uses.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef WICED_RESULT_H
+#define WICED_RESULT_H
+
+/*******************************************************************************
+*        Type Definitions
+*******************************************************************************/
+/* Subset of the WICED_RESULT_LIST / BT_RESULT_LIST codes used by the
+ * application. Values match the btstack definitions. */
+typedef enum
+{
+    WICED_SUCCESS                   = 0,
+    WICED_BT_SUCCESS                = 0,
+    WICED_BT_PENDING                = 8001,
+    WICED_BT_TIMEOUT                = 8002,
+    WICED_BT_BADARG                 = 8005,
+    WICED_BT_BUSY                   = 8013,
+    WICED_BT_NO_RESOURCES           = 8015,
+    WICED_BT_UNSUPPORTED            = 8016,
+    WICED_BT_ERROR                  = 8018,
+    WICED_BT_ILLEGAL_VALUE          = 8050,
+    WICED_BT_ILLEGAL_ACTION         = 8051,
+} wiced_result_t;
+
+typedef wiced_result_t wiced_bt_dev_status_t;
+
+#endif /* WICED_RESULT_H */
@@ -54,6 +54,10 @@
 #include <task.h>
 #include "cycfg_bt_settings.h"
 #include "cts_server.h"
+#include "app_log.h"
+#include "app_cpu.h"
+#include "app_mem.h"
+#include "app_bt_bond.h"
 #include "cybsp_bt_config.h"
 
 /*******************************************************************************
@@ -98,6 +102,21 @@ int main()
     cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX,
                         CY_RETARGET_IO_BAUDRATE);
 
+    /* Callbacks log through a ring that a low-priority task prints */
+    app_log_init();
+
+    /* CPU share of every task, printed every APP_CPU_REPORT_WINDOWS windows */
+    app_cpu_init();
+
+    /* Stack and heap use with trimmed sizes, every APP_MEM_REPORT_MS */
+    app_mem_init();
+
+    /* The stack asks for the local identity keys while it starts up */
+    if (WICED_BT_SUCCESS != app_bt_bond_init(&app_bt_bond_default_store))
+    {
+        printf("Bond store not available, bonds are lost on reset!! \n");
+    }
+
     printf("**********************AnyCloud Example*************************\n");
     printf("**** Current Time Service (CTS) - Server Application Start ****\n");
     printf("***************************************************************\n\n");
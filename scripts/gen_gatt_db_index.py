@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+################################################################################
+# \file gen_gatt_db_index.py
+# \version 1.0
+#
+# \brief
+# Generates the handle-indexed lookup table for the GATT database from the
+# Bluetooth Configurator output (cycfg_gatt_db.c). The generated array maps an
+# attribute handle to its entry in app_gatt_db_ext_attr_tbl so that the
+# application finds an attribute with one bounded array access instead of a
+# scan of the table.
+#
+# It also generates the type index that Read By Type uses: the attributes with
+# a table entry, grouped by their 16-bit UUID and sorted by handle, so that a
+# request finds its matches with two binary searches instead of walking the
+# database once per match. UUID and handle values are taken from the
+# cycfg_gatt_db.h next to the source.
+#
+# Usage:
+#   gen_gatt_db_index.py <cycfg_gatt_db.c> <output.c>
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import os
+import re
+import sys
+
+TABLE_RE = re.compile(r"gatt_db_lookup_table_t\s+app_gatt_db_ext_attr_tbl\s*\[\s*\]\s*=\s*\{(.*?)\};",
+                      re.S)
+ENTRY_RE = re.compile(r"\{\s*([A-Za-z_][A-Za-z0-9_]*|0[xX][0-9a-fA-F]+|[0-9]+)\s*,")
+DATABASE_RE = re.compile(r"gatt_database\s*\[\s*\]\s*=\s*\{(.*?)\};", re.S)
+MACRO_RE = re.compile(r"\b([A-Z][A-Z0-9_]*)\s*\(")
+DEFINE_RE = re.compile(r"^\s*#\s*define\s+([A-Za-z_][A-Za-z0-9_]*)\s+\(?\s*"
+                       r"(0[xX][0-9a-fA-F]+|[0-9]+)[uU]?\s*\)?\s*$", re.M)
+
+# Entry macros that declare an attribute with a 16-bit type, and the
+# positions of its handle and type among the macro arguments
+TYPED_ENTRIES = {
+    "CHARACTERISTIC_UUID16": (1, 2),
+    "CHARACTERISTIC_UUID16_WRITABLE": (1, 2),
+    "CHAR_DESCRIPTOR_UUID16": (0, 1),
+    "CHAR_DESCRIPTOR_UUID16_WRITABLE": (0, 1),
+}
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def read_table_handles(path):
+    with open(path, encoding="utf-8") as f:
+        source = strip_comments(f.read())
+    match = TABLE_RE.search(source)
+    if match is None:
+        sys.exit("%s: app_gatt_db_ext_attr_tbl not found" % path)
+    handles = ENTRY_RE.findall(match.group(1))
+    if not handles:
+        sys.exit("%s: app_gatt_db_ext_attr_tbl is empty" % path)
+    if len(set(handles)) != len(handles):
+        sys.exit("%s: app_gatt_db_ext_attr_tbl lists a handle twice" % path)
+    return handles
+
+
+def split_args(text, start):
+    """Returns the comma separated arguments of the call whose opening
+    parenthesis is at text[start - 1], and the offset past its closing one."""
+    args = []
+    depth = 0
+    current = start
+    for i in range(start, len(text)):
+        c = text[i]
+        if c == "(":
+            depth += 1
+        elif c == ")":
+            if depth == 0:
+                args.append(text[current:i].strip())
+                return args, i + 1
+            depth -= 1
+        elif c == "," and depth == 0:
+            args.append(text[current:i].strip())
+            current = i + 1
+    sys.exit("unbalanced parentheses in gatt_database")
+
+
+def read_defines(path):
+    with open(path, encoding="utf-8") as f:
+        return {name: int(value, 0) for name, value in DEFINE_RE.findall(strip_comments(f.read()))}
+
+
+def resolve(token, defines, path):
+    token = token.strip("() ")
+    try:
+        return int(token.rstrip("uU"), 0)
+    except ValueError:
+        pass
+    if token not in defines:
+        sys.exit("%s: no value for %s" % (path, token))
+    return defines[token]
+
+
+def read_typed_attributes(path, header, handles):
+    """Returns (type, handle symbol, handle value, table index) of every
+    16-bit typed attribute that has an entry in app_gatt_db_ext_attr_tbl."""
+    with open(path, encoding="utf-8") as f:
+        source = strip_comments(f.read())
+    match = DATABASE_RE.search(source)
+    if match is None:
+        sys.exit("%s: gatt_database not found" % path)
+    defines = read_defines(header)
+    body = match.group(1)
+    entry = {handle: i for i, handle in enumerate(handles)}
+    attributes = []
+    pos = 0
+    while True:
+        macro = MACRO_RE.search(body, pos)
+        if macro is None:
+            break
+        args, pos = split_args(body, macro.end())
+        if macro.group(1) not in TYPED_ENTRIES:
+            continue
+        handle_arg, type_arg = TYPED_ENTRIES[macro.group(1)]
+        handle = args[handle_arg]
+        if handle in entry:
+            attributes.append((args[type_arg], resolve(args[type_arg], defines, header),
+                               handle, resolve(handle, defines, header), entry[handle]))
+    return attributes
+
+
+def type_index_lines(attributes):
+    groups = {}
+    for type_name, type_value, handle, handle_value, index in attributes:
+        groups.setdefault(type_value, (type_name, []))[1].append((handle_value, handle, index))
+
+    handle_lines = []
+    type_lines = []
+    for type_value in sorted(groups):
+        type_name, members = groups[type_value]
+        members.sort()
+        type_lines.append("    { %s, %d, %d }," % (type_name, len(handle_lines), len(members)))
+        for _, handle, index in members:
+            handle_lines.append("    { %s, %d }," % (handle, index))
+
+    lines = [
+        "",
+        "/* Attributes with a table entry and a 16-bit type, grouped by type and",
+        " * sorted by handle within each group: { handle, index in",
+        " * app_gatt_db_ext_attr_tbl } */",
+        "const app_gatt_db_type_handle_t app_gatt_db_type_handles[] =",
+        "{",
+    ]
+    lines += handle_lines if handle_lines else ["    { 0, 0 },"]
+    lines += [
+        "};",
+        "",
+        "/* Types sorted by value: { type, first entry in app_gatt_db_type_handles,",
+        " * entries } */",
+        "const app_gatt_db_type_t app_gatt_db_types[] =",
+        "{",
+    ]
+    lines += type_lines if type_lines else ["    { 0, 0, 0 },"]
+    lines += [
+        "};",
+        "",
+        "const uint16_t app_gatt_db_types_size = %d;" % len(type_lines),
+        "",
+    ]
+    return lines
+
+
+def write_index(path, source_name, handles, attributes):
+    lines = [
+        "/* Generated by scripts/gen_gatt_db_index.py from %s. Do not edit. */" % source_name,
+        "",
+        "#include \"app_gatt_db_index.h\"",
+        "",
+        "/* Handle -> (index in app_gatt_db_ext_attr_tbl + 1); 0 marks handles without",
+        " * an entry. Designated initializers let the compiler size the array from the",
+        " * highest handle in the table. */",
+        "const uint16_t app_gatt_db_handle_index[] =",
+        "{",
+    ]
+    for i, handle in enumerate(handles):
+        lines.append("    [%s] = %d," % (handle, i + 1))
+    lines += [
+        "};",
+        "",
+        "const uint16_t app_gatt_db_handle_index_size =",
+        "    (uint16_t)(sizeof(app_gatt_db_handle_index) / sizeof(app_gatt_db_handle_index[0]));",
+    ]
+    lines += type_index_lines(attributes)
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: %s <cycfg_gatt_db.c> <output.c>" % sys.argv[0])
+    handles = read_table_handles(sys.argv[1])
+    header = os.path.splitext(sys.argv[1])[0] + ".h"
+    attributes = read_typed_attributes(sys.argv[1], header, handles)
+    write_index(sys.argv[2], "cycfg_gatt_db.c", handles, attributes)
+
+
+if __name__ == "__main__":
+    main()
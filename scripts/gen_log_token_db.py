@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+################################################################################
+# \file gen_log_token_db.py
+# \version 1.0
+#
+# \brief
+# Generates the token database for tokenized logging from app_log_events.h.
+# In tokenized builds the firmware sends only the token of an event (its
+# position in app_log_events.h) and its raw arguments; host/log_decode uses
+# this database to turn the stream back into the text the event describes.
+# The script also checks that each format takes as many arguments as the
+# event declares.
+#
+# Usage:
+#   gen_log_token_db.py <app_log_events.h> <output.db>
+#
+# Output: one line per event,
+#   token <TAB> number of arguments <TAB> name table <TAB> format
+# with the format kept as the C string literal body, escapes included.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import re
+import sys
+
+EVENT_RE = re.compile(r"APP_LOG_EVENT\(\s*([A-Za-z_][A-Za-z0-9_]*)\s*,\s*([0-9]+)\s*,"
+                      r"\s*([A-Za-z_][A-Za-z0-9_]*)\s*,\s*\"((?:[^\"\\]|\\.)*)\"\s*\)")
+CONVERSION_RE = re.compile(r"%(%|[-+ #0-9.hl]*[diouxXcs])")
+
+# Must match APP_LOG_MAX_ARGS in app_log.h
+MAX_ARGS = 6
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def read_events(path):
+    with open(path, encoding="utf-8") as f:
+        source = strip_comments(f.read())
+    events = EVENT_RE.findall(source)
+    if not events:
+        sys.exit("%s: no APP_LOG_EVENT entries" % path)
+    seen = set()
+    for ident, nargs, names, fmt in events:
+        if ident in seen:
+            sys.exit("%s: %s is listed twice" % (path, ident))
+        seen.add(ident)
+        conversions = [c for c in CONVERSION_RE.findall(fmt) if c != "%"]
+        if len(conversions) != int(nargs):
+            sys.exit("%s: %s takes %s arguments but its format has %d conversions"
+                     % (path, ident, nargs, len(conversions)))
+        if int(nargs) > MAX_ARGS:
+            sys.exit("%s: %s takes more than %d arguments" % (path, ident, MAX_ARGS))
+        if "\t" in fmt:
+            sys.exit("%s: %s has a literal tab in its format" % (path, ident))
+    return events
+
+
+def write_db(path, source_name, events):
+    lines = [
+        "# Generated by scripts/gen_log_token_db.py from %s. Do not edit." % source_name,
+        "# token\tnargs\tnames\tformat",
+    ]
+    for token, (ident, nargs, names, fmt) in enumerate(events):
+        lines.append("%d\t%s\t%s\t%s" % (token, nargs, names, fmt))
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: %s <app_log_events.h> <output.db>" % sys.argv[0])
+    events = read_events(sys.argv[1])
+    write_db(sys.argv[2], "app_log_events.h", events)
+
+
+if __name__ == "__main__":
+    main()